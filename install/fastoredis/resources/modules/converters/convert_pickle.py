@@ -1,18 +1,79 @@
 #!/usr/bin/env python2
 
 import sys
+import struct
 import pickle
 import argparse
 
+# --server framing, all sizes are big endian uint32:
+# request: op ('e' encode, 'd' decode) + size + data
+# reply: status (0 ok, 1 error) + size + data or error message
+HEADER_FORMAT = '>cI'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+
+
+def to_bytes(obj):
+    if isinstance(obj, bytes):
+        return obj
+    if isinstance(obj, type(u'')):
+        return obj.encode('utf-8')
+    return repr(obj).encode('utf-8')
+
+
+def read_exactly(stream, size):
+    data = b''
+    while len(data) < size:
+        chunk = stream.read(size - len(data))
+        if not chunk:
+            return None
+        data += chunk
+    return data
+
+
+def serve():
+    if sys.platform == 'win32':
+        import os
+        import msvcrt
+        msvcrt.setmode(sys.stdin.fileno(), os.O_BINARY)
+        msvcrt.setmode(sys.stdout.fileno(), os.O_BINARY)
+
+    stdin = getattr(sys.stdin, 'buffer', sys.stdin)
+    stdout = getattr(sys.stdout, 'buffer', sys.stdout)
+    while True:
+        header = read_exactly(stdin, HEADER_SIZE)
+        if header is None:
+            return
+        op, size = struct.unpack(HEADER_FORMAT, header)
+        data = read_exactly(stdin, size)
+        if data is None:
+            return
+
+        try:
+            if op == b'e':
+                result, status = pickle.dumps(data), 0
+            else:
+                result, status = to_bytes(pickle.loads(data)), 0
+        except Exception as ex:
+            result, status = to_bytes(str(ex)), 1
+
+        stdout.write(struct.pack('>BI', status, len(result)) + result)
+        stdout.flush()
+
+
 if __name__ == "__main__":
     argc = len(sys.argv)
 
     parser = argparse.ArgumentParser()
-    parser.add_argument('data', help='pickle encode/decode hexed string', type=str)
+    parser.add_argument('data', nargs='?', help='pickle encode/decode hexed string', type=str)
     parser.add_argument('--encode', action='store_true', help='pickle encode string')
     parser.add_argument('--decode', action='store_false', help='pickle decode string')
+    parser.add_argument('--server', action='store_true', help='convert framed requests from stdin until eof')
     args = parser.parse_args()
 
+    if args.server:
+        serve()
+        sys.exit(0)
+
     hexed_data = args.data
     unhexed = hexed_data.replace('x', '')  # 1122
     raw_pickle = unhexed.decode('hex')
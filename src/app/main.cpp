@@ -38,6 +38,7 @@
 
 #include "app/credentials_dialog.h"
 
+#include "proxy/command/command_logger.h"
 #include "proxy/server_config.h"
 #include "proxy/settings_manager.h"
 
@@ -199,6 +200,11 @@ int main(int argc, char* argv[]) {
   common::qt::gui::applyStyle(settings_manager->GetCurrentStyle());
   common::qt::gui::applyFont(settings_manager->GetCurrentFont());
 
+  auto& command_logger = fastonosql::proxy::CommandLogger::GetInstance();
+  command_logger.SetSampling(fastonosql::core::C_USER, settings_manager->GetUserCommandsLogSampling());
+  command_logger.SetSampling(fastonosql::core::C_INNER, settings_manager->GetInnerCommandsLogSampling());
+  command_logger.SetFileSink(settings_manager->GetCommandsLogFilePath(), settings_manager->GetCommandsLogFileFormat());
+
   // EULA License Agreement
   if (!settings_manager->GetAccpetedEula()) {
     fastonosql::gui::EulaDialog eula_dialog(trEulaTitle);
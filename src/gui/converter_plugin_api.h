@@ -0,0 +1,60 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+/* C ABI of native value converters. Plugin is shared library in converters directory
+ * (SettingsManager::GetConvertersPath) exporting FASTONOSQL_CONVERTER_ENTRY_SYMBOL:
+ *
+ *   extern "C" const fastonosql_converter_t* fastonosql_converter_entry(void);
+ *
+ * Returned description must stay valid while library is loaded, libraries are never unloaded.
+ * Large values are converted in worker threads, so functions must be reentrant, state is used by one thread. */
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FASTONOSQL_CONVERTER_API_VERSION 1
+#define FASTONOSQL_CONVERTER_ENTRY_SYMBOL "fastonosql_converter_entry"
+
+typedef enum { FASTONOSQL_CONVERTER_DECODE = 0, FASTONOSQL_CONVERTER_ENCODE = 1 } fastonosql_converter_direction_t;
+
+/* output sink, may be called any number of times, non zero result means stop converting */
+typedef int (*fastonosql_converter_write_t)(void* sink, const char* data, size_t size);
+
+typedef struct {
+  unsigned int api_version; /* FASTONOSQL_CONVERTER_API_VERSION */
+  const char* name;         /* title in views list, e.g. "Protobuf" */
+
+  /* state of one value conversion, NULL on error */
+  void* (*create)(fastonosql_converter_direction_t direction);
+  /* next chunk of input, zero on success */
+  int (*update)(void* state, const char* data, size_t size, fastonosql_converter_write_t write, void* sink);
+  /* end of input, rest of output goes to sink, zero on success */
+  int (*finish)(void* state, fastonosql_converter_write_t write, void* sink);
+  void (*destroy)(void* state);
+} fastonosql_converter_t;
+
+typedef const fastonosql_converter_t* (*fastonosql_converter_entry_t)(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,137 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/converter_plugins.h"
+
+#include <algorithm>
+#include <string>
+
+#include <QDir>
+#include <QLibrary>
+
+#include <common/logger.h>
+#include <common/qt/convert2string.h>
+
+#include "proxy/settings_manager.h"
+
+namespace fastonosql {
+namespace gui {
+namespace {
+int WriteToBuffer(void* sink, const char* data, size_t size) {
+  convert_out_t* out = static_cast<convert_out_t*>(sink);
+  *out += GEN_READABLE_STRING_SIZE(data, size);
+  return 0;
+}
+
+bool IsValidPlugin(const fastonosql_converter_t* plugin) {
+  return plugin && plugin->api_version == FASTONOSQL_CONVERTER_API_VERSION && plugin->name && plugin->create &&
+         plugin->update && plugin->finish && plugin->destroy;
+}
+}  // namespace
+
+ConverterPlugins::ConverterPlugins() : plugins_() {
+  QString converters_path;
+  common::ConvertFromString(proxy::SettingsManager::GetInstance()->GetConvertersPath(), &converters_path);
+  const QFileInfoList files = QDir(converters_path).entryInfoList(QDir::Files, QDir::Name);
+  for (const QFileInfo& file : files) {
+    if (plugins_.size() == max_plugins) {
+      WARNING_LOG() << "Too many converter plugins, rest are skipped.";
+      break;
+    }
+
+    const QString path = file.absoluteFilePath();
+    if (!QLibrary::isLibrary(path)) {
+      continue;
+    }
+
+    // library stays loaded until exit, QLibrary destructor doesn't unload it
+    QLibrary library(path);
+    const fastonosql_converter_entry_t entry =
+        reinterpret_cast<fastonosql_converter_entry_t>(library.resolve(FASTONOSQL_CONVERTER_ENTRY_SYMBOL));
+    if (!entry) {
+      WARNING_LOG() << "Can't load converter plugin " << common::ConvertToString(path) << ": "
+                    << common::ConvertToString(library.errorString());
+      continue;
+    }
+
+    const fastonosql_converter_t* plugin = entry();
+    if (!IsValidPlugin(plugin)) {
+      WARNING_LOG() << "Converter plugin " << common::ConvertToString(path) << " has unsupported api version.";
+      continue;
+    }
+
+    plugins_.push_back(plugin);
+  }
+}
+
+size_t ConverterPlugins::GetCount() const {
+  return plugins_.size();
+}
+
+const char* ConverterPlugins::GetName(size_t index) const {
+  if (index >= plugins_.size()) {
+    DNOTREACHED();
+    return nullptr;
+  }
+
+  return plugins_[index]->name;
+}
+
+bool ConverterPlugins::Decode(size_t index, const convert_in_t& value, convert_out_t* out) const {
+  return Convert(index, FASTONOSQL_CONVERTER_DECODE, value, out);
+}
+
+bool ConverterPlugins::Encode(size_t index, const convert_in_t& data, convert_out_t* out) const {
+  return Convert(index, FASTONOSQL_CONVERTER_ENCODE, data, out);
+}
+
+bool ConverterPlugins::Convert(size_t index,
+                               fastonosql_converter_direction_t direction,
+                               const convert_in_t& in,
+                               convert_out_t* out) const {
+  if (!out || in.empty() || index >= plugins_.size()) {
+    return false;
+  }
+
+  const fastonosql_converter_t* plugin = plugins_[index];
+  void* state = plugin->create(direction);
+  if (!state) {
+    return false;
+  }
+
+  convert_out_t result;
+  bool is_ok = true;
+  for (size_t pos = 0; pos < in.size() && is_ok; pos += chunk_size) {
+    const size_t size = std::min<size_t>(chunk_size, in.size() - pos);
+    is_ok = plugin->update(state, reinterpret_cast<const char*>(in.data()) + pos, size, &WriteToBuffer, &result) == 0;
+  }
+  if (is_ok) {
+    is_ok = plugin->finish(state, &WriteToBuffer, &result) == 0;
+  }
+  plugin->destroy(state);
+
+  if (!is_ok) {
+    return false;
+  }
+
+  *out = result;
+  return true;
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,56 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include <common/patterns/singleton_pattern.h>
+
+#include "gui/converter_plugin_api.h"
+#include "gui/text_converter.h"
+
+namespace fastonosql {
+namespace gui {
+
+// native codecs loaded from converters directory, shown in FastoViewer after built-in views
+class ConverterPlugins : public common::patterns::LazySingleton<ConverterPlugins> {
+ public:
+  friend class common::patterns::LazySingleton<ConverterPlugins>;
+  enum { chunk_size = 64 * 1024, max_plugins = 64 };
+
+  size_t GetCount() const;
+  const char* GetName(size_t index) const;
+
+  // input is fed to plugin by chunk_size pieces
+  bool Decode(size_t index, const convert_in_t& value, convert_out_t* out) const;
+  bool Encode(size_t index, const convert_in_t& data, convert_out_t* out) const;
+
+ private:
+  ConverterPlugins();  // loads every library with valid entry
+
+  bool Convert(size_t index,
+               fastonosql_converter_direction_t direction,
+               const convert_in_t& in,
+               convert_out_t* out) const;
+
+  std::vector<const fastonosql_converter_t*> plugins_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,315 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/dialogs/benchmark_dialog.h"
+
+#include <algorithm>
+
+#include <QDialogButtonBox>
+#include <QGridLayout>
+#include <QLabel>
+#include <QMessageBox>
+#include <QPlainTextEdit>
+#include <QPushButton>
+#include <QSpinBox>
+
+#include <common/qt/convert2string.h>
+
+#include "proxy/benchmark_generator.h"
+#include "proxy/server/iserver.h"
+#include "proxy/servers_manager.h"
+
+#include "translations/global.h"
+
+namespace {
+const QString trStart = QObject::tr("Start");
+const QString trCommandsMix = QObject::tr("Commands mix (weight command), " BENCHMARK_RANDOM_INT_PLACEHOLDER
+                                          " and " BENCHMARK_DATA_PLACEHOLDER " are substituted:");
+const QString trRequests = QObject::tr("Requests:");
+const QString trConnections = QObject::tr("Parallel connections:");
+const QString trPipeline = QObject::tr("Pipeline depth:");
+const QString trKeyspace = QObject::tr("Keyspace size:");
+const QString trValueSize = QObject::tr("Value size, bytes:");
+const QString trResultsTemplate_8S = QObject::tr(
+    "Executed: %1, failed: %2, time: %3 msec\n"
+    "Throughput: %4 requests/sec\n"
+    "Latency, usec: p50 %5, p99 %6, p99.9 %7, max %8");
+const QString trRunningTemplate_2S = QObject::tr("Running on %1 of %2 connections...");
+const char kDefaultCommandsMix[] =
+    "50 SET key:" BENCHMARK_RANDOM_INT_PLACEHOLDER " " BENCHMARK_DATA_PLACEHOLDER
+    "\n"
+    "50 GET key:" BENCHMARK_RANDOM_INT_PLACEHOLDER;
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+BenchmarkDialog::BenchmarkDialog(const QString& title,
+                                 const QIcon& icon,
+                                 proxy::IConnectionSettingsBaseSPtr settings,
+                                 QWidget* parent)
+    : base_class(title, parent),
+      commands_label_(nullptr),
+      commands_edit_(nullptr),
+      requests_label_(nullptr),
+      requests_(nullptr),
+      connections_label_(nullptr),
+      connections_(nullptr),
+      pipeline_label_(nullptr),
+      pipeline_(nullptr),
+      keyspace_label_(nullptr),
+      keyspace_(nullptr),
+      value_size_label_(nullptr),
+      value_size_(nullptr),
+      start_stop_button_(nullptr),
+      results_label_(nullptr),
+      settings_(settings),
+      servers_(),
+      mix_(),
+      pending_connections_(0),
+      latency_(),
+      executed_(0),
+      failed_(0),
+      max_elapsed_msec_(0),
+      running_(false) {
+  CHECK(settings_) << "Must be settings.";
+  setWindowIcon(icon);
+
+  commands_label_ = new QLabel;
+  commands_edit_ = new QPlainTextEdit;
+  commands_edit_->setPlainText(kDefaultCommandsMix);
+
+  QGridLayout* settings_layout = new QGridLayout;
+  requests_label_ = new QLabel;
+  requests_ = new QSpinBox;
+  requests_->setRange(1, max_requests);
+  requests_->setValue(default_requests);
+  settings_layout->addWidget(requests_label_, 0, 0);
+  settings_layout->addWidget(requests_, 0, 1);
+
+  connections_label_ = new QLabel;
+  connections_ = new QSpinBox;
+  connections_->setRange(1, max_connections);
+  connections_->setValue(default_connections);
+  settings_layout->addWidget(connections_label_, 0, 2);
+  settings_layout->addWidget(connections_, 0, 3);
+
+  pipeline_label_ = new QLabel;
+  pipeline_ = new QSpinBox;
+  pipeline_->setRange(1, max_pipeline);
+  pipeline_->setValue(default_pipeline);
+  settings_layout->addWidget(pipeline_label_, 1, 0);
+  settings_layout->addWidget(pipeline_, 1, 1);
+
+  keyspace_label_ = new QLabel;
+  keyspace_ = new QSpinBox;
+  keyspace_->setRange(1, max_keyspace);
+  keyspace_->setValue(default_keyspace);
+  settings_layout->addWidget(keyspace_label_, 1, 2);
+  settings_layout->addWidget(keyspace_, 1, 3);
+
+  value_size_label_ = new QLabel;
+  value_size_ = new QSpinBox;
+  value_size_->setRange(0, max_value_size);
+  value_size_->setValue(default_value_size);
+  settings_layout->addWidget(value_size_label_, 2, 0);
+  settings_layout->addWidget(value_size_, 2, 1);
+
+  start_stop_button_ = new QPushButton;
+  VERIFY(connect(start_stop_button_, &QPushButton::clicked, this, &BenchmarkDialog::startStopClicked));
+  settings_layout->addWidget(start_stop_button_, 2, 3);
+
+  results_label_ = new QLabel;
+  results_label_->setTextInteractionFlags(Qt::TextSelectableByMouse);
+
+  QDialogButtonBox* button_box = new QDialogButtonBox(QDialogButtonBox::Ok);
+  button_box->setOrientation(Qt::Horizontal);
+  VERIFY(connect(button_box, &QDialogButtonBox::accepted, this, &BenchmarkDialog::accept));
+
+  QVBoxLayout* main_layout = new QVBoxLayout;
+  main_layout->addWidget(commands_label_);
+  main_layout->addWidget(commands_edit_);
+  main_layout->addLayout(settings_layout);
+  main_layout->addWidget(results_label_);
+  main_layout->addWidget(button_box);
+  setLayout(main_layout);
+  setMinimumSize(QSize(min_width, min_height));
+
+  updateControls();
+}
+
+BenchmarkDialog::~BenchmarkDialog() {
+  closeConnections();
+}
+
+void BenchmarkDialog::finishConnect(const proxy::events_info::ConnectInfoResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  proxy::IServer* server = qobject_cast<proxy::IServer*>(sender());
+  common::Error err = res.errorInfo();
+  if (err || !running_ || !server) {
+    finishConnection();
+    return;
+  }
+
+  // requests are split between connections, first ones take the remainder
+  const size_t connections = servers_.size();
+  const size_t total_requests = requests_->value();
+  size_t index = 0;
+  for (size_t i = 0; i < servers_.size(); ++i) {
+    if (servers_[i].get() == server) {
+      index = i;
+      break;
+    }
+  }
+  const size_t requests = total_requests / connections + (index < total_requests % connections ? 1 : 0);
+  proxy::events_info::BenchmarkRequest req(this, mix_, requests, pipeline_->value(), keyspace_->value(),
+                                           value_size_->value(), static_cast<uint32_t>(index + 1));
+  server->Benchmark(req);
+}
+
+void BenchmarkDialog::finishBenchmark(const proxy::events_info::BenchmarkResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  latency_.Merge(res.latency);
+  executed_ += res.executed;
+  failed_ += res.failed;
+  max_elapsed_msec_ = std::max(max_elapsed_msec_, res.elapsed_msec);
+  finishConnection();
+}
+
+void BenchmarkDialog::startStopClicked() {
+  if (running_) {
+    for (const auto& server : servers_) {
+      server->StopCurrentEvent();
+    }
+    return;
+  }
+
+  proxy::benchmark_mix_t mix;
+  common::Error err = proxy::ParseBenchmarkMix(common::ConvertToString(commands_edit_->toPlainText()), &mix);
+  if (err) {
+    QString qdesc;
+    common::ConvertFromString(err->GetDescription(), &qdesc);
+    QMessageBox::warning(this, translations::trError, qdesc);
+    return;
+  }
+
+  mix_ = mix;
+  latency_.Reset();
+  executed_ = 0;
+  failed_ = 0;
+  max_elapsed_msec_ = 0;
+  running_ = true;
+
+  // history isn't needed for load connections and all of them would write same file, values aren't cached either
+  const int connections = connections_->value();
+  for (int i = 0; i < connections; ++i) {
+    proxy::IConnectionSettingsBaseSPtr settings(settings_->Clone());
+    settings->SetLoggingMsTimeInterval(0);
+    settings->SetValueTrackingEnabled(false);
+    proxy::IServerSPtr server = proxy::ServersManager::GetInstance().CreateServer(settings);
+    if (!server) {
+      continue;
+    }
+
+    VERIFY(connect(server.get(), &proxy::IServer::ConnectFinished, this, &BenchmarkDialog::finishConnect));
+    VERIFY(connect(server.get(), &proxy::IServer::BenchmarkFinished, this, &BenchmarkDialog::finishBenchmark));
+    servers_.push_back(server);
+  }
+
+  pending_connections_ = servers_.size();
+  for (const auto& server : servers_) {
+    proxy::events_info::ConnectInfoRequest req(this);
+    server->Connect(req);
+  }
+  updateControls();
+}
+
+void BenchmarkDialog::retranslateUi() {
+  commands_label_->setText(trCommandsMix);
+  requests_label_->setText(trRequests);
+  connections_label_->setText(trConnections);
+  pipeline_label_->setText(trPipeline);
+  keyspace_label_->setText(trKeyspace);
+  value_size_label_->setText(trValueSize);
+  updateControls();
+  base_class::retranslateUi();
+}
+
+void BenchmarkDialog::finishConnection() {
+  if (pending_connections_ == 0) {
+    return;
+  }
+
+  pending_connections_--;
+  if (pending_connections_ == 0) {
+    running_ = false;
+    closeConnections();
+  }
+  updateControls();
+}
+
+void BenchmarkDialog::closeConnections() {
+  for (const auto& server : servers_) {
+    VERIFY(disconnect(server.get(), &proxy::IServer::ConnectFinished, this, &BenchmarkDialog::finishConnect));
+    VERIFY(disconnect(server.get(), &proxy::IServer::BenchmarkFinished, this, &BenchmarkDialog::finishBenchmark));
+    proxy::ServersManager::GetInstance().CloseServer(server);
+  }
+  servers_.clear();
+}
+
+void BenchmarkDialog::updateControls() {
+  start_stop_button_->setText(running_ ? translations::trStop : trStart);
+  commands_edit_->setReadOnly(running_);
+  requests_->setEnabled(!running_);
+  connections_->setEnabled(!running_);
+  pipeline_->setEnabled(!running_);
+  keyspace_->setEnabled(!running_);
+  value_size_->setEnabled(!running_);
+  updateResults();
+}
+
+void BenchmarkDialog::updateResults() {
+  if (running_) {
+    results_label_->setText(trRunningTemplate_2S.arg(pending_connections_).arg(servers_.size()));
+    return;
+  }
+
+  if (executed_ == 0 && failed_ == 0) {
+    results_label_->clear();
+    return;
+  }
+
+  const double throughput = max_elapsed_msec_ ? static_cast<double>(executed_) * 1000 / max_elapsed_msec_ : 0;
+  results_label_->setText(trResultsTemplate_8S.arg(executed_)
+                              .arg(failed_)
+                              .arg(max_elapsed_msec_)
+                              .arg(throughput, 0, 'f', 1)
+                              .arg(latency_.GetPercentile(50))
+                              .arg(latency_.GetPercentile(99))
+                              .arg(latency_.GetPercentile(99.9))
+                              .arg(latency_.GetMax()));
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,116 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "gui/dialogs/base_dialog.h"
+
+#include "proxy/benchmark_generator.h"
+#include "proxy/connection_settings/iconnection_settings.h"
+#include "proxy/proxy_fwd.h"
+#include "proxy/value_histogram.h"
+
+class QLabel;
+class QPlainTextEdit;
+class QPushButton;
+class QSpinBox;
+
+namespace fastonosql {
+namespace proxy {
+namespace events_info {
+struct ConnectInfoResponse;
+struct BenchmarkResponse;
+}  // namespace events_info
+}  // namespace proxy
+namespace gui {
+
+// redis-benchmark like load generator, every connection is separate server with own driver thread
+class BenchmarkDialog : public BaseDialog {
+  Q_OBJECT
+
+ public:
+  typedef BaseDialog base_class;
+  template <typename T, typename... Args>
+  friend T* createDialog(Args&&... args);
+  enum {
+    min_width = 640,
+    min_height = 480,
+    max_requests = 100000000,
+    default_requests = 100000,
+    max_connections = 64,
+    default_connections = 4,
+    max_pipeline = 10000,
+    default_pipeline = 1,
+    max_keyspace = 100000000,
+    default_keyspace = 10000,
+    max_value_size = 1024 * 1024,
+    default_value_size = 64
+  };
+
+  ~BenchmarkDialog() override;
+
+ private Q_SLOTS:
+  void finishConnect(const proxy::events_info::ConnectInfoResponse& res);
+  void finishBenchmark(const proxy::events_info::BenchmarkResponse& res);
+
+  void startStopClicked();
+
+ protected:
+  explicit BenchmarkDialog(const QString& title,
+                           const QIcon& icon,
+                           proxy::IConnectionSettingsBaseSPtr settings,
+                           QWidget* parent = Q_NULLPTR);
+
+  void retranslateUi() override;
+
+ private:
+  void finishConnection();
+  void closeConnections();
+  void updateControls();
+  void updateResults();
+
+  QLabel* commands_label_;
+  QPlainTextEdit* commands_edit_;
+  QLabel* requests_label_;
+  QSpinBox* requests_;
+  QLabel* connections_label_;
+  QSpinBox* connections_;
+  QLabel* pipeline_label_;
+  QSpinBox* pipeline_;
+  QLabel* keyspace_label_;
+  QSpinBox* keyspace_;
+  QLabel* value_size_label_;
+  QSpinBox* value_size_;
+  QPushButton* start_stop_button_;
+  QLabel* results_label_;
+
+  const proxy::IConnectionSettingsBaseSPtr settings_;
+  std::vector<proxy::IServerSPtr> servers_;
+  proxy::benchmark_mix_t mix_;
+  size_t pending_connections_;
+  proxy::ValueHistogram latency_;
+  size_t executed_;
+  size_t failed_;
+  common::time64_t max_elapsed_msec_;
+  bool running_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
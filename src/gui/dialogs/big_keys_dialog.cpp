@@ -0,0 +1,100 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "gui/dialogs/big_keys_dialog.h"
+
+#include <QComboBox>
+#include <QLabel>
+#include <QSortFilterProxyModel>
+#include <QSpinBox>
+
+#include "gui/models/big_keys_table_model.h"
+#include "gui/views/fasto_table_view.h"
+
+namespace {
+const QString trKeysPerType = QObject::tr("Top keys per type:");
+const QString trRankBy = QObject::tr("Rank by:");
+const QString trMemoryUsage = QObject::tr("Memory usage");
+const QString trElementsCount = QObject::tr("Elements count");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+BigKeysDialog::BigKeysDialog(const QString& title, const QIcon& icon, proxy::IDatabaseSPtr db, QWidget* parent)
+    : base_class(title, icon, db, default_throttle_msec, parent),
+      keys_per_type_label_(nullptr),
+      keys_per_type_(nullptr),
+      rank_label_(nullptr),
+      rank_(nullptr),
+      keys_table_(nullptr),
+      keys_model_(nullptr),
+      proxy_model_(nullptr) {
+  keys_per_type_label_ = new QLabel;
+  keys_per_type_ = new QSpinBox;
+  keys_per_type_->setRange(1, max_keys_per_type);
+  keys_per_type_->setValue(default_keys_per_type);
+  addScanOption(keys_per_type_label_, keys_per_type_);
+
+  // ranking is part of collected heaps, locked with other scan options
+  rank_label_ = new QLabel;
+  rank_ = new QComboBox;
+  addScanOption(rank_label_, rank_);
+
+  keys_model_ = new BigKeysTableModel(this);
+  proxy_model_ = new QSortFilterProxyModel(this);
+  proxy_model_->setSourceModel(keys_model_);
+  proxy_model_->setDynamicSortFilter(true);
+
+  keys_table_ = new FastoTableView;
+  keys_table_->setSortingEnabled(true);
+  keys_table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+  keys_table_->setSelectionMode(QAbstractItemView::SingleSelection);
+  keys_table_->sortByColumn(BigKeysTableModel::kMemory, Qt::DescendingOrder);
+  keys_table_->setModel(proxy_model_);
+  setResultsView(keys_table_);
+}
+
+void BigKeysDialog::startScan() {
+  keys_model_->reset(keys_per_type_->value(), static_cast<BigKeysTableModel::eRank>(rank_->currentIndex()));
+}
+
+void BigKeysDialog::clearResults() {
+  keys_model_->clear();
+}
+
+void BigKeysDialog::addKeysStatistics(const std::vector<proxy::NDbKeyStat>& keys) {
+  for (const proxy::NDbKeyStat& stat : keys) {
+    keys_model_->offerKey(stat);
+  }
+}
+
+void BigKeysDialog::retranslateUi() {
+  keys_per_type_label_->setText(trKeysPerType);
+  rank_label_->setText(trRankBy);
+  const int rank_index = rank_->currentIndex();
+  rank_->clear();
+  rank_->addItem(trMemoryUsage);    // BigKeysTableModel::kRankByMemory
+  rank_->addItem(trElementsCount);  // BigKeysTableModel::kRankByElements
+  rank_->setCurrentIndex(rank_index < 0 ? 0 : rank_index);
+  base_class::retranslateUi();
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,261 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/dialogs/collection_value_dialog.h"
+
+#include <vector>
+
+#include <QDialogButtonBox>
+#include <QLabel>
+#include <QMessageBox>
+#include <QPushButton>
+#include <QVBoxLayout>
+
+#include <common/qt/convert2string.h>
+
+#include "proxy/database/idatabase.h"
+#include "proxy/server/iserver.h"
+
+#include "gui/models/hash_table_model.h"
+#include "gui/models/list_table_model.h"
+#include "gui/value_changes.h"
+#include "gui/widgets/hash_type_view.h"
+#include "gui/widgets/list_type_view.h"
+
+#include "translations/global.h"
+
+namespace {
+const QString trLoadedTemplate_2S = QObject::tr("Loaded %1 of %2 elements, scroll down to load more");
+const QString trLoadedAllTemplate_1S = QObject::tr("Loaded all %1 elements");
+const QString trSaveValue = QObject::tr("Save value");
+const QString trNoChanges = QObject::tr("There are no changes to save.");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+CollectionValueDialog::CollectionValueDialog(const QString& title,
+                                             const QIcon& icon,
+                                             proxy::IDatabaseSPtr db,
+                                             const core::NKey& key,
+                                             common::Value::Type type,
+                                             QWidget* parent)
+    : base_class(title, parent),
+      loaded_label_(nullptr),
+      hash_view_(nullptr),
+      list_view_(nullptr),
+      save_button_(nullptr),
+      db_(db),
+      key_(key),
+      type_(type),
+      cursor_(0),
+      changed_(false),
+      saving_(false) {
+  CHECK(db_) << "Must be database.";
+  setWindowIcon(icon);
+
+  proxy::IServerSPtr server = db_->GetServer();
+  VERIFY(connect(server.get(), &proxy::IServer::LoadValuePageFinished, this,
+                 &CollectionValueDialog::finishLoadValuePage));
+  VERIFY(connect(server.get(), &proxy::IServer::SaveValueChangesFinished, this,
+                 &CollectionValueDialog::finishSaveValueChanges));
+
+  loaded_label_ = new QLabel;
+
+  QVBoxLayout* main_layout = new QVBoxLayout;
+  main_layout->addWidget(loaded_label_);
+  if (isListView()) {
+    list_view_ = new ListTypeView;
+    list_view_->setCurrentMode(type_ == common::Value::TYPE_SET ? ListTypeView::kSet : ListTypeView::kArray);
+    ListTableModel* model = list_view_->tableModel();
+    model->setPaged(true);
+    VERIFY(connect(model, &ListTableModel::fetchMoreRequested, this, &CollectionValueDialog::fetchPage));
+    VERIFY(connect(list_view_, &ListTypeView::dataChangedSignal, this, &CollectionValueDialog::changeData));
+    main_layout->addWidget(list_view_);
+  } else {
+    hash_view_ = new HashTypeView;
+    hash_view_->setCurrentMode(type_ == common::Value::TYPE_ZSET ? HashTypeView::kZset : HashTypeView::kHash);
+    HashTableModel* model = hash_view_->tableModel();
+    model->setPaged(true);
+    VERIFY(connect(model, &HashTableModel::fetchMoreRequested, this, &CollectionValueDialog::fetchPage));
+    VERIFY(connect(hash_view_, &HashTypeView::dataChangedSignal, this, &CollectionValueDialog::changeData));
+    main_layout->addWidget(hash_view_);
+  }
+
+  save_button_ = new QPushButton;
+  VERIFY(connect(save_button_, &QPushButton::clicked, this, &CollectionValueDialog::saveClicked));
+
+  QDialogButtonBox* button_box = new QDialogButtonBox(QDialogButtonBox::Close);
+  button_box->setOrientation(Qt::Horizontal);
+  button_box->addButton(save_button_, QDialogButtonBox::ActionRole);
+  VERIFY(connect(button_box, &QDialogButtonBox::rejected, this, &CollectionValueDialog::reject));
+  main_layout->addWidget(button_box);
+  setLayout(main_layout);
+  setMinimumSize(QSize(min_width, min_height));
+
+  reload();
+}
+
+void CollectionValueDialog::finishLoadValuePage(const proxy::events_info::LoadValuePageResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  common::Error err = res.errorInfo();
+  if (err) {
+    if (isListView()) {
+      list_view_->tableModel()->stopFetch();
+    } else {
+      hash_view_->tableModel()->stopFetch();
+    }
+    QString qerror;
+    common::ConvertFromString(err->GetDescription(), &qerror);
+    loaded_label_->setText(qerror);
+    return;
+  }
+
+  cursor_ = res.cursor_out;
+  const bool is_last = res.cursor_out == 0;
+  if (isListView()) {
+    list_view_->tableModel()->appendPage(res.items, res.total, is_last);
+  } else {
+    // zset rows are score, member, ZSCAN replies member, score
+    const bool is_zset = type_ == common::Value::TYPE_ZSET;
+    std::vector<HashTableModel::row_t> rows;
+    rows.reserve(res.items.size() / 2);
+    for (size_t i = 0; i + 1 < res.items.size(); i += 2) {
+      if (is_zset) {
+        rows.push_back(HashTableModel::row_t(res.items[i + 1], res.items[i]));
+      } else {
+        rows.push_back(HashTableModel::row_t(res.items[i], res.items[i + 1]));
+      }
+    }
+    hash_view_->tableModel()->appendPage(rows, res.total, is_last);
+  }
+  updateControls();
+}
+
+void CollectionValueDialog::finishSaveValueChanges(const proxy::events_info::SaveValueChangesResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  saving_ = false;
+  common::Error err = res.errorInfo();
+  if (err) {
+    QString qerror;
+    common::ConvertFromString(err->GetDescription(), &qerror);
+    QMessageBox::critical(this, translations::trError, qerror);
+    if (res.stale) {
+      // edits were made against rows database doesn't have anymore
+      reload();
+      return;
+    }
+    updateControls();
+    return;
+  }
+
+  // stored rows are out of date now
+  reload();
+}
+
+void CollectionValueDialog::fetchPage() {
+  proxy::events_info::LoadValuePageRequest req(this, db_->GetInfo(), key_, type_, cursor_, page_size);
+  db_->GetServer()->LoadValuePage(req);
+}
+
+void CollectionValueDialog::changeData() {
+  changed_ = true;
+  updateControls();
+}
+
+void CollectionValueDialog::saveClicked() {
+  const proxy::ValueChangesCommands commands = changesCommands();
+  if (commands.IsEmpty()) {
+    QMessageBox::information(this, trSaveValue, trNoChanges);
+    return;
+  }
+
+  saving_ = true;
+  updateControls();
+  // value is not kept whole here, so no loaded key to update
+  proxy::events_info::SaveValueChangesRequest req(this, db_->GetInfo(), core::NDbKValue(key_, core::NValue()),
+                                                  commands);
+  db_->GetServer()->SaveValueChanges(req);
+}
+
+void CollectionValueDialog::retranslateUi() {
+  save_button_->setText(translations::trSaveChanges);
+  updateControls();
+  base_class::retranslateUi();
+}
+
+bool CollectionValueDialog::isListView() const {
+  return type_ == common::Value::TYPE_ARRAY || type_ == common::Value::TYPE_SET;
+}
+
+proxy::ValueChangesCommands CollectionValueDialog::changesCommands() const {
+  if (isListView()) {
+    return MakeListChangesCommands(key_, type_, list_view_->tableModel());
+  }
+  return MakeHashChangesCommands(key_, type_, hash_view_->tableModel());
+}
+
+void CollectionValueDialog::reload() {
+  cursor_ = 0;
+  if (isListView()) {
+    list_view_->clear();
+  } else {
+    hash_view_->clear();
+  }
+  changed_ = false;  // clear emits data changed
+  updateControls();
+  // first page explicitly, next ones are asked by view when it is scrolled to the end
+  if (isListView()) {
+    list_view_->tableModel()->fetchMore(QModelIndex());
+  } else {
+    hash_view_->tableModel()->fetchMore(QModelIndex());
+  }
+}
+
+void CollectionValueDialog::updateControls() {
+  uint64_t loaded = 0;
+  uint64_t total = 0;
+  bool fully_loaded = false;
+  if (isListView()) {
+    const ListTableModel* model = list_view_->tableModel();
+    loaded = model->loadedCount();
+    total = model->totalCount();
+    fully_loaded = model->isFullyLoaded();
+  } else {
+    const HashTableModel* model = hash_view_->tableModel();
+    loaded = model->loadedCount();
+    total = model->totalCount();
+    fully_loaded = model->isFullyLoaded();
+  }
+
+  if (fully_loaded) {
+    loaded_label_->setText(trLoadedAllTemplate_1S.arg(loaded));
+  } else {
+    loaded_label_->setText(trLoadedTemplate_2S.arg(loaded).arg(total));
+  }
+  save_button_->setEnabled(changed_ && !saving_);
+}
+
+}  // namespace gui
+}  // namespace fastonosql
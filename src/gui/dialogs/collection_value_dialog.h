@@ -0,0 +1,100 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include <fastonosql/core/db_key.h>
+#include <fastonosql/core/types.h>
+
+#include "gui/dialogs/base_dialog.h"
+
+#include "proxy/proxy_fwd.h"
+#include "proxy/types.h"
+
+class QLabel;
+class QPushButton;
+
+namespace fastonosql {
+namespace proxy {
+namespace events_info {
+struct LoadValuePageResponse;
+struct SaveValueChangesResponse;
+}  // namespace events_info
+}  // namespace proxy
+namespace gui {
+
+class HashTypeView;
+class ListTypeView;
+
+// hash, set, zset or list value too big to load at once: rows are read by HSCAN/SSCAN/ZSCAN/LRANGE pages
+// when table is scrolled to the end, saving sends only changed rows instead of rewriting whole value
+class CollectionValueDialog : public BaseDialog {
+  Q_OBJECT
+
+ public:
+  typedef BaseDialog base_class;
+  template <typename T, typename... Args>
+  friend T* createDialog(Args&&... args);
+  enum {
+    min_width = 640,
+    min_height = 480,
+    page_size = 500,
+    min_elements_count = 10000  // smaller collections are loaded whole
+  };
+
+ private Q_SLOTS:
+  void finishLoadValuePage(const proxy::events_info::LoadValuePageResponse& res);
+  void finishSaveValueChanges(const proxy::events_info::SaveValueChangesResponse& res);
+
+  void fetchPage();
+  void changeData();
+  void saveClicked();
+
+ protected:
+  explicit CollectionValueDialog(const QString& title,
+                                 const QIcon& icon,
+                                 proxy::IDatabaseSPtr db,
+                                 const core::NKey& key,
+                                 common::Value::Type type,
+                                 QWidget* parent = Q_NULLPTR);
+
+  void retranslateUi() override;
+
+ private:
+  bool isListView() const;
+  proxy::ValueChangesCommands changesCommands() const;
+  void reload();
+  void updateControls();
+
+  QLabel* loaded_label_;
+  HashTypeView* hash_view_;
+  ListTypeView* list_view_;
+  QPushButton* save_button_;
+  proxy::IDatabaseSPtr db_;
+  const core::NKey key_;
+  const common::Value::Type type_;
+
+  core::cursor_t cursor_;
+  bool changed_;
+  bool saving_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
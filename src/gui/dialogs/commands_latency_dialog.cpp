@@ -0,0 +1,119 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/dialogs/commands_latency_dialog.h"
+
+#include <QCheckBox>
+#include <QDialogButtonBox>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QSortFilterProxyModel>
+#include <QTimerEvent>
+
+#include "proxy/server/iserver.h"
+
+#include "gui/models/commands_latency_table_model.h"
+#include "gui/views/fasto_table_view.h"
+
+namespace {
+const QString trAutoRefresh = QObject::tr("Auto refresh");
+const QString trRefresh = QObject::tr("Refresh");
+const QString trReset = QObject::tr("Reset");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+CommandsLatencyDialog::CommandsLatencyDialog(const QString& title,
+                                             const QIcon& icon,
+                                             proxy::IServerSPtr server,
+                                             QWidget* parent)
+    : base_class(title, parent),
+      auto_refresh_(nullptr),
+      refresh_button_(nullptr),
+      reset_button_(nullptr),
+      table_(nullptr),
+      model_(nullptr),
+      server_(server),
+      timer_id_(0) {
+  CHECK(server_) << "Must be server.";
+  setWindowIcon(icon);
+
+  QHBoxLayout* control_layout = new QHBoxLayout;
+  auto_refresh_ = new QCheckBox;
+  auto_refresh_->setChecked(true);
+  refresh_button_ = new QPushButton;
+  VERIFY(connect(refresh_button_, &QPushButton::clicked, this, &CommandsLatencyDialog::refreshClicked));
+  reset_button_ = new QPushButton;
+  VERIFY(connect(reset_button_, &QPushButton::clicked, this, &CommandsLatencyDialog::resetClicked));
+  control_layout->addWidget(auto_refresh_, 1);
+  control_layout->addWidget(refresh_button_);
+  control_layout->addWidget(reset_button_);
+
+  model_ = new CommandsLatencyTableModel(this);
+  QSortFilterProxyModel* proxy_model = new QSortFilterProxyModel(this);
+  proxy_model->setSourceModel(model_);
+  proxy_model->setDynamicSortFilter(true);
+
+  table_ = new FastoTableView;
+  table_->setSortingEnabled(true);
+  table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+  table_->setSelectionMode(QAbstractItemView::SingleSelection);
+  table_->sortByColumn(CommandsLatencyTableModel::kP99, Qt::DescendingOrder);
+  table_->setModel(proxy_model);
+
+  QDialogButtonBox* button_box = new QDialogButtonBox(QDialogButtonBox::Ok);
+  button_box->setOrientation(Qt::Horizontal);
+  VERIFY(connect(button_box, &QDialogButtonBox::accepted, this, &CommandsLatencyDialog::accept));
+
+  QVBoxLayout* main_layout = new QVBoxLayout;
+  main_layout->addLayout(control_layout);
+  main_layout->addWidget(table_);
+  main_layout->addWidget(button_box);
+  setLayout(main_layout);
+  setMinimumSize(QSize(min_width, min_height));
+
+  refreshClicked();
+  timer_id_ = startTimer(refresh_interval_msec);
+}
+
+void CommandsLatencyDialog::refreshClicked() {
+  model_->setLatency(server_->GetCommandsLatency());
+}
+
+void CommandsLatencyDialog::resetClicked() {
+  server_->ResetCommandsLatency();
+  refreshClicked();
+}
+
+void CommandsLatencyDialog::timerEvent(QTimerEvent* event) {
+  if (timer_id_ == event->timerId() && auto_refresh_->isChecked()) {
+    refreshClicked();
+  }
+  base_class::timerEvent(event);
+}
+
+void CommandsLatencyDialog::retranslateUi() {
+  auto_refresh_->setText(trAutoRefresh);
+  refresh_button_->setText(trRefresh);
+  reset_button_->setText(trReset);
+  base_class::retranslateUi();
+}
+
+}  // namespace gui
+}  // namespace fastonosql
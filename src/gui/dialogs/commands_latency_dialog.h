@@ -0,0 +1,69 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "gui/dialogs/base_dialog.h"
+
+#include "proxy/proxy_fwd.h"
+
+class QCheckBox;
+class QPushButton;
+
+namespace fastonosql {
+namespace gui {
+
+class CommandsLatencyTableModel;
+class FastoTableView;
+
+// per command latency percentiles measured around driver execute
+class CommandsLatencyDialog : public BaseDialog {
+  Q_OBJECT
+
+ public:
+  typedef BaseDialog base_class;
+  template <typename T, typename... Args>
+  friend T* createDialog(Args&&... args);
+  enum { min_width = 640, min_height = 480, refresh_interval_msec = 1000 };
+
+ private Q_SLOTS:
+  void refreshClicked();
+  void resetClicked();
+
+ protected:
+  explicit CommandsLatencyDialog(const QString& title,
+                                 const QIcon& icon,
+                                 proxy::IServerSPtr server,
+                                 QWidget* parent = Q_NULLPTR);
+
+  void timerEvent(QTimerEvent* event) override;
+  void retranslateUi() override;
+
+ private:
+  QCheckBox* auto_refresh_;
+  QPushButton* refresh_button_;
+  QPushButton* reset_button_;
+  FastoTableView* table_;
+  CommandsLatencyTableModel* model_;
+
+  const proxy::IServerSPtr server_;
+  int timer_id_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
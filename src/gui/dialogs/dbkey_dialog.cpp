@@ -77,6 +77,10 @@ core::NDbKValue DbKeyDialog::key() const {
   return key_;
 }
 
+bool DbKeyDialog::changesCommands(proxy::ValueChangesCommands* commands) const {
+  return editor_->getChangesCommands(commands);
+}
+
 void DbKeyDialog::accept() {
   if (!validateAndApply()) {
     QMessageBox::warning(this, translations::trInvalidInput, translations::trInvalidInput + "!");
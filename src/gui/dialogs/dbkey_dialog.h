@@ -24,6 +24,8 @@
 
 #include "gui/dialogs/base_dialog.h"
 
+#include "proxy/types.h"
+
 namespace fastonosql {
 namespace gui {
 
@@ -38,6 +40,7 @@ class DbKeyDialog : public BaseDialog {
   friend T* createDialog(Args&&... args);
 
   core::NDbKValue key() const;
+  bool changesCommands(proxy::ValueChangesCommands* commands) const;  // only edited rows of collection
 
  public Q_SLOTS:
   void accept() override;
@@ -0,0 +1,316 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/dialogs/hot_keys_dialog.h"
+
+#include <algorithm>
+
+#include <QComboBox>
+#include <QDialogButtonBox>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QSortFilterProxyModel>
+#include <QSpinBox>
+#include <QTabWidget>
+#include <QTimer>
+
+#include "proxy/server/iserver.h"
+
+#include "gui/models/hot_keys_table_model.h"
+#include "gui/views/fasto_table_view.h"
+
+namespace {
+const QString trStart = QObject::tr("Start");
+const QString trStop = QObject::tr("Stop");
+const QString trReset = QObject::tr("Reset");
+const QString trMethod = QObject::tr("Method:");
+const QString trAuto = QObject::tr("Auto");
+const QString trMonitor = QObject::tr("MONITOR sampling");
+const QString trObjectFreq = QObject::tr("OBJECT FREQ (LFU policy)");
+const QString trDuration = QObject::tr("Duration, sec:");
+const QString trSampleRate = QObject::tr("Sample rate, %:");
+const QString trTopK = QObject::tr("Top:");
+const QString trKeys = QObject::tr("Keys");
+const QString trNamespaces = QObject::tr("Namespaces");
+const QString trCommands = QObject::tr("Commands");
+const QString trMonitorStatusTemplate_3S = QObject::tr("MONITOR: %1 commands seen, %2 of %3 sec");
+const QString trObjectFreqStatusTemplate_1S = QObject::tr("OBJECT FREQ: %1 keys scanned");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+HotKeysDialog::HotKeysDialog(const QString& title, const QIcon& icon, proxy::IServerSPtr server, QWidget* parent)
+    : base_class(title, parent),
+      mode_label_(nullptr),
+      mode_(nullptr),
+      duration_label_(nullptr),
+      duration_(nullptr),
+      sample_rate_label_(nullptr),
+      sample_rate_(nullptr),
+      top_k_label_(nullptr),
+      top_k_(nullptr),
+      start_stop_button_(nullptr),
+      reset_button_(nullptr),
+      status_label_(nullptr),
+      tabs_(nullptr),
+      keys_table_(nullptr),
+      namespaces_table_(nullptr),
+      commands_table_(nullptr),
+      keys_model_(nullptr),
+      namespaces_model_(nullptr),
+      commands_model_(nullptr),
+      server_(server),
+      keys_(default_top_k),
+      namespaces_(default_top_k),
+      commands_(default_top_k),
+      used_mode_(proxy::kHotKeysAuto),
+      cursor_(0),
+      elapsed_msec_(0),
+      seen_count_(0),
+      running_(false),
+      in_flight_(false) {
+  CHECK(server_) << "Must be server.";
+  setWindowIcon(icon);
+
+  VERIFY(connect(server.get(), &proxy::IServer::SampleHotKeysStarted, this, &HotKeysDialog::startSampleHotKeys));
+  VERIFY(connect(server.get(), &proxy::IServer::SampleHotKeysFinished, this, &HotKeysDialog::finishSampleHotKeys));
+
+  QHBoxLayout* settings_layout = new QHBoxLayout;
+  mode_label_ = new QLabel;
+  mode_ = new QComboBox;
+  settings_layout->addWidget(mode_label_);
+  settings_layout->addWidget(mode_);
+
+  duration_label_ = new QLabel;
+  duration_ = new QSpinBox;
+  duration_->setRange(1, max_duration_sec);
+  duration_->setValue(default_duration_sec);
+  settings_layout->addWidget(duration_label_);
+  settings_layout->addWidget(duration_);
+
+  sample_rate_label_ = new QLabel;
+  sample_rate_ = new QSpinBox;
+  sample_rate_->setRange(1, proxy::HotKeysSampler::max_sample_rate);
+  sample_rate_->setValue(default_sample_rate);
+  settings_layout->addWidget(sample_rate_label_);
+  settings_layout->addWidget(sample_rate_);
+
+  top_k_label_ = new QLabel;
+  top_k_ = new QSpinBox;
+  top_k_->setRange(1, max_top_k);
+  top_k_->setValue(default_top_k);
+  settings_layout->addWidget(top_k_label_);
+  settings_layout->addWidget(top_k_);
+
+  QHBoxLayout* control_layout = new QHBoxLayout;
+  status_label_ = new QLabel;
+  start_stop_button_ = new QPushButton;
+  VERIFY(connect(start_stop_button_, &QPushButton::clicked, this, &HotKeysDialog::startStopClicked));
+  reset_button_ = new QPushButton;
+  VERIFY(connect(reset_button_, &QPushButton::clicked, this, &HotKeysDialog::resetClicked));
+  control_layout->addWidget(status_label_, 1);
+  control_layout->addWidget(start_stop_button_);
+  control_layout->addWidget(reset_button_);
+
+  keys_model_ = new HotKeysTableModel(HotKeysTableModel::kKeys, this);
+  namespaces_model_ = new HotKeysTableModel(HotKeysTableModel::kNamespaces, this);
+  commands_model_ = new HotKeysTableModel(HotKeysTableModel::kCommands, this);
+  keys_table_ = createTable(keys_model_);
+  namespaces_table_ = createTable(namespaces_model_);
+  commands_table_ = createTable(commands_model_);
+  tabs_ = new QTabWidget;
+  tabs_->addTab(keys_table_, QString());
+  tabs_->addTab(namespaces_table_, QString());
+  tabs_->addTab(commands_table_, QString());
+
+  QDialogButtonBox* button_box = new QDialogButtonBox(QDialogButtonBox::Ok);
+  button_box->setOrientation(Qt::Horizontal);
+  VERIFY(connect(button_box, &QDialogButtonBox::accepted, this, &HotKeysDialog::accept));
+
+  QVBoxLayout* main_layout = new QVBoxLayout;
+  main_layout->addLayout(settings_layout);
+  main_layout->addLayout(control_layout);
+  main_layout->addWidget(tabs_);
+  main_layout->addWidget(button_box);
+  setLayout(main_layout);
+  setMinimumSize(QSize(min_width, min_height));
+
+  updateControls();
+}
+
+void HotKeysDialog::startSampleHotKeys(const proxy::events_info::SampleHotKeysRequest& req) {
+  UNUSED(req);
+}
+
+void HotKeysDialog::finishSampleHotKeys(const proxy::events_info::SampleHotKeysResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  in_flight_ = false;
+  common::Error err = res.errorInfo();
+  if (err) {
+    running_ = false;
+    updateControls();
+    return;
+  }
+
+  used_mode_ = res.used_mode;
+  const bool monitor = used_mode_ == proxy::kHotKeysMonitor;
+  for (const auto& key : res.keys) {
+    keys_.Add(key.first, key.second);
+  }
+  for (const auto& ns : res.namespaces) {
+    namespaces_.Add(ns.first, ns.second);
+  }
+  for (const auto& command : res.commands) {
+    commands_.Add(command.first, command.second);
+  }
+
+  // sampled counts are scaled back, OBJECT FREQ values are shown as is
+  const double scale = monitor ? static_cast<double>(proxy::HotKeysSampler::max_sample_rate) / res.sample_rate : 1;
+  const common::time64_t window_msec = monitor ? res.elapsed_msec : 0;
+  keys_model_->setHitters(keys_.GetTop(), res.keys, scale, window_msec);
+  namespaces_model_->setHitters(namespaces_.GetTop(), res.namespaces, scale, window_msec);
+  commands_model_->setHitters(commands_.GetTop(), res.commands, scale, window_msec);
+
+  seen_count_ += res.seen_count;
+  if (monitor) {
+    elapsed_msec_ += res.elapsed_msec;
+    if (elapsed_msec_ >= static_cast<common::time64_t>(duration_->value()) * 1000) {
+      running_ = false;
+    }
+  } else {
+    cursor_ = res.cursor_out;
+    if (cursor_ == 0) {
+      running_ = false;
+    }
+  }
+
+  if (running_) {
+    QTimer::singleShot(0, this, &HotKeysDialog::sampleNextWindow);
+  }
+  updateControls();
+}
+
+void HotKeysDialog::startStopClicked() {
+  if (running_) {
+    running_ = false;
+    updateControls();
+    return;
+  }
+
+  const size_t top_k = top_k_->value();
+  keys_ = proxy::HeavyHitters(top_k);
+  namespaces_ = proxy::HeavyHitters(top_k);
+  commands_ = proxy::HeavyHitters(top_k);
+  used_mode_ = static_cast<proxy::HotKeysSamplingMode>(mode_->currentIndex());
+  cursor_ = 0;
+  elapsed_msec_ = 0;
+  seen_count_ = 0;
+  running_ = true;
+  sampleNextWindow();
+  updateControls();
+}
+
+void HotKeysDialog::resetClicked() {
+  keys_.Reset();
+  namespaces_.Reset();
+  commands_.Reset();
+  keys_model_->clear();
+  namespaces_model_->clear();
+  commands_model_->clear();
+  used_mode_ = proxy::kHotKeysAuto;
+  cursor_ = 0;
+  elapsed_msec_ = 0;
+  seen_count_ = 0;
+  updateControls();
+}
+
+void HotKeysDialog::sampleNextWindow() {
+  if (!running_ || in_flight_) {
+    return;
+  }
+
+  in_flight_ = true;
+  const common::time64_t remaining = static_cast<common::time64_t>(duration_->value()) * 1000 - elapsed_msec_;
+  const common::time64_t window = std::min(static_cast<common::time64_t>(slice_msec), remaining);
+  proxy::events_info::SampleHotKeysRequest req(this, used_mode_, window, sample_rate_->value(), top_k_->value(),
+                                               object_freq_keys_per_batch, cursor_);
+  server_->SampleHotKeys(req);
+}
+
+void HotKeysDialog::retranslateUi() {
+  mode_label_->setText(trMethod);
+  const int mode_index = mode_->currentIndex();
+  mode_->clear();
+  mode_->addItem(trAuto);        // proxy::kHotKeysAuto
+  mode_->addItem(trMonitor);     // proxy::kHotKeysMonitor
+  mode_->addItem(trObjectFreq);  // proxy::kHotKeysObjectFreq
+  mode_->setCurrentIndex(mode_index < 0 ? 0 : mode_index);
+  duration_label_->setText(trDuration);
+  sample_rate_label_->setText(trSampleRate);
+  top_k_label_->setText(trTopK);
+  reset_button_->setText(trReset);
+  tabs_->setTabText(tabs_->indexOf(keys_table_), trKeys);
+  tabs_->setTabText(tabs_->indexOf(namespaces_table_), trNamespaces);
+  tabs_->setTabText(tabs_->indexOf(commands_table_), trCommands);
+  updateControls();
+  base_class::retranslateUi();
+}
+
+FastoTableView* HotKeysDialog::createTable(HotKeysTableModel* model) {
+  QSortFilterProxyModel* proxy_model = new QSortFilterProxyModel(this);
+  proxy_model->setSourceModel(model);
+  proxy_model->setDynamicSortFilter(true);
+
+  FastoTableView* table = new FastoTableView;
+  table->setSortingEnabled(true);
+  table->setSelectionBehavior(QAbstractItemView::SelectRows);
+  table->setSelectionMode(QAbstractItemView::SingleSelection);
+  table->sortByColumn(HotKeysTableModel::kHits, Qt::DescendingOrder);
+  table->setModel(proxy_model);
+  return table;
+}
+
+void HotKeysDialog::updateControls() {
+  start_stop_button_->setText(running_ ? trStop : trStart);
+  mode_->setEnabled(!running_);
+  duration_->setEnabled(!running_);
+  sample_rate_->setEnabled(!running_);
+  top_k_->setEnabled(!running_);
+  reset_button_->setEnabled(!running_);
+
+  // ops/sec is known only for MONITOR windows, commands aren't visible through OBJECT FREQ
+  const bool object_freq = used_mode_ == proxy::kHotKeysObjectFreq;
+  keys_table_->setColumnHidden(HotKeysTableModel::kOpsPerSec, object_freq);
+  namespaces_table_->setColumnHidden(HotKeysTableModel::kOpsPerSec, object_freq);
+  tabs_->setTabEnabled(tabs_->indexOf(commands_table_), !object_freq);
+
+  if (object_freq) {
+    status_label_->setText(trObjectFreqStatusTemplate_1S.arg(seen_count_));
+  } else {
+    status_label_->setText(
+        trMonitorStatusTemplate_3S.arg(seen_count_).arg(elapsed_msec_ / 1000).arg(duration_->value()));
+  }
+}
+
+}  // namespace gui
+}  // namespace fastonosql
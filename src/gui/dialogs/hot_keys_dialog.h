@@ -0,0 +1,115 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <fastonosql/core/types.h>
+
+#include "gui/dialogs/base_dialog.h"
+
+#include "proxy/heavy_hitters.h"
+#include "proxy/hot_keys_sampler.h"
+#include "proxy/proxy_fwd.h"
+
+class QComboBox;
+class QLabel;
+class QPushButton;
+class QSpinBox;
+class QTabWidget;
+
+namespace fastonosql {
+namespace proxy {
+namespace events_info {
+struct SampleHotKeysRequest;
+struct SampleHotKeysResponse;
+}  // namespace events_info
+}  // namespace proxy
+namespace gui {
+class FastoTableView;
+class HotKeysTableModel;
+
+// samples server load in short windows and accumulates hot keys, namespaces and commands
+class HotKeysDialog : public BaseDialog {
+  Q_OBJECT
+
+ public:
+  typedef BaseDialog base_class;
+  template <typename T, typename... Args>
+  friend T* createDialog(Args&&... args);
+  enum {
+    min_width = 800,
+    min_height = 600,
+    slice_msec = 1000,
+    max_duration_sec = 3600,
+    default_duration_sec = 30,
+    default_sample_rate = 10,
+    max_top_k = 1000,
+    default_top_k = 20,
+    object_freq_keys_per_batch = 500
+  };
+
+ private Q_SLOTS:
+  void startSampleHotKeys(const proxy::events_info::SampleHotKeysRequest& req);
+  void finishSampleHotKeys(const proxy::events_info::SampleHotKeysResponse& res);
+
+  void startStopClicked();
+  void resetClicked();
+  void sampleNextWindow();
+
+ protected:
+  explicit HotKeysDialog(const QString& title, const QIcon& icon, proxy::IServerSPtr server, QWidget* parent = Q_NULLPTR);
+
+  void retranslateUi() override;
+
+ private:
+  FastoTableView* createTable(HotKeysTableModel* model);
+  void updateControls();
+
+  QLabel* mode_label_;
+  QComboBox* mode_;
+  QLabel* duration_label_;
+  QSpinBox* duration_;
+  QLabel* sample_rate_label_;
+  QSpinBox* sample_rate_;
+  QLabel* top_k_label_;
+  QSpinBox* top_k_;
+  QPushButton* start_stop_button_;
+  QPushButton* reset_button_;
+  QLabel* status_label_;
+  QTabWidget* tabs_;
+  FastoTableView* keys_table_;
+  FastoTableView* namespaces_table_;
+  FastoTableView* commands_table_;
+  HotKeysTableModel* keys_model_;
+  HotKeysTableModel* namespaces_model_;
+  HotKeysTableModel* commands_model_;
+  proxy::IServerSPtr server_;
+
+  proxy::HeavyHitters keys_;
+  proxy::HeavyHitters namespaces_;
+  proxy::HeavyHitters commands_;
+  proxy::HotKeysSamplingMode used_mode_;
+  core::cursor_t cursor_;
+  common::time64_t elapsed_msec_;
+  proxy::HotKeysSampler::count_t seen_count_;
+  bool running_;
+  bool in_flight_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,251 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "gui/dialogs/keys_scan_dialog.h"
+
+#include <QDialogButtonBox>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QTimer>
+
+#include <common/qt/convert2string.h>
+
+#include "proxy/database/idatabase.h"
+#include "proxy/server/iserver.h"
+
+namespace {
+const QString trStart = QObject::tr("Start");
+const QString trPause = QObject::tr("Pause");
+const QString trResume = QObject::tr("Resume");
+const QString trReset = QObject::tr("Reset");
+const QString trKeysPerBatch = QObject::tr("Keys per batch:");
+const QString trThrottle = QObject::tr("Delay between batches, msec:");
+const QString trProgressTemplate_2S = QObject::tr("Scanned %1 of %2 keys");
+const QString trFinishedTemplate_1S = QObject::tr("Finished, scanned %1 keys");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+KeysScanDialog::KeysScanDialog(const QString& title,
+                               const QIcon& icon,
+                               proxy::IDatabaseSPtr db,
+                               int throttle_msec,
+                               QWidget* parent)
+    : base_class(title, parent),
+      pattern_edit_(nullptr),
+      options_layout_(nullptr),
+      scan_options_(),
+      batch_label_(nullptr),
+      batch_(nullptr),
+      throttle_label_(nullptr),
+      throttle_(nullptr),
+      start_pause_button_(nullptr),
+      reset_button_(nullptr),
+      progress_label_(nullptr),
+      results_layout_(nullptr),
+      db_(db),
+      cursor_(0),
+      scanned_keys_(0),
+      db_keys_count_(0),
+      running_(false),
+      in_flight_(false),
+      finished_(false) {
+  CHECK(db_) << "Must be database.";
+  setWindowIcon(icon);
+
+  proxy::IServerSPtr server = db_->GetServer();
+  VERIFY(connect(server.get(), &proxy::IServer::LoadKeysStatisticsStarted, this,
+                 &KeysScanDialog::startLoadKeysStatistics));
+  VERIFY(connect(server.get(), &proxy::IServer::LoadKeysStatisticsFinished, this,
+                 &KeysScanDialog::finishLoadKeysStatistics));
+
+  QHBoxLayout* scan_layout = new QHBoxLayout;
+  pattern_edit_ = new QLineEdit;
+  pattern_edit_->setText(ALL_KEYS_PATTERNS);
+  scan_layout->addWidget(pattern_edit_);
+
+  options_layout_ = new QHBoxLayout;
+  scan_layout->addLayout(options_layout_);
+
+  batch_label_ = new QLabel;
+  batch_ = new QSpinBox;
+  batch_->setRange(min_keys_per_batch, max_keys_per_batch);
+  batch_->setSingleStep(min_keys_per_batch);
+  batch_->setValue(default_keys_per_batch);
+  scan_layout->addWidget(batch_label_);
+  scan_layout->addWidget(batch_);
+
+  throttle_label_ = new QLabel;
+  throttle_ = new QSpinBox;
+  throttle_->setRange(0, max_throttle_msec);
+  throttle_->setValue(throttle_msec);
+  scan_layout->addWidget(throttle_label_);
+  scan_layout->addWidget(throttle_);
+
+  QHBoxLayout* control_layout = new QHBoxLayout;
+  progress_label_ = new QLabel;
+  start_pause_button_ = new QPushButton;
+  VERIFY(connect(start_pause_button_, &QPushButton::clicked, this, &KeysScanDialog::startPauseClicked));
+  reset_button_ = new QPushButton;
+  VERIFY(connect(reset_button_, &QPushButton::clicked, this, &KeysScanDialog::resetClicked));
+  control_layout->addWidget(progress_label_, 1);
+  control_layout->addWidget(start_pause_button_);
+  control_layout->addWidget(reset_button_);
+
+  results_layout_ = new QVBoxLayout;
+
+  QDialogButtonBox* button_box = new QDialogButtonBox(QDialogButtonBox::Ok);
+  button_box->setOrientation(Qt::Horizontal);
+  VERIFY(connect(button_box, &QDialogButtonBox::accepted, this, &KeysScanDialog::accept));
+
+  QVBoxLayout* main_layout = new QVBoxLayout;
+  main_layout->addLayout(scan_layout);
+  main_layout->addLayout(control_layout);
+  main_layout->addLayout(results_layout_, 1);
+  main_layout->addWidget(button_box);
+  setLayout(main_layout);
+  setMinimumSize(QSize(min_width, min_height));
+}
+
+proxy::IDatabaseSPtr KeysScanDialog::db() const {
+  return db_;
+}
+
+void KeysScanDialog::addScanOption(QLabel* label, QWidget* option) {
+  options_layout_->addWidget(label);
+  options_layout_->addWidget(option);
+  scan_options_.push_back(option);
+}
+
+void KeysScanDialog::setResultsView(QWidget* view) {
+  results_layout_->addWidget(view);
+}
+
+void KeysScanDialog::startScan() {}
+
+void KeysScanDialog::startLoadKeysStatistics(const proxy::events_info::LoadKeysStatisticsRequest& req) {
+  UNUSED(req);
+}
+
+void KeysScanDialog::finishLoadKeysStatistics(const proxy::events_info::LoadKeysStatisticsResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  in_flight_ = false;
+  common::Error err = res.errorInfo();
+  if (err) {
+    running_ = false;
+    updateControls();
+    return;
+  }
+
+  addKeysStatistics(res.keys);
+  cursor_ = res.cursor_out;
+  scanned_keys_ += res.keys.size();
+  db_keys_count_ = res.db_keys_count;
+  if (cursor_ == 0) {
+    finished_ = true;
+    running_ = false;
+  }
+
+  if (running_) {
+    QTimer::singleShot(throttle_->value(), this, &KeysScanDialog::loadNextBatch);
+  }
+  updateControls();
+}
+
+void KeysScanDialog::startPauseClicked() {
+  if (running_) {  // batch in flight finishes, cursor kept for resume
+    running_ = false;
+    updateControls();
+    return;
+  }
+
+  if (scanned_keys_ == 0 && cursor_ == 0 && !in_flight_) {
+    startScan();
+  }
+  running_ = true;
+  loadNextBatch();
+  updateControls();
+}
+
+void KeysScanDialog::resetClicked() {
+  if (in_flight_) {  // late response would refill results and restore old cursor
+    return;
+  }
+
+  running_ = false;
+  finished_ = false;
+  cursor_ = 0;
+  scanned_keys_ = 0;
+  db_keys_count_ = 0;
+  clearResults();
+  updateControls();
+}
+
+void KeysScanDialog::loadNextBatch() {
+  if (!running_ || in_flight_) {
+    return;
+  }
+
+  in_flight_ = true;
+  proxy::events_info::LoadKeysStatisticsRequest req(this, db_->GetInfo(),
+                                                    common::ConvertToString(pattern_edit_->text()), batch_->value(),
+                                                    cursor_);
+  db_->GetServer()->LoadKeysStatistics(req);
+}
+
+void KeysScanDialog::retranslateUi() {
+  batch_label_->setText(trKeysPerBatch);
+  throttle_label_->setText(trThrottle);
+  reset_button_->setText(trReset);
+  updateControls();
+  base_class::retranslateUi();
+}
+
+void KeysScanDialog::updateControls() {
+  const bool started = scanned_keys_ != 0 || cursor_ != 0 || running_ || in_flight_;
+  if (running_) {
+    start_pause_button_->setText(trPause);
+  } else {
+    start_pause_button_->setText(started && !finished_ ? trResume : trStart);
+  }
+  start_pause_button_->setEnabled(!finished_);
+
+  // scan parameters are part of cursor state, change only after reset
+  pattern_edit_->setEnabled(!started);
+  for (QWidget* option : scan_options_) {
+    option->setEnabled(!started);
+  }
+  reset_button_->setEnabled(!running_ && !in_flight_);
+
+  if (finished_) {
+    progress_label_->setText(trFinishedTemplate_1S.arg(scanned_keys_));
+  } else {
+    progress_label_->setText(trProgressTemplate_2S.arg(scanned_keys_).arg(db_keys_count_));
+  }
+}
+
+}  // namespace gui
+}  // namespace fastonosql
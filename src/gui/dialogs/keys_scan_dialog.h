@@ -0,0 +1,115 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <vector>
+
+#include <fastonosql/core/types.h>
+
+#include "gui/dialogs/base_dialog.h"
+
+#include "proxy/db_key_stat.h"
+#include "proxy/proxy_fwd.h"
+
+class QHBoxLayout;
+class QLabel;
+class QLineEdit;
+class QPushButton;
+class QSpinBox;
+class QVBoxLayout;
+
+namespace fastonosql {
+namespace proxy {
+namespace events_info {
+struct LoadKeysStatisticsRequest;
+struct LoadKeysStatisticsResponse;
+}  // namespace events_info
+}  // namespace proxy
+namespace gui {
+
+// scans database page by page with key statistics batches, throttled, can be paused and resumed
+// from the last cursor, subclasses collect statistics of scanned keys into their results view
+class KeysScanDialog : public BaseDialog {
+  Q_OBJECT
+
+ public:
+  typedef BaseDialog base_class;
+  template <typename T, typename... Args>
+  friend T* createDialog(Args&&... args);
+  enum {
+    min_width = 800,
+    min_height = 600,
+    min_keys_per_batch = 10,
+    max_keys_per_batch = 10000,
+    default_keys_per_batch = 500,
+    max_throttle_msec = 10000
+  };
+
+ private Q_SLOTS:
+  void startLoadKeysStatistics(const proxy::events_info::LoadKeysStatisticsRequest& req);
+  void finishLoadKeysStatistics(const proxy::events_info::LoadKeysStatisticsResponse& res);
+
+  void startPauseClicked();
+  void resetClicked();
+  void loadNextBatch();
+
+ protected:
+  KeysScanDialog(const QString& title,
+                 const QIcon& icon,
+                 proxy::IDatabaseSPtr db,
+                 int throttle_msec,
+                 QWidget* parent = Q_NULLPTR);
+
+  proxy::IDatabaseSPtr db() const;
+  void addScanOption(QLabel* label, QWidget* option);  // part of scan state, locked until reset
+  void setResultsView(QWidget* view);
+
+  virtual void startScan();  // before first batch of new scan
+  virtual void clearResults() = 0;
+  virtual void addKeysStatistics(const std::vector<proxy::NDbKeyStat>& keys) = 0;
+
+  void retranslateUi() override;
+
+ private:
+  void updateControls();
+
+  QLineEdit* pattern_edit_;
+  QHBoxLayout* options_layout_;
+  std::vector<QWidget*> scan_options_;
+  QLabel* batch_label_;
+  QSpinBox* batch_;
+  QLabel* throttle_label_;
+  QSpinBox* throttle_;
+  QPushButton* start_pause_button_;
+  QPushButton* reset_button_;
+  QLabel* progress_label_;
+  QVBoxLayout* results_layout_;
+  proxy::IDatabaseSPtr db_;
+
+  core::cursor_t cursor_;
+  size_t scanned_keys_;
+  size_t db_keys_count_;
+  bool running_;
+  bool in_flight_;
+  bool finished_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,90 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "gui/dialogs/keyspace_analyzer_dialog.h"
+
+#include <string>
+
+#include <QLabel>
+#include <QSortFilterProxyModel>
+#include <QSpinBox>
+
+#include "proxy/database/idatabase.h"
+#include "proxy/server/iserver.h"
+
+#include "gui/models/keyspace_stat_table_model.h"
+#include "gui/views/fasto_table_view.h"
+
+namespace {
+const QString trNsDepth = QObject::tr("Namespace depth:");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+KeyspaceAnalyzerDialog::KeyspaceAnalyzerDialog(const QString& title,
+                                               const QIcon& icon,
+                                               proxy::IDatabaseSPtr db,
+                                               QWidget* parent)
+    : base_class(title, icon, db, default_throttle_msec, parent),
+      ns_depth_label_(nullptr),
+      ns_depth_(nullptr),
+      stats_table_(nullptr),
+      stats_model_(nullptr),
+      proxy_model_(nullptr) {
+  ns_depth_label_ = new QLabel;
+  ns_depth_ = new QSpinBox;
+  ns_depth_->setRange(0, max_ns_depth);
+  ns_depth_->setValue(1);
+  addScanOption(ns_depth_label_, ns_depth_);
+
+  stats_model_ = new KeyspaceStatTableModel(this);
+  proxy_model_ = new QSortFilterProxyModel(this);
+  proxy_model_->setSourceModel(stats_model_);
+  proxy_model_->setDynamicSortFilter(true);
+
+  stats_table_ = new FastoTableView;
+  stats_table_->setSortingEnabled(true);
+  stats_table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+  stats_table_->setSelectionMode(QAbstractItemView::SingleSelection);
+  stats_table_->sortByColumn(KeyspaceStatTableModel::kTotalBytes, Qt::DescendingOrder);
+  stats_table_->setModel(proxy_model_);
+  setResultsView(stats_table_);
+}
+
+void KeyspaceAnalyzerDialog::clearResults() {
+  stats_model_->clear();
+}
+
+void KeyspaceAnalyzerDialog::addKeysStatistics(const std::vector<proxy::NDbKeyStat>& keys) {
+  proxy::IServerSPtr server = db()->GetServer();
+  const std::string ns_separator = server->GetNsSeparator();
+  const size_t ns_depth = ns_depth_->value();
+  for (const proxy::NDbKeyStat& stat : keys) {
+    stats_model_->addKeyStat(stat, ns_separator, ns_depth);
+  }
+}
+
+void KeyspaceAnalyzerDialog::retranslateUi() {
+  ns_depth_label_->setText(trNsDepth);
+  base_class::retranslateUi();
+}
+
+}  // namespace gui
+}  // namespace fastonosql
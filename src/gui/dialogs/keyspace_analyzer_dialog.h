@@ -0,0 +1,66 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <vector>
+
+#include "gui/dialogs/keys_scan_dialog.h"
+
+class QLabel;
+class QSortFilterProxyModel;
+class QSpinBox;
+
+namespace fastonosql {
+namespace gui {
+class FastoTableView;
+class KeyspaceStatTableModel;
+
+// scans database page by page and aggregates MEMORY USAGE/TTL per namespace,
+// can be paused and resumed from the last cursor
+class KeyspaceAnalyzerDialog : public KeysScanDialog {
+  Q_OBJECT
+
+ public:
+  typedef KeysScanDialog base_class;
+  template <typename T, typename... Args>
+  friend T* createDialog(Args&&... args);
+  enum { default_throttle_msec = 100, max_ns_depth = 16 };
+
+ protected:
+  explicit KeyspaceAnalyzerDialog(const QString& title,
+                                  const QIcon& icon,
+                                  proxy::IDatabaseSPtr db,
+                                  QWidget* parent = Q_NULLPTR);
+
+  void clearResults() override;
+  void addKeysStatistics(const std::vector<proxy::NDbKeyStat>& keys) override;
+
+  void retranslateUi() override;
+
+ private:
+  QLabel* ns_depth_label_;
+  QSpinBox* ns_depth_;
+  FastoTableView* stats_table_;
+  KeyspaceStatTableModel* stats_model_;
+  QSortFilterProxyModel* proxy_model_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
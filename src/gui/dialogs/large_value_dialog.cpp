@@ -0,0 +1,302 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/dialogs/large_value_dialog.h"
+
+#include <string>
+
+#include <QDialogButtonBox>
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QMessageBox>
+#include <QPlainTextEdit>
+#include <QProgressBar>
+#include <QPushButton>
+#include <QScrollBar>
+#include <QWheelEvent>
+
+#include <common/qt/convert2string.h>
+
+#include <fastonosql/core/types.h>
+
+#include "proxy/database/idatabase.h"
+#include "proxy/server/iserver.h"
+
+#include "gui/fast_codecs.h"
+
+#include "translations/global.h"
+
+namespace {
+const QString trSaveToFile = QObject::tr("Save full value to file...");
+const QString trSaveValue = QObject::tr("Save value");
+const QString trAllFiles = QObject::tr("All files (*.*)");
+const QString trLoading = QObject::tr("Loading...");
+const QString trRangeTemplate_3S = QObject::tr("Bytes %1 - %2 of %3");
+const QString trRangeBinaryTemplate_3S = QObject::tr("Bytes %1 - %2 of %3 (binary data shown as hex)");
+const QString trSavedTemplate_2S = QObject::tr("Saved %1 bytes to %2");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+LargeValueDialog::LargeValueDialog(const QString& title,
+                                   const QIcon& icon,
+                                   proxy::IDatabaseSPtr db,
+                                   const core::NKey& key,
+                                   uint64_t value_size,
+                                   QWidget* parent)
+    : base_class(title, parent),
+      range_label_(nullptr),
+      page_edit_(nullptr),
+      pages_bar_(nullptr),
+      save_button_(nullptr),
+      save_progress_(nullptr),
+      db_(db),
+      key_(key),
+      value_size_(value_size),
+      shown_page_(-1),
+      loading_page_(-1),
+      wanted_page_(-1),
+      scroll_to_end_(false),
+      saving_(false) {
+  CHECK(db_) << "Must be database.";
+  setWindowIcon(icon);
+
+  proxy::IServerSPtr server = db_->GetServer();
+  VERIFY(connect(server.get(), &proxy::IServer::LoadValueRangeFinished, this,
+                 &LargeValueDialog::finishLoadValueRange));
+  VERIFY(connect(server.get(), &proxy::IServer::SaveValueToFileFinished, this,
+                 &LargeValueDialog::finishSaveValueToFile));
+  VERIFY(connect(server.get(), &proxy::IServer::ProgressChanged, this, &LargeValueDialog::changeProgress));
+
+  range_label_ = new QLabel;
+  range_label_->setTextInteractionFlags(Qt::TextSelectableByMouse);
+
+  page_edit_ = new QPlainTextEdit;
+  page_edit_->setReadOnly(true);
+  page_edit_->viewport()->installEventFilter(this);
+
+  pages_bar_ = new QScrollBar(Qt::Vertical);
+  pages_bar_->setRange(0, pagesCount() - 1);
+  pages_bar_->setPageStep(1);
+  pages_bar_->setTracking(false);  // page is read when slider is released
+  VERIFY(connect(pages_bar_, &QScrollBar::valueChanged, this, &LargeValueDialog::pageChange));
+
+  QHBoxLayout* page_layout = new QHBoxLayout;
+  page_layout->addWidget(page_edit_);
+  page_layout->addWidget(pages_bar_);
+
+  save_button_ = new QPushButton;
+  VERIFY(connect(save_button_, &QPushButton::clicked, this, &LargeValueDialog::saveClicked));
+  save_progress_ = new QProgressBar;
+  save_progress_->setRange(0, 100);
+  QHBoxLayout* save_layout = new QHBoxLayout;
+  save_layout->addWidget(save_button_);
+  save_layout->addWidget(save_progress_);
+
+  QDialogButtonBox* button_box = new QDialogButtonBox(QDialogButtonBox::Ok);
+  button_box->setOrientation(Qt::Horizontal);
+  VERIFY(connect(button_box, &QDialogButtonBox::accepted, this, &LargeValueDialog::accept));
+
+  QVBoxLayout* main_layout = new QVBoxLayout;
+  main_layout->addWidget(range_label_);
+  main_layout->addLayout(page_layout);
+  main_layout->addLayout(save_layout);
+  main_layout->addWidget(button_box);
+  setLayout(main_layout);
+  setMinimumSize(QSize(min_width, min_height));
+
+  updateControls();
+  loadPage(0);
+}
+
+LargeValueDialog::~LargeValueDialog() {
+  if (saving_) {
+    db_->GetServer()->StopCurrentEvent();
+  }
+}
+
+void LargeValueDialog::finishLoadValueRange(const proxy::events_info::LoadValueRangeResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  const int page = loading_page_;
+  loading_page_ = -1;
+  common::Error err = res.errorInfo();
+  if (err) {
+    QString qerror;
+    common::ConvertFromString(err->GetDescription(), &qerror);
+    page_edit_->setPlainText(qerror);
+    loadWantedPage();
+    updateControls();
+    return;
+  }
+
+  // value could be changed after dialog was opened
+  value_size_ = res.value_size;
+  pages_bar_->blockSignals(true);
+  pages_bar_->setRange(0, pagesCount() - 1);
+  pages_bar_->setValue(page);
+  pages_bar_->blockSignals(false);
+  shown_page_ = page;
+
+  const core::readable_string_t data = GEN_READABLE_STRING_SIZE(res.data.data(), res.data.size());
+  const bool is_binary = core::detail::is_binary_data(data);
+  if (is_binary) {
+    std::string hexed(res.data.size() * 4, 0);
+    hex_encode(reinterpret_cast<const unsigned char*>(res.data.data()), res.data.size(), true, &hexed[0]);
+    page_edit_->setPlainText(QString::fromLatin1(hexed.data(), static_cast<int>(hexed.size())));
+  } else {
+    // utf-8 char cut by page border is shown as replacement char
+    page_edit_->setPlainText(QString::fromUtf8(res.data.data(), static_cast<int>(res.data.size())));
+  }
+
+  QScrollBar* text_bar = page_edit_->verticalScrollBar();
+  text_bar->setValue(scroll_to_end_ ? text_bar->maximum() : text_bar->minimum());
+  scroll_to_end_ = false;
+
+  const uint64_t first = res.offset;
+  const uint64_t last = res.data.empty() ? first : first + res.data.size() - 1;
+  range_label_->setText((is_binary ? trRangeBinaryTemplate_3S : trRangeTemplate_3S)
+                            .arg(first)
+                            .arg(last)
+                            .arg(value_size_));
+
+  loadWantedPage();
+  updateControls();
+}
+
+void LargeValueDialog::finishSaveValueToFile(const proxy::events_info::SaveValueToFileResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  saving_ = false;
+  loadWantedPage();
+  updateControls();
+  common::Error err = res.errorInfo();
+  if (err) {
+    QString qerror;
+    common::ConvertFromString(err->GetDescription(), &qerror);
+    QMessageBox::critical(this, translations::trError, qerror);
+    return;
+  }
+
+  QString qpath;
+  common::ConvertFromString(res.path, &qpath);
+  QMessageBox::information(this, trSaveValue, trSavedTemplate_2S.arg(res.written).arg(qpath));
+}
+
+void LargeValueDialog::changeProgress(const proxy::events_info::ProgressInfoResponse& res) {
+  if (saving_) {
+    save_progress_->setValue(res.progress);
+  }
+}
+
+void LargeValueDialog::pageChange(int page) {
+  loadPage(page);
+}
+
+void LargeValueDialog::saveClicked() {
+  if (saving_) {
+    db_->GetServer()->StopCurrentEvent();
+    return;
+  }
+
+  const QString filepath = QFileDialog::getSaveFileName(this, trSaveValue, QString(), trAllFiles);
+  if (filepath.isEmpty()) {
+    return;
+  }
+
+  saving_ = true;
+  save_progress_->setValue(0);
+  proxy::events_info::SaveValueToFileRequest req(this, db_->GetInfo(), key_, common::ConvertToString(filepath),
+                                                 save_chunk_size);
+  db_->GetServer()->SaveValueToFile(req);
+  updateControls();
+}
+
+bool LargeValueDialog::eventFilter(QObject* object, QEvent* event) {
+  if (object == page_edit_->viewport() && event->type() == QEvent::Wheel) {
+    QWheelEvent* wheel = static_cast<QWheelEvent*>(event);
+    const QScrollBar* text_bar = page_edit_->verticalScrollBar();
+    const int delta = wheel->angleDelta().y();
+    const int page = pages_bar_->value();
+    if (delta < 0 && text_bar->value() == text_bar->maximum() && page + 1 < pagesCount()) {
+      pages_bar_->setValue(page + 1);
+      return true;
+    }
+
+    if (delta > 0 && text_bar->value() == text_bar->minimum() && page > 0) {
+      scroll_to_end_ = true;
+      pages_bar_->setValue(page - 1);
+      return true;
+    }
+  }
+
+  return base_class::eventFilter(object, event);
+}
+
+void LargeValueDialog::retranslateUi() {
+  updateControls();
+  base_class::retranslateUi();
+}
+
+int LargeValueDialog::pagesCount() const {
+  const uint64_t pages = (value_size_ + page_size - 1) / page_size;
+  return pages ? static_cast<int>(pages) : 1;
+}
+
+void LargeValueDialog::loadPage(int page) {
+  // saving holds driver, pages are read after it
+  if (loading_page_ != -1 || saving_) {
+    wanted_page_ = page;
+    return;
+  }
+
+  loading_page_ = page;
+  if (shown_page_ == -1) {
+    page_edit_->setPlainText(trLoading);
+  }
+  proxy::events_info::LoadValueRangeRequest req(this, db_->GetInfo(), key_, static_cast<uint64_t>(page) * page_size,
+                                                page_size);
+  db_->GetServer()->LoadValueRange(req);
+}
+
+void LargeValueDialog::loadWantedPage() {
+  if (wanted_page_ == -1) {
+    return;
+  }
+
+  const int wanted = wanted_page_;
+  wanted_page_ = -1;
+  if (wanted != shown_page_) {
+    loadPage(wanted);
+  }
+}
+
+void LargeValueDialog::updateControls() {
+  save_button_->setText(saving_ ? translations::trStop : trSaveToFile);
+  save_progress_->setVisible(saving_);
+  pages_bar_->setEnabled(!saving_);
+}
+
+}  // namespace gui
+}  // namespace fastonosql
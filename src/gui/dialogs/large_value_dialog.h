@@ -0,0 +1,104 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <fastonosql/core/db_key.h>
+
+#include "gui/dialogs/base_dialog.h"
+
+#include "proxy/proxy_fwd.h"
+
+class QLabel;
+class QPlainTextEdit;
+class QProgressBar;
+class QPushButton;
+class QScrollBar;
+
+namespace fastonosql {
+namespace proxy {
+namespace events_info {
+struct LoadValueRangeResponse;
+struct SaveValueToFileResponse;
+struct ProgressInfoResponse;
+}  // namespace events_info
+}  // namespace proxy
+namespace gui {
+
+// string value too big for GET: only visible page is read by GETRANGE, wheel over the page edges
+// or pages scroll bar reads neighbour pages, saving to file streams value by chunks in driver
+class LargeValueDialog : public BaseDialog {
+  Q_OBJECT
+
+ public:
+  typedef BaseDialog base_class;
+  template <typename T, typename... Args>
+  friend T* createDialog(Args&&... args);
+  enum {
+    min_width = 800,
+    min_height = 600,
+    page_size = 64 * 1024,
+    save_chunk_size = 1024 * 1024,
+    min_value_size = 16 * 1024 * 1024  // smaller values are loaded whole
+  };
+
+  ~LargeValueDialog() override;
+
+ private Q_SLOTS:
+  void finishLoadValueRange(const proxy::events_info::LoadValueRangeResponse& res);
+  void finishSaveValueToFile(const proxy::events_info::SaveValueToFileResponse& res);
+  void changeProgress(const proxy::events_info::ProgressInfoResponse& res);
+
+  void pageChange(int page);
+  void saveClicked();
+
+ protected:
+  explicit LargeValueDialog(const QString& title,
+                            const QIcon& icon,
+                            proxy::IDatabaseSPtr db,
+                            const core::NKey& key,
+                            uint64_t value_size,
+                            QWidget* parent = Q_NULLPTR);
+
+  bool eventFilter(QObject* object, QEvent* event) override;
+  void retranslateUi() override;
+
+ private:
+  int pagesCount() const;
+  void loadPage(int page);
+  void loadWantedPage();
+  void updateControls();
+
+  QLabel* range_label_;
+  QPlainTextEdit* page_edit_;
+  QScrollBar* pages_bar_;
+  QPushButton* save_button_;
+  QProgressBar* save_progress_;
+  proxy::IDatabaseSPtr db_;
+  const core::NKey key_;
+
+  uint64_t value_size_;
+  int shown_page_;
+  int loading_page_;  // -1 if nothing is loading
+  int wanted_page_;   // requested while other page was loading
+  bool scroll_to_end_;
+  bool saving_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
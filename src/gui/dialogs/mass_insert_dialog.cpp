@@ -0,0 +1,337 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/dialogs/mass_insert_dialog.h"
+
+#include <algorithm>
+#include <string>
+
+#include <QCheckBox>
+#include <QComboBox>
+#include <QDialogButtonBox>
+#include <QFileDialog>
+#include <QGridLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QMessageBox>
+#include <QPlainTextEdit>
+#include <QPushButton>
+#include <QSpinBox>
+
+#include <common/qt/convert2string.h>
+
+#include "proxy/server/iserver.h"
+#include "proxy/servers_manager.h"
+#include "proxy/types.h"
+
+#include "translations/global.h"
+
+namespace {
+const QString trStart = QObject::tr("Start");
+const QString trBrowse = QObject::tr("Browse...");
+const QString trSelectFile = QObject::tr("Select file");
+const QString trFilterForRecords = QObject::tr("Records files (*.txt *.csv *.jsonl *.json);;All files (*.*)");
+const QString trFormat = QObject::tr("Format:");
+const QString trPipeline = QObject::tr("Pipeline depth:");
+const QString trConnections = QObject::tr("Parallel connections:");
+const QString trConnectionsToolTip = QObject::tr(
+    "Records are split between connections by key slot, only order of commands of one key is kept.\n"
+    "Records without key and SELECT, MULTI, EXEC, DISCARD, WATCH, UNWATCH fail with more than one connection.");
+const QString trKeepGoing = QObject::tr("Skip failed batches");
+const QString trEmptyPath = QObject::tr("Select file to insert.");
+const QString trResultsTemplate_4S = QObject::tr(
+    "Inserted: %1, failed: %2, time: %3 msec\n"
+    "Throughput: %4 records/sec");
+const QString trRunningTemplate_2S = QObject::tr("Running on %1 of %2 connections...");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+MassInsertDialog::MassInsertDialog(const QString& title,
+                                   const QIcon& icon,
+                                   const std::vector<proxy::IConnectionSettingsBaseSPtr>& nodes,
+                                   QWidget* parent)
+    : base_class(title, parent),
+      path_label_(nullptr),
+      path_edit_(nullptr),
+      browse_button_(nullptr),
+      format_label_(nullptr),
+      format_(nullptr),
+      pipeline_label_(nullptr),
+      pipeline_(nullptr),
+      connections_label_(nullptr),
+      connections_(nullptr),
+      keep_going_(nullptr),
+      start_stop_button_(nullptr),
+      results_label_(nullptr),
+      errors_edit_(nullptr),
+      nodes_(nodes),
+      servers_(),
+      pending_connections_(0),
+      executed_(0),
+      failed_(0),
+      max_elapsed_msec_(0),
+      running_(false) {
+  CHECK(!nodes_.empty()) << "Must be settings.";
+  setWindowIcon(icon);
+
+  QGridLayout* settings_layout = new QGridLayout;
+  path_label_ = new QLabel;
+  path_edit_ = new QLineEdit;
+  browse_button_ = new QPushButton;
+  VERIFY(connect(browse_button_, &QPushButton::clicked, this, &MassInsertDialog::browseClicked));
+  settings_layout->addWidget(path_label_, 0, 0);
+  settings_layout->addWidget(path_edit_, 0, 1, 1, 2);
+  settings_layout->addWidget(browse_button_, 0, 3);
+
+  format_label_ = new QLabel;
+  format_ = new QComboBox;
+  for (size_t i = 0; i < proxy::g_command_file_formats_text.size(); ++i) {
+    format_->addItem(proxy::g_command_file_formats_text[i], static_cast<int>(i));
+  }
+  settings_layout->addWidget(format_label_, 1, 0);
+  settings_layout->addWidget(format_, 1, 1);
+
+  pipeline_label_ = new QLabel;
+  pipeline_ = new QSpinBox;
+  pipeline_->setRange(1, max_pipeline);
+  pipeline_->setValue(default_pipeline);
+  settings_layout->addWidget(pipeline_label_, 1, 2);
+  settings_layout->addWidget(pipeline_, 1, 3);
+
+  // cluster takes one connection per master
+  connections_label_ = new QLabel;
+  connections_ = new QSpinBox;
+  connections_->setRange(1, max_connections);
+  connections_->setValue(isCluster() ? static_cast<int>(nodes_.size()) : default_connections);
+  settings_layout->addWidget(connections_label_, 2, 0);
+  settings_layout->addWidget(connections_, 2, 1);
+
+  keep_going_ = new QCheckBox;
+  keep_going_->setChecked(true);
+  settings_layout->addWidget(keep_going_, 2, 2);
+
+  start_stop_button_ = new QPushButton;
+  VERIFY(connect(start_stop_button_, &QPushButton::clicked, this, &MassInsertDialog::startStopClicked));
+  settings_layout->addWidget(start_stop_button_, 2, 3);
+
+  results_label_ = new QLabel;
+  results_label_->setTextInteractionFlags(Qt::TextSelectableByMouse);
+  errors_edit_ = new QPlainTextEdit;
+  errors_edit_->setReadOnly(true);
+
+  QDialogButtonBox* button_box = new QDialogButtonBox(QDialogButtonBox::Ok);
+  button_box->setOrientation(Qt::Horizontal);
+  VERIFY(connect(button_box, &QDialogButtonBox::accepted, this, &MassInsertDialog::accept));
+
+  QVBoxLayout* main_layout = new QVBoxLayout;
+  main_layout->addLayout(settings_layout);
+  main_layout->addWidget(results_label_);
+  main_layout->addWidget(errors_edit_);
+  main_layout->addWidget(button_box);
+  setLayout(main_layout);
+  setMinimumSize(QSize(min_width, min_height));
+
+  updateControls();
+}
+
+MassInsertDialog::~MassInsertDialog() {
+  closeConnections();
+}
+
+void MassInsertDialog::finishConnect(const proxy::events_info::ConnectInfoResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  proxy::IServer* server = qobject_cast<proxy::IServer*>(sender());
+  common::Error err = res.errorInfo();
+  if (err) {
+    addError(err->GetDescription());
+  }
+  if (err || !running_ || !server) {
+    finishConnection();
+    return;
+  }
+
+  size_t index = 0;
+  for (size_t i = 0; i < servers_.size(); ++i) {
+    if (servers_[i].get() == server) {
+      index = i;
+      break;
+    }
+  }
+
+  const proxy::CommandFileFormat format = static_cast<proxy::CommandFileFormat>(format_->currentData().toInt());
+  proxy::events_info::ExecuteFileRequest req(this, common::ConvertToString(path_edit_->text()), 0, pipeline_->value(),
+                                             format, keep_going_->isChecked(), index, servers_.size(), isCluster());
+  server->ExecuteFile(req);
+}
+
+void MassInsertDialog::finishExecuteFile(const proxy::events_info::ExecuteFileResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  for (const std::string& error : res.errors) {
+    addError(error);
+  }
+  common::Error err = res.errorInfo();
+  if (err) {
+    addError(err->GetDescription());
+  }
+
+  executed_ += res.executed;
+  failed_ += res.failed;
+  max_elapsed_msec_ = std::max(max_elapsed_msec_, res.elapsed_msec);
+  finishConnection();
+}
+
+void MassInsertDialog::browseClicked() {
+  const QString filepath = QFileDialog::getOpenFileName(this, trSelectFile, path_edit_->text(), trFilterForRecords);
+  if (filepath.isEmpty()) {
+    return;
+  }
+
+  path_edit_->setText(filepath);
+  if (filepath.endsWith(".csv", Qt::CaseInsensitive)) {
+    format_->setCurrentIndex(proxy::kCommandFileCsv);
+  } else if (filepath.endsWith(".jsonl", Qt::CaseInsensitive) || filepath.endsWith(".json", Qt::CaseInsensitive)) {
+    format_->setCurrentIndex(proxy::kCommandFileJsonLines);
+  }
+}
+
+void MassInsertDialog::startStopClicked() {
+  if (running_) {
+    for (const auto& server : servers_) {
+      server->StopCurrentEvent();
+    }
+    return;
+  }
+
+  if (path_edit_->text().isEmpty()) {
+    QMessageBox::warning(this, translations::trError, trEmptyPath);
+    return;
+  }
+
+  errors_edit_->clear();
+  executed_ = 0;
+  failed_ = 0;
+  max_elapsed_msec_ = 0;
+  running_ = true;
+
+  // history isn't needed for load connections and all of them would write same file, values aren't cached either
+  const size_t connections = isCluster() ? nodes_.size() : connections_->value();
+  for (size_t i = 0; i < connections; ++i) {
+    proxy::IConnectionSettingsBaseSPtr settings(nodes_[isCluster() ? i : 0]->Clone());
+    settings->SetLoggingMsTimeInterval(0);
+    settings->SetValueTrackingEnabled(false);
+    proxy::IServerSPtr server = proxy::ServersManager::GetInstance().CreateServer(settings);
+    if (!server) {
+      continue;
+    }
+
+    VERIFY(connect(server.get(), &proxy::IServer::ConnectFinished, this, &MassInsertDialog::finishConnect));
+    VERIFY(connect(server.get(), &proxy::IServer::ExecuteFileFinished, this, &MassInsertDialog::finishExecuteFile));
+    servers_.push_back(server);
+  }
+
+  pending_connections_ = servers_.size();
+  for (const auto& server : servers_) {
+    proxy::events_info::ConnectInfoRequest req(this);
+    server->Connect(req);
+  }
+  updateControls();
+}
+
+void MassInsertDialog::retranslateUi() {
+  path_label_->setText(translations::trFile + ":");
+  browse_button_->setText(trBrowse);
+  format_label_->setText(trFormat);
+  pipeline_label_->setText(trPipeline);
+  connections_label_->setText(trConnections);
+  connections_->setToolTip(trConnectionsToolTip);
+  keep_going_->setText(trKeepGoing);
+  updateControls();
+  base_class::retranslateUi();
+}
+
+bool MassInsertDialog::isCluster() const {
+  return nodes_.size() > 1;
+}
+
+void MassInsertDialog::addError(const std::string& error) {
+  QString qerror;
+  common::ConvertFromString(error, &qerror);
+  errors_edit_->appendPlainText(qerror);
+}
+
+void MassInsertDialog::finishConnection() {
+  if (pending_connections_ == 0) {
+    return;
+  }
+
+  pending_connections_--;
+  if (pending_connections_ == 0) {
+    running_ = false;
+    closeConnections();
+  }
+  updateControls();
+}
+
+void MassInsertDialog::closeConnections() {
+  for (const auto& server : servers_) {
+    VERIFY(disconnect(server.get(), &proxy::IServer::ConnectFinished, this, &MassInsertDialog::finishConnect));
+    VERIFY(disconnect(server.get(), &proxy::IServer::ExecuteFileFinished, this, &MassInsertDialog::finishExecuteFile));
+    proxy::ServersManager::GetInstance().CloseServer(server);
+  }
+  servers_.clear();
+}
+
+void MassInsertDialog::updateControls() {
+  start_stop_button_->setText(running_ ? translations::trStop : trStart);
+  path_edit_->setReadOnly(running_);
+  browse_button_->setEnabled(!running_);
+  format_->setEnabled(!running_);
+  pipeline_->setEnabled(!running_);
+  connections_->setEnabled(!running_ && !isCluster());
+  keep_going_->setEnabled(!running_);
+  updateResults();
+}
+
+void MassInsertDialog::updateResults() {
+  if (running_) {
+    results_label_->setText(trRunningTemplate_2S.arg(pending_connections_).arg(servers_.size()));
+    return;
+  }
+
+  if (executed_ == 0 && failed_ == 0) {
+    results_label_->clear();
+    return;
+  }
+
+  const double throughput = max_elapsed_msec_ ? static_cast<double>(executed_) * 1000 / max_elapsed_msec_ : 0;
+  results_label_->setText(trResultsTemplate_4S.arg(executed_)
+                              .arg(failed_)
+                              .arg(max_elapsed_msec_)
+                              .arg(throughput, 0, 'f', 1));
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,114 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "gui/dialogs/base_dialog.h"
+
+#include "proxy/connection_settings/iconnection_settings.h"
+#include "proxy/proxy_fwd.h"
+
+class QCheckBox;
+class QComboBox;
+class QLabel;
+class QLineEdit;
+class QPlainTextEdit;
+class QPushButton;
+class QSpinBox;
+
+namespace fastonosql {
+namespace proxy {
+namespace events_info {
+struct ConnectInfoResponse;
+struct ExecuteFileResponse;
+}  // namespace events_info
+}  // namespace proxy
+namespace gui {
+
+// redis-cli --pipe like bulk loader, file is read by driver threads of separate load connections;
+// one node: records are split between parallel connections by key slot, so order of commands per key is kept,
+// every connection parses whole file, speedup comes from parallel round trips only;
+// cluster masters: records go to node owning key slot
+class MassInsertDialog : public BaseDialog {
+  Q_OBJECT
+
+ public:
+  typedef BaseDialog base_class;
+  template <typename T, typename... Args>
+  friend T* createDialog(Args&&... args);
+  enum {
+    min_width = 640,
+    min_height = 480,
+    max_connections = 64,
+    default_connections = 1,  // same result as redis-cli --pipe, more connections need keyed records
+    max_pipeline = 100000,
+    default_pipeline = 1000
+  };
+
+  ~MassInsertDialog() override;
+
+ private Q_SLOTS:
+  void finishConnect(const proxy::events_info::ConnectInfoResponse& res);
+  void finishExecuteFile(const proxy::events_info::ExecuteFileResponse& res);
+
+  void browseClicked();
+  void startStopClicked();
+
+ protected:
+  explicit MassInsertDialog(const QString& title,
+                            const QIcon& icon,
+                            const std::vector<proxy::IConnectionSettingsBaseSPtr>& nodes,
+                            QWidget* parent = Q_NULLPTR);
+
+  void retranslateUi() override;
+
+ private:
+  bool isCluster() const;
+  void addError(const std::string& error);
+  void finishConnection();
+  void closeConnections();
+  void updateControls();
+  void updateResults();
+
+  QLabel* path_label_;
+  QLineEdit* path_edit_;
+  QPushButton* browse_button_;
+  QLabel* format_label_;
+  QComboBox* format_;
+  QLabel* pipeline_label_;
+  QSpinBox* pipeline_;
+  QLabel* connections_label_;
+  QSpinBox* connections_;
+  QCheckBox* keep_going_;
+  QPushButton* start_stop_button_;
+  QLabel* results_label_;
+  QPlainTextEdit* errors_edit_;
+
+  const std::vector<proxy::IConnectionSettingsBaseSPtr> nodes_;
+  std::vector<proxy::IServerSPtr> servers_;
+  size_t pending_connections_;
+  size_t executed_;
+  size_t failed_;
+  common::time64_t max_elapsed_msec_;
+  bool running_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -34,6 +34,7 @@
 #include <common/qt/gui/app_style.h>
 #include <common/qt/translations/translations.h>
 
+#include "proxy/command/command_logger.h"
 #include "proxy/settings_manager.h"
 
 #include "gui/widgets/path_widget.h"
@@ -55,6 +56,10 @@ const QString trFont = QObject::tr("Font");
 const QString trDefaultView = QObject::tr("Default view");
 const QString trHistoryDirectory = QObject::tr("History directory");
 const QString trGeneral = QObject::tr("General");
+const QString trCommandsLog = QObject::tr("Commands log");
+const QString trUserCommandsSampling = QObject::tr("Log every N-th user command (0 - off)");
+const QString trInnerCommandsSampling = QObject::tr("Log every N-th inner command (0 - off)");
+const QString trCommandsLogFile = QObject::tr("Write to file in history directory");
 const QString trExternal = QObject::tr("External");
 
 const QString trSelectPythonPath = QObject::tr("Select python executable");
@@ -101,6 +106,13 @@ PreferencesDialog::PreferencesDialog(QWidget* parent)
       auto_open_console_(nullptr),
       auto_connect_db_(nullptr),
       show_welcome_page_(nullptr),
+      commands_log_box_(nullptr),
+      user_commands_sampling_label_(nullptr),
+      user_commands_sampling_(nullptr),
+      inner_commands_sampling_label_(nullptr),
+      inner_commands_sampling_(nullptr),
+      commands_log_file_label_(nullptr),
+      commands_log_file_combo_box_(nullptr),
       external_box_(nullptr),
       python_path_widget_(nullptr),
       modules_path_widget_(nullptr) {
@@ -149,6 +161,17 @@ void PreferencesDialog::accept() {
   proxy::SettingsManager::GetInstance()->SetShowWelcomePage(show_welcome_page_->isChecked());
   proxy::SettingsManager::GetInstance()->SetPythonPath(python_path_widget_->path());
 
+  proxy::SettingsManager::GetInstance()->SetUserCommandsLogSampling(user_commands_sampling_->value());
+  proxy::SettingsManager::GetInstance()->SetInnerCommandsLogSampling(inner_commands_sampling_->value());
+  const QVariant log_file_var = commands_log_file_combo_box_->currentData();
+  proxy::CommandLogFileFormat log_file_format =
+      static_cast<proxy::CommandLogFileFormat>(qvariant_cast<unsigned char>(log_file_var));
+  proxy::SettingsManager::GetInstance()->SetCommandsLogFileFormat(log_file_format);
+  proxy::CommandLogger::GetInstance().SetSampling(core::C_USER, user_commands_sampling_->value());
+  proxy::CommandLogger::GetInstance().SetSampling(core::C_INNER, inner_commands_sampling_->value());
+  proxy::CommandLogger::GetInstance().SetFileSink(proxy::SettingsManager::GetInstance()->GetCommandsLogFilePath(),
+                                                  log_file_format);
+
   return base_class::accept();
 }
 
@@ -168,6 +191,10 @@ void PreferencesDialog::syncWithSettings() {
   auto_open_console_->setChecked(proxy::SettingsManager::GetInstance()->AutoOpenConsole());
   auto_connect_db_->setChecked(proxy::SettingsManager::GetInstance()->GetAutoConnectDB());
   show_welcome_page_->setChecked(proxy::SettingsManager::GetInstance()->GetShowWelcomePage());
+  user_commands_sampling_->setValue(proxy::SettingsManager::GetInstance()->GetUserCommandsLogSampling());
+  inner_commands_sampling_->setValue(proxy::SettingsManager::GetInstance()->GetInnerCommandsLogSampling());
+  proxy::CommandLogFileFormat log_file_format = proxy::SettingsManager::GetInstance()->GetCommandsLogFileFormat();
+  commands_log_file_combo_box_->setCurrentIndex(log_file_format);
   QString python_path = proxy::SettingsManager::GetInstance()->GetPythonPath();
   python_path_widget_->setPath(python_path);
 
@@ -296,12 +323,37 @@ QWidget* PreferencesDialog::createMainTab() {
   general_layout->addWidget(log_dir_path_, 7, 1);
   general_box_->setLayout(general_layout);
 
+  // commands log
+  commands_log_box_ = new QGroupBox;
+  QGridLayout* commands_log_layout = new QGridLayout;
+  user_commands_sampling_label_ = new QLabel;
+  user_commands_sampling_ = new QSpinBox;
+  user_commands_sampling_->setRange(0, max_commands_sampling);
+  commands_log_layout->addWidget(user_commands_sampling_label_, 0, 0);
+  commands_log_layout->addWidget(user_commands_sampling_, 0, 1);
+
+  inner_commands_sampling_label_ = new QLabel;
+  inner_commands_sampling_ = new QSpinBox;
+  inner_commands_sampling_->setRange(0, max_commands_sampling);
+  commands_log_layout->addWidget(inner_commands_sampling_label_, 1, 0);
+  commands_log_layout->addWidget(inner_commands_sampling_, 1, 1);
+
+  commands_log_file_label_ = new QLabel;
+  commands_log_file_combo_box_ = new QComboBox;
+  for (uint32_t i = 0; i < proxy::g_command_log_file_formats_text.size(); ++i) {
+    commands_log_file_combo_box_->addItem(proxy::g_command_log_file_formats_text[i], i);
+  }
+  commands_log_layout->addWidget(commands_log_file_label_, 2, 0);
+  commands_log_layout->addWidget(commands_log_file_combo_box_, 2, 1);
+  commands_log_box_->setLayout(commands_log_layout);
+
   // main layout
   QVBoxLayout* layout = new QVBoxLayout;
 #if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
   layout->addWidget(profile_box_);
 #endif
   layout->addWidget(general_box_);
+  layout->addWidget(commands_log_box_);
   main->setLayout(layout);
   return main;
 }
@@ -345,6 +397,10 @@ void PreferencesDialog::retranslateUi() {
   font_label_->setText(trFont + ":");
   default_view_label_->setText(trDefaultView + ":");
   log_dir_label_->setText(trHistoryDirectory + ":");
+  commands_log_box_->setTitle(trCommandsLog);
+  user_commands_sampling_label_->setText(trUserCommandsSampling + ":");
+  inner_commands_sampling_label_->setText(trInnerCommandsSampling + ":");
+  commands_log_file_label_->setText(trCommandsLogFile + ":");
   base_class::retranslateUi();
 }
 
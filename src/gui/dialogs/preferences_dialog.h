@@ -41,7 +41,7 @@ class PreferencesDialog : public BaseDialog {
   template <typename T, typename... Args>
   friend T* createDialog(Args&&... args);
 
-  enum { min_width = 640, min_height = 480 };
+  enum { min_width = 640, min_height = 480, max_commands_sampling = 1000 };
 
  public Q_SLOTS:
   void accept() override;
@@ -92,6 +92,14 @@ class PreferencesDialog : public BaseDialog {
   QCheckBox* auto_connect_db_;
   QCheckBox* show_welcome_page_;
 
+  QGroupBox* commands_log_box_;
+  QLabel* user_commands_sampling_label_;
+  QSpinBox* user_commands_sampling_;
+  QLabel* inner_commands_sampling_label_;
+  QSpinBox* inner_commands_sampling_;
+  QLabel* commands_log_file_label_;
+  QComboBox* commands_log_file_combo_box_;
+
   QGroupBox* external_box_;
   IPathWidget* python_path_widget_;
   IPathWidget* modules_path_widget_;
@@ -0,0 +1,323 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/dialogs/stream_value_dialog.h"
+
+#include <algorithm>
+
+#include <QDateTimeEdit>
+#include <QDialogButtonBox>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPushButton>
+#include <QSplitter>
+
+#include <common/qt/convert2string.h>
+
+#include "proxy/database/idatabase.h"
+#include "proxy/server/iserver.h"
+
+#include "gui/models/stream_entries_table_model.h"
+#include "gui/models/stream_groups_table_model.h"
+#include "gui/views/fasto_table_view.h"
+
+#include "translations/global.h"
+
+#define MIN_STREAM_ID "-"
+#define MAX_STREAM_ID "+"
+
+namespace {
+const QString trFirst = QObject::tr("First");
+const QString trLast = QObject::tr("Last");
+const QString trJumpTo = QObject::tr("Jump to time");
+const QString trLoading = QObject::tr("Loading...");
+const QString trNoEntries = QObject::tr("No entries");
+const QString trPageTemplate_2S = QObject::tr("Entries %1 - %2");
+const QString trInfoTemplate_4S = QObject::tr("%1 entries, first ID: %2, last ID: %3, consumer groups: %4");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+namespace {
+
+QString StreamIdToString(const core::StreamValue::stream_id& sid) {
+  QString qsid;
+  common::ConvertFromBytes(sid, &qsid);
+  return qsid;
+}
+
+core::StreamValue::stream_id MakeStreamId(const QString& sid) {
+  return common::ConvertToCharBytes(sid);
+}
+
+}  // namespace
+
+StreamValueDialog::StreamValueDialog(const QString& title,
+                                     const QIcon& icon,
+                                     proxy::IDatabaseSPtr db,
+                                     const core::NKey& key,
+                                     const proxy::StreamInfo& info,
+                                     QWidget* parent)
+    : base_class(title, parent),
+      info_label_(nullptr),
+      first_button_(nullptr),
+      previous_button_(nullptr),
+      next_button_(nullptr),
+      last_button_(nullptr),
+      time_edit_(nullptr),
+      jump_button_(nullptr),
+      refresh_button_(nullptr),
+      page_label_(nullptr),
+      entries_table_(nullptr),
+      entries_model_(nullptr),
+      groups_table_(nullptr),
+      groups_model_(nullptr),
+      db_(db),
+      key_(key),
+      info_(),
+      page_(),
+      at_begin_(true),
+      at_end_(true),
+      loading_(false) {
+  CHECK(db_) << "Must be database.";
+  setWindowIcon(icon);
+
+  proxy::IServerSPtr server = db_->GetServer();
+  VERIFY(connect(server.get(), &proxy::IServer::LoadStreamPageFinished, this,
+                 &StreamValueDialog::finishLoadStreamPage));
+  VERIFY(connect(server.get(), &proxy::IServer::LoadStreamInfoFinished, this,
+                 &StreamValueDialog::finishLoadStreamInfo));
+
+  info_label_ = new QLabel;
+  info_label_->setTextInteractionFlags(Qt::TextSelectableByMouse);
+  refresh_button_ = new QPushButton;
+  VERIFY(connect(refresh_button_, &QPushButton::clicked, this, &StreamValueDialog::refreshClicked));
+  QHBoxLayout* info_layout = new QHBoxLayout;
+  info_layout->addWidget(info_label_, 1);
+  info_layout->addWidget(refresh_button_);
+
+  first_button_ = new QPushButton;
+  VERIFY(connect(first_button_, &QPushButton::clicked, this, &StreamValueDialog::firstClicked));
+  previous_button_ = new QPushButton;
+  VERIFY(connect(previous_button_, &QPushButton::clicked, this, &StreamValueDialog::previousClicked));
+  next_button_ = new QPushButton;
+  VERIFY(connect(next_button_, &QPushButton::clicked, this, &StreamValueDialog::nextClicked));
+  last_button_ = new QPushButton;
+  VERIFY(connect(last_button_, &QPushButton::clicked, this, &StreamValueDialog::lastClicked));
+  time_edit_ = new QDateTimeEdit(QDateTime::currentDateTime());
+  time_edit_->setCalendarPopup(true);
+  time_edit_->setDisplayFormat("yyyy-MM-dd hh:mm:ss.zzz");
+  jump_button_ = new QPushButton;
+  VERIFY(connect(jump_button_, &QPushButton::clicked, this, &StreamValueDialog::jumpClicked));
+
+  QHBoxLayout* nav_layout = new QHBoxLayout;
+  nav_layout->addWidget(first_button_);
+  nav_layout->addWidget(previous_button_);
+  nav_layout->addWidget(next_button_);
+  nav_layout->addWidget(last_button_);
+  nav_layout->addStretch(1);
+  nav_layout->addWidget(time_edit_);
+  nav_layout->addWidget(jump_button_);
+
+  page_label_ = new QLabel;
+
+  entries_model_ = new StreamEntriesTableModel(this);
+  entries_table_ = new FastoTableView;
+  entries_table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+  entries_table_->setSelectionMode(QAbstractItemView::SingleSelection);
+  entries_table_->setModel(entries_model_);
+  entries_table_->horizontalHeader()->setSectionResizeMode(StreamEntriesTableModel::kFields, QHeaderView::Stretch);
+
+  groups_model_ = new StreamGroupsTableModel(this);
+  groups_table_ = new FastoTableView;
+  groups_table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+  groups_table_->setSelectionMode(QAbstractItemView::SingleSelection);
+  groups_table_->setModel(groups_model_);
+  groups_table_->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+
+  QSplitter* splitter = new QSplitter(Qt::Vertical);
+  splitter->addWidget(entries_table_);
+  splitter->addWidget(groups_table_);
+  splitter->setStretchFactor(0, 3);
+  splitter->setStretchFactor(1, 1);
+
+  QDialogButtonBox* button_box = new QDialogButtonBox(QDialogButtonBox::Close);
+  button_box->setOrientation(Qt::Horizontal);
+  VERIFY(connect(button_box, &QDialogButtonBox::rejected, this, &StreamValueDialog::reject));
+
+  QVBoxLayout* main_layout = new QVBoxLayout;
+  main_layout->addLayout(info_layout);
+  main_layout->addLayout(nav_layout);
+  main_layout->addWidget(page_label_);
+  main_layout->addWidget(splitter);
+  main_layout->addWidget(button_box);
+  setLayout(main_layout);
+  setMinimumSize(QSize(min_width, min_height));
+
+  setInfo(info);
+  firstClicked();
+}
+
+void StreamValueDialog::finishLoadStreamPage(const proxy::events_info::LoadStreamPageResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  loading_ = false;
+  common::Error err = res.errorInfo();
+  if (err) {
+    updateControls();
+    QString qerror;
+    common::ConvertFromString(err->GetDescription(), &qerror);
+    page_label_->setText(qerror);
+    return;
+  }
+
+  // range starting at shown entry returns it first, one entry more than page tells if there is more
+  std::vector<core::StreamValue::Stream> streams = res.streams;
+  const core::StreamValue::stream_id& boundary = res.reverse ? res.end : res.start;
+  if (res.from_shown && !streams.empty() && streams.front().sid == boundary) {
+    streams.erase(streams.begin());
+  }
+  const bool has_more = streams.size() > page_size;
+  if (has_more) {
+    streams.resize(page_size);
+  }
+  if (res.reverse) {
+    std::reverse(streams.begin(), streams.end());
+    at_begin_ = !has_more;
+    at_end_ = res.end == MakeStreamId(MAX_STREAM_ID);
+  } else {
+    at_begin_ = res.start == MakeStreamId(MIN_STREAM_ID);
+    at_end_ = !has_more;
+  }
+
+  if (streams.empty() && !page_.empty()) {  // shown page stays
+    updateControls();
+    return;
+  }
+
+  page_ = streams;
+  entries_model_->setStreams(page_);
+  updateControls();
+}
+
+void StreamValueDialog::finishLoadStreamInfo(const proxy::events_info::LoadStreamInfoResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  common::Error err = res.errorInfo();
+  if (err) {
+    QString qerror;
+    common::ConvertFromString(err->GetDescription(), &qerror);
+    info_label_->setText(qerror);
+    return;
+  }
+
+  setInfo(res.info);
+}
+
+void StreamValueDialog::firstClicked() {
+  loadPage(MakeStreamId(MIN_STREAM_ID), MakeStreamId(MAX_STREAM_ID), false, false);
+}
+
+void StreamValueDialog::previousClicked() {
+  if (page_.empty()) {
+    return;
+  }
+
+  loadPage(MakeStreamId(MIN_STREAM_ID), page_.front().sid, true, true);
+}
+
+void StreamValueDialog::nextClicked() {
+  if (page_.empty()) {
+    return;
+  }
+
+  loadPage(page_.back().sid, MakeStreamId(MAX_STREAM_ID), false, true);
+}
+
+void StreamValueDialog::lastClicked() {
+  loadPage(MakeStreamId(MIN_STREAM_ID), MakeStreamId(MAX_STREAM_ID), true, false);
+}
+
+void StreamValueDialog::jumpClicked() {
+  // ids start with milliseconds timestamp, so it is the smallest id of that moment, entry with it is shown too
+  const QString msec = QString::number(time_edit_->dateTime().toMSecsSinceEpoch());
+  loadPage(MakeStreamId(msec), MakeStreamId(MAX_STREAM_ID), false, false);
+}
+
+void StreamValueDialog::refreshClicked() {
+  proxy::events_info::LoadStreamInfoRequest req(this, db_->GetInfo(), key_);
+  db_->GetServer()->LoadStreamInfo(req);
+}
+
+void StreamValueDialog::retranslateUi() {
+  first_button_->setText(trFirst);
+  previous_button_->setText(translations::trPrevious);
+  next_button_->setText(translations::trNext);
+  last_button_->setText(trLast);
+  jump_button_->setText(trJumpTo);
+  refresh_button_->setText(translations::trRefresh);
+  setInfo(info_);
+  updateControls();
+  base_class::retranslateUi();
+}
+
+void StreamValueDialog::loadPage(const core::StreamValue::stream_id& start,
+                                 const core::StreamValue::stream_id& end,
+                                 bool reverse,
+                                 bool from_shown) {
+  // range starting at shown entry returns it too, it is dropped and one more entry is asked for it
+  const size_t count = from_shown ? page_size + 2 : page_size + 1;
+  loading_ = true;
+  updateControls();
+  proxy::events_info::LoadStreamPageRequest req(this, db_->GetInfo(), key_, start, end, count, reverse, from_shown);
+  db_->GetServer()->LoadStreamPage(req);
+}
+
+void StreamValueDialog::setInfo(const proxy::StreamInfo& info) {
+  info_ = info;
+  info_label_->setText(trInfoTemplate_4S.arg(info_.length)
+                           .arg(StreamIdToString(info_.first_id))
+                           .arg(StreamIdToString(info_.last_id))
+                           .arg(info_.groups.size()));
+  groups_model_->setGroups(info_.groups);
+}
+
+void StreamValueDialog::updateControls() {
+  first_button_->setEnabled(!loading_ && !at_begin_);
+  previous_button_->setEnabled(!loading_ && !at_begin_ && !page_.empty());
+  next_button_->setEnabled(!loading_ && !at_end_ && !page_.empty());
+  last_button_->setEnabled(!loading_ && !at_end_);
+  jump_button_->setEnabled(!loading_);
+
+  if (loading_) {
+    page_label_->setText(trLoading);
+  } else if (page_.empty()) {
+    page_label_->setText(trNoEntries);
+  } else {
+    page_label_->setText(trPageTemplate_2S.arg(StreamIdToString(page_.front().sid))
+                             .arg(StreamIdToString(page_.back().sid)));
+  }
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,116 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include <fastonosql/core/db_key.h>
+#include <fastonosql/core/value.h>
+
+#include "gui/dialogs/base_dialog.h"
+
+#include "proxy/proxy_fwd.h"
+#include "proxy/stream_info.h"
+
+class QDateTimeEdit;
+class QLabel;
+class QPushButton;
+
+namespace fastonosql {
+namespace proxy {
+namespace events_info {
+struct LoadStreamPageResponse;
+struct LoadStreamInfoResponse;
+}  // namespace events_info
+}  // namespace proxy
+namespace gui {
+class FastoTableView;
+class StreamEntriesTableModel;
+class StreamGroupsTableModel;
+
+// stream too big to load at once: entries are read by XRANGE/XREVRANGE windows of ids in both directions,
+// consumer groups are summarized by XINFO
+class StreamValueDialog : public BaseDialog {
+  Q_OBJECT
+
+ public:
+  typedef BaseDialog base_class;
+  template <typename T, typename... Args>
+  friend T* createDialog(Args&&... args);
+  enum {
+    min_width = 800,
+    min_height = 600,
+    page_size = 100,
+    min_entries_count = 10000  // smaller streams are loaded whole
+  };
+
+ private Q_SLOTS:
+  void finishLoadStreamPage(const proxy::events_info::LoadStreamPageResponse& res);
+  void finishLoadStreamInfo(const proxy::events_info::LoadStreamInfoResponse& res);
+
+  void firstClicked();
+  void previousClicked();
+  void nextClicked();
+  void lastClicked();
+  void jumpClicked();
+  void refreshClicked();
+
+ protected:
+  explicit StreamValueDialog(const QString& title,
+                             const QIcon& icon,
+                             proxy::IDatabaseSPtr db,
+                             const core::NKey& key,
+                             const proxy::StreamInfo& info,
+                             QWidget* parent = Q_NULLPTR);
+
+  void retranslateUi() override;
+
+ private:
+  void loadPage(const core::StreamValue::stream_id& start,
+                const core::StreamValue::stream_id& end,
+                bool reverse,
+                bool from_shown);
+  void setInfo(const proxy::StreamInfo& info);
+  void updateControls();
+
+  QLabel* info_label_;
+  QPushButton* first_button_;
+  QPushButton* previous_button_;
+  QPushButton* next_button_;
+  QPushButton* last_button_;
+  QDateTimeEdit* time_edit_;
+  QPushButton* jump_button_;
+  QPushButton* refresh_button_;
+  QLabel* page_label_;
+  FastoTableView* entries_table_;
+  StreamEntriesTableModel* entries_model_;
+  FastoTableView* groups_table_;
+  StreamGroupsTableModel* groups_model_;
+  proxy::IDatabaseSPtr db_;
+  const core::NKey key_;
+
+  proxy::StreamInfo info_;
+  std::vector<core::StreamValue::Stream> page_;
+  bool at_begin_;
+  bool at_end_;
+  bool loading_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
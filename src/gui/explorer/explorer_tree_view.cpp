@@ -19,6 +19,7 @@
 #include "gui/explorer/explorer_tree_view.h"
 
 #include <string>
+#include <vector>
 
 #include <QApplication>
 #include <QClipboard>
@@ -40,13 +41,22 @@
 #include "proxy/sentinel/isentinel.h"
 #include "proxy/server/iserver_remote.h"
 
+#include "gui/dialogs/benchmark_dialog.h"
+#include "gui/dialogs/commands_latency_dialog.h"
+#include "gui/dialogs/big_keys_dialog.h"
 #include "gui/dialogs/clients_monitor_dialog.h"
+#include "gui/dialogs/collection_value_dialog.h"
+#include "gui/dialogs/hot_keys_dialog.h"
 #include "gui/dialogs/dbkey_dialog.h"
 #include "gui/dialogs/history_server_dialog.h"
 #include "gui/dialogs/info_server_dialog.h"
+#include "gui/dialogs/keyspace_analyzer_dialog.h"
+#include "gui/dialogs/large_value_dialog.h"
 #include "gui/dialogs/load_contentdb_dialog.h"
+#include "gui/dialogs/mass_insert_dialog.h"
 #include "gui/dialogs/property_server_dialog.h"
 #include "gui/dialogs/pub_sub_dialog.h"
+#include "gui/dialogs/stream_value_dialog.h"
 #include "gui/dialogs/view_keys_dialog.h"
 
 #include "gui/gui_factory.h"
@@ -66,6 +76,14 @@ const QString trRemoveAllKeysTemplate_1S = QObject::tr("Really remove all keys f
 const QString trViewKeyTemplate_1S = QObject::tr("View keys in %1 database");
 const QString trViewChannelsTemplate_1S = QObject::tr("View channels in %1 server");
 const QString trViewClientsTemplate_1S = QObject::tr("View clients in %1 server");
+const QString trHotKeys = QObject::tr("Hot keys");
+const QString trBenchmark = QObject::tr("Benchmark");
+const QString trBenchmarkTemplate_1S = QObject::tr("Benchmark of %1 server");
+const QString trCommandsLatency = QObject::tr("Commands latency");
+const QString trCommandsLatencyTemplate_1S = QObject::tr("%1 commands latency");
+const QString trMassInsert = QObject::tr("Mass insert");
+const QString trMassInsertTemplate_1S = QObject::tr("Mass insert into %1");
+const QString trHotKeysTemplate_1S = QObject::tr("Hot keys of %1 server");
 const QString trClearDb = QObject::tr("Clear database");
 const QString trLoadContentTemplate_1S = QObject::tr("Load keys in %1 database");
 const QString trSetMaxConnectionOnServerTemplate_1S = QObject::tr("Set max connection on %1 server");
@@ -73,6 +91,7 @@ const QString trSetTTLOnKeyTemplate_1S = QObject::tr("Set ttl for %1 key");
 const QString trNewTTLSeconds = QObject::tr("New TTL in seconds:");
 const QString trSetIntervalOnKeyTemplate_1S = QObject::tr("Set watch interval for %1 key");
 const QString trIntervalValue = QObject::tr("Interval msec:");
+const QString trStopWatch = QObject::tr("Stop watch");
 const QString trSetTTL = QObject::tr("Set TTL");
 const QString trRemoveTTL = QObject::tr("Remove TTL");
 const QString trRenameKeyLabel = QObject::tr("New branch name:");
@@ -81,12 +100,22 @@ const QString trCreateDatabase_1S = QObject::tr("Create database on %1 server");
 const QString trPropertiesTemplate_1S = QObject::tr("%1 properties");
 const QString trHistoryTemplate_1S = QObject::tr("%1 history");
 const QString trCopyToClipboard = QObject::tr("Copy to clipboard");
+const QString trAnalyzeKeyspace = QObject::tr("Analyze keyspace");
+const QString trAnalyzeKeyspaceTemplate_1S = QObject::tr("Keyspace of %1 database");
+const QString trFindBigKeys = QObject::tr("Find big keys");
+const QString trFindBigKeysTemplate_1S = QObject::tr("Big keys in %1 database");
+const QString trLiveKeyspaceSync = QObject::tr("Live keyspace sync");
+const QString trLargeValueTemplate_1S = QObject::tr("Value of %1 key");
+
+const size_t kServerFilterScanCount = 1000;  // SCAN COUNT hint per page
+const size_t kServerFilterMaxKeys = 10000;   // stop streaming pages after this many matches per server
 }  // namespace
 
 namespace fastonosql {
 namespace gui {
 
-ExplorerTreeView::ExplorerTreeView(QWidget* parent) : QTreeView(parent) {
+ExplorerTreeView::ExplorerTreeView(QWidget* parent)
+    : QTreeView(parent), server_filter_pattern_(), server_filter_type_(), server_filter_loaded_() {
   source_model_ = new ExplorerTreeModel(this);
   proxy_model_ = new ExplorerTreeSortFilterProxyModel(this);
   proxy_model_->setSourceModel(source_model_);
@@ -196,10 +225,42 @@ void ExplorerTreeView::removeCluster(proxy::IClusterSPtr cluster) {
 #endif
 
 void ExplorerTreeView::changeTextFilter(const QString& text) {
+  server_filter_pattern_.clear();
+  server_filter_type_.clear();
+  server_filter_loaded_.clear();
+
   QRegExp regExp(text);
   proxy_model_->setFilterRegExp(regExp);
 }
 
+void ExplorerTreeView::changeServerFilter(const QString& pattern, const QString& key_type) {
+  // matching is done by SCAN MATCH on server, local regexp would hide glob results
+  proxy_model_->setFilterRegExp(QRegExp());
+  server_filter_loaded_.clear();
+  if (pattern.isEmpty()) {
+    server_filter_pattern_.clear();
+    server_filter_type_.clear();
+    return;
+  }
+
+  server_filter_pattern_ = common::ConvertToString(pattern);
+  server_filter_type_ = common::ConvertToString(key_type);
+  const std::vector<ExplorerDatabaseItem*> dbs = source_model_->findDefaultDatabaseItems();
+  for (ExplorerDatabaseItem* db_item : dbs) {
+    proxy::IServerSPtr server = db_item->server();
+    proxy::IDatabaseSPtr db = db_item->db();
+    if (!server || !db || !server->IsConnected()) {
+      continue;
+    }
+
+    source_model_->removeAllKeys(server.get(), db->GetInfo());
+    server_filter_loaded_[server.get()] = 0;
+    proxy::events_info::LoadDatabaseContentRequest req(this, db->GetInfo(), server_filter_pattern_,
+                                                       kServerFilterScanCount, 0, server_filter_type_);
+    db->LoadContent(req);
+  }
+}
+
 void ExplorerTreeView::showContextMenu(const QPoint& point) {
   QModelIndexList selected = selectedEqualTypeIndexes();
   if (selected.empty()) {
@@ -251,6 +312,18 @@ void ExplorerTreeView::showContextMenu(const QPoint& point) {
     info_server_action->setEnabled(is_connected);
     menu.addAction(info_server_action);
 
+    QAction* benchmark_action = new QAction(trBenchmark, this);
+    VERIFY(connect(benchmark_action, &QAction::triggered, this, &ExplorerTreeView::openBenchmarkDialog));
+    menu.addAction(benchmark_action);
+
+    QAction* mass_insert_action = new QAction(trMassInsert, this);
+    VERIFY(connect(mass_insert_action, &QAction::triggered, this, &ExplorerTreeView::openMassInsertDialog));
+    menu.addAction(mass_insert_action);
+
+    QAction* commands_latency_action = new QAction(trCommandsLatency, this);
+    VERIFY(connect(commands_latency_action, &QAction::triggered, this, &ExplorerTreeView::viewCommandsLatency));
+    menu.addAction(commands_latency_action);
+
     if (is_redis) {
       QAction* property_server_action = new QAction(translations::trProperty, this);
       VERIFY(connect(property_server_action, &QAction::triggered, this, &ExplorerTreeView::openPropertyServerDialog));
@@ -270,6 +343,11 @@ void ExplorerTreeView::showContextMenu(const QPoint& point) {
       clients_monitor_action->setEnabled(is_connected);
       menu.addAction(clients_monitor_action);
 
+      QAction* hot_keys_action = new QAction(trHotKeys, this);
+      VERIFY(connect(hot_keys_action, &QAction::triggered, this, &ExplorerTreeView::viewHotKeys));
+      hot_keys_action->setEnabled(is_connected);
+      menu.addAction(hot_keys_action);
+
       bool is_local = true;
       bool is_can_remote = server->IsCanRemote();
       if (is_can_remote) {
@@ -352,6 +430,27 @@ void ExplorerTreeView::showContextMenu(const QPoint& point) {
     menu.addAction(set_default_db_action);
     set_default_db_action->setEnabled(!is_default && is_connected);
 
+    if (server->GetType() == core::REDIS) {
+      QAction* analyze_keyspace_action = new QAction(trAnalyzeKeyspace, this);
+      VERIFY(connect(analyze_keyspace_action, &QAction::triggered, this, &ExplorerTreeView::analyzeKeyspace));
+      analyze_keyspace_action->setEnabled(is_default && is_connected);
+      menu.addAction(analyze_keyspace_action);
+
+      QAction* find_big_keys_action = new QAction(trFindBigKeys, this);
+      VERIFY(connect(find_big_keys_action, &QAction::triggered, this, &ExplorerTreeView::findBigKeys));
+      find_big_keys_action->setEnabled(is_default && is_connected);
+      menu.addAction(find_big_keys_action);
+    }
+
+    if (server->GetType() == core::REDIS || server->GetType() == core::KEYDB) {
+      QAction* keyspace_sync_action = new QAction(trLiveKeyspaceSync, this);
+      keyspace_sync_action->setCheckable(true);
+      keyspace_sync_action->setChecked(is_default && server->IsKeyspaceSyncEnabled());
+      VERIFY(connect(keyspace_sync_action, &QAction::triggered, this, &ExplorerTreeView::setKeyspaceSync));
+      keyspace_sync_action->setEnabled(is_default && is_connected);
+      menu.addAction(keyspace_sync_action);
+    }
+
     if (server->IsCanRemoveDatabase()) {
       QAction* remove_database_action = new QAction(translations::trRemove, this);
       VERIFY(connect(remove_database_action, &QAction::triggered, this, &ExplorerTreeView::removeDb));
@@ -415,6 +514,9 @@ void ExplorerTreeView::showContextMenu(const QPoint& point) {
     QAction* watch_key_action = new QAction(translations::trWatch, this);
     VERIFY(connect(watch_key_action, &QAction::triggered, this, &ExplorerTreeView::watchKey));
 
+    QAction* stop_watch_key_action = new QAction(trStopWatch, this);
+    VERIFY(connect(stop_watch_key_action, &QAction::triggered, this, &ExplorerTreeView::stopWatchKey));
+
     proxy::IServerSPtr server = key->server();
 
     bool is_connected = server->IsConnected();
@@ -442,6 +544,8 @@ void ExplorerTreeView::showContextMenu(const QPoint& point) {
     delete_key_action->setEnabled(is_connected);
     menu.addAction(watch_key_action);
     watch_key_action->setEnabled(is_connected);
+    menu.addAction(stop_watch_key_action);
+    stop_watch_key_action->setEnabled(is_connected);
 
     QAction* copy_to_clipboard_action = new QAction(trCopyToClipboard, this);
     VERIFY(connect(copy_to_clipboard_action, &QAction::triggered, this, &ExplorerTreeView::copyToClipboard));
@@ -455,6 +559,10 @@ void ExplorerTreeView::showContextMenu(const QPoint& point) {
     VERIFY(connect(close_cluster_action, &QAction::triggered, this, &ExplorerTreeView::closeClusterConnection));
     menu.addAction(close_cluster_action);
 
+    QAction* mass_insert_action = new QAction(trMassInsert, this);
+    VERIFY(connect(mass_insert_action, &QAction::triggered, this, &ExplorerTreeView::openClusterMassInsertDialog));
+    menu.addAction(mass_insert_action);
+
     QAction* copy_to_clipboard_action = new QAction(trCopyToClipboard, this);
     VERIFY(connect(copy_to_clipboard_action, &QAction::triggered, this, &ExplorerTreeView::copyToClipboard));
     menu.addAction(copy_to_clipboard_action);
@@ -581,6 +689,70 @@ void ExplorerTreeView::openInfoServerDialog() {
   }
 }
 
+void ExplorerTreeView::openBenchmarkDialog() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerServerItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerServerItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    proxy::IServerSPtr server = node->server();
+    if (!server) {
+      continue;
+    }
+
+    auto diag = createDialog<BenchmarkDialog>(trBenchmarkTemplate_1S.arg(node->name()),
+                                              GuiFactory::GetInstance().icon(server->GetType()), server->GetSettings(),
+                                              this);  // +
+    diag->exec();
+  }
+}
+
+void ExplorerTreeView::openMassInsertDialog() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerServerItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerServerItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    proxy::IServerSPtr server = node->server();
+    if (!server) {
+      continue;
+    }
+
+    const std::vector<proxy::IConnectionSettingsBaseSPtr> nodes = {server->GetSettings()};
+    auto diag = createDialog<MassInsertDialog>(trMassInsertTemplate_1S.arg(node->name()),
+                                               GuiFactory::GetInstance().icon(server->GetType()), nodes,
+                                               this);  // +
+    diag->exec();
+  }
+}
+
+void ExplorerTreeView::viewCommandsLatency() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerServerItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerServerItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    proxy::IServerSPtr server = node->server();
+    if (!server) {
+      continue;
+    }
+
+    auto diag = createDialog<CommandsLatencyDialog>(trCommandsLatencyTemplate_1S.arg(node->name()),
+                                                    GuiFactory::GetInstance().icon(server->GetType()), server,
+                                                    this);  // +
+    diag->exec();
+  }
+}
+
 void ExplorerTreeView::openPropertyServerDialog() {
   QModelIndexList selected = selectedEqualTypeIndexes();
   for (QModelIndex ind : selected) {
@@ -686,6 +858,38 @@ void ExplorerTreeView::closeClusterConnection() {
   }
 }
 
+void ExplorerTreeView::openClusterMassInsertDialog() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerClusterItem* cnode = common::qt::item<common::qt::gui::TreeItem*, ExplorerClusterItem*>(ind);
+    if (!cnode) {
+      continue;
+    }
+
+    proxy::IClusterSPtr cluster = cnode->cluster();
+    if (!cluster) {
+      continue;
+    }
+
+    // keys are routed by slot, so only masters take writes
+    std::vector<proxy::IConnectionSettingsBaseSPtr> masters;
+    for (auto node : cluster->GetNodes()) {
+      proxy::IServerRemote* rserver = dynamic_cast<proxy::IServerRemote*>(node.get());  // +
+      if (rserver && rserver->GetRole() == core::MASTER) {
+        masters.push_back(node->GetSettings());
+      }
+    }
+
+    if (masters.empty()) {
+      continue;
+    }
+
+    auto diag = createDialog<MassInsertDialog>(trMassInsertTemplate_1S.arg(cnode->name()),
+                                               GuiFactory::GetInstance().clusterIcon(), masters, this);  // +
+    diag->exec();
+  }
+}
+
 void ExplorerTreeView::closeSentinelConnection() {
   QModelIndexList selected = selectedEqualTypeIndexes();
   for (QModelIndex ind : selected) {
@@ -737,6 +941,22 @@ void ExplorerTreeView::viewClientsMonitor() {
   }
 }
 
+void ExplorerTreeView::viewHotKeys() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerServerItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerServerItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    proxy::IServerSPtr server = node->server();
+    auto diag = createDialog<HotKeysDialog>(trHotKeysTemplate_1S.arg(node->name()),
+                                            GuiFactory::GetInstance().icon(server->GetType()), server, this);  // +
+    diag->exec();
+  }
+}
+
 void ExplorerTreeView::importServer() {
   QModelIndexList selected = selectedEqualTypeIndexes();
   for (QModelIndex ind : selected) {
@@ -970,7 +1190,16 @@ void ExplorerTreeView::editKey() {
     int result = loadDb->exec();
     if (result == QDialog::Accepted) {
       core::NDbKValue key = loadDb->key();
-      node->editValue(key.GetValue());
+      const bool delta_saves = server->GetType() == core::REDIS || server->GetType() == core::KEYDB;
+      proxy::ValueChangesCommands commands;
+      if (delta_saves && loadDb->changesCommands(&commands)) {
+        // only edited rows are sent, unchanged value is not rewritten at all
+        if (!commands.IsEmpty()) {
+          node->saveValueChanges(key.GetValue(), commands);
+        }
+      } else {
+        node->editValue(key.GetValue());
+      }
     }
   }
 }
@@ -989,6 +1218,52 @@ void ExplorerTreeView::viewKeys() {
   }
 }
 
+void ExplorerTreeView::analyzeKeyspace() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerDatabaseItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerDatabaseItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    proxy::IServerSPtr server = node->server();
+    auto diag = createDialog<KeyspaceAnalyzerDialog>(trAnalyzeKeyspaceTemplate_1S.arg(node->name()),
+                                                     GuiFactory::GetInstance().icon(server->GetType()), node->db(),
+                                                     this);  // +
+    diag->exec();
+  }
+}
+
+void ExplorerTreeView::setKeyspaceSync(bool enable) {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerDatabaseItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerDatabaseItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    node->setKeyspaceSync(enable);
+  }
+}
+
+void ExplorerTreeView::findBigKeys() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerDatabaseItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerDatabaseItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    proxy::IServerSPtr server = node->server();
+    auto diag = createDialog<BigKeysDialog>(trFindBigKeysTemplate_1S.arg(node->name()),
+                                            GuiFactory::GetInstance().icon(server->GetType()), node->db(), this);  // +
+    diag->exec();
+  }
+}
+
 void ExplorerTreeView::loadValue() {
   QModelIndexList selected = selectedEqualTypeIndexes();
   for (QModelIndex ind : selected) {
@@ -997,6 +1272,37 @@ void ExplorerTreeView::loadValue() {
       continue;
     }
 
+    // values are probed by STRLEN, elements count or XINFO first, huge ones are paged instead of loaded whole
+    proxy::IServerSPtr server = node->server();
+    const core::NDbKValue dbv = node->dbv();
+    if (server->LoadCachedValue(node->db()->db()->GetInfo(), dbv.GetKey())) {  // repeated view, no round trip
+      continue;
+    }
+
+    const common::Value::Type type = dbv.GetType();
+    const bool paged_reads = server->GetType() == core::REDIS || server->GetType() == core::KEYDB;
+    const bool maybe_string = type == common::Value::TYPE_STRING || type == common::Value::TYPE_NULL;
+    const bool is_collection = type == common::Value::TYPE_HASH || type == common::Value::TYPE_SET ||
+                               type == common::Value::TYPE_ZSET || type == common::Value::TYPE_ARRAY;
+    const bool is_stream = type == core::StreamValue::TYPE_STREAM;
+    if (paged_reads && maybe_string) {
+      proxy::events_info::LoadValueRangeRequest req(this, node->db()->db()->GetInfo(), dbv.GetKey(), 0, 0);
+      server->LoadValueRange(req);
+      continue;
+    }
+
+    if (paged_reads && is_collection) {
+      proxy::events_info::LoadValuePageRequest req(this, node->db()->db()->GetInfo(), dbv.GetKey(), type, 0, 0);
+      server->LoadValuePage(req);
+      continue;
+    }
+
+    if (paged_reads && is_stream) {
+      proxy::events_info::LoadStreamInfoRequest req(this, node->db()->db()->GetInfo(), dbv.GetKey());
+      server->LoadStreamInfo(req);
+      continue;
+    }
+
     node->loadValueFromDb();
   }
 }
@@ -1096,6 +1402,19 @@ void ExplorerTreeView::watchKey() {
   }
 }
 
+void ExplorerTreeView::stopWatchKey() {
+  QModelIndexList selected = selectedEqualTypeIndexes();
+  for (QModelIndex ind : selected) {
+    ExplorerKeyItem* node = common::qt::item<common::qt::gui::TreeItem*, ExplorerKeyItem*>(ind);
+    if (!node) {
+      DNOTREACHED();
+      continue;
+    }
+
+    node->stopWatchKey();
+  }
+}
+
 void ExplorerTreeView::setTTL() {
   QModelIndexList selected = selectedEqualTypeIndexes();
   for (QModelIndex ind : selected) {
@@ -1162,6 +1481,11 @@ void ExplorerTreeView::finishLoadDatabaseContent(const proxy::events_info::LoadD
   proxy::IServer* serv = qobject_cast<proxy::IServer*>(sender());
   CHECK(serv);
 
+  const bool server_filter_page = res.initiator() == this;
+  if (server_filter_page && !isActualServerFilter(res)) {  // page of replaced filter
+    return;
+  }
+
   proxy::events_info::LoadDatabaseContentResponse::keys_container_t keys = res.keys;
   const std::string ns = serv->GetNsSeparator();
   proxy::NsDisplayStrategy ns_strategy = serv->GetNsDisplayStrategy();
@@ -1171,6 +1495,26 @@ void ExplorerTreeView::finishLoadDatabaseContent(const proxy::events_info::LoadD
   }
 
   source_model_->updateDb(serv, res.inf);
+
+  if (!server_filter_page || res.cursor_out == 0) {
+    return;
+  }
+
+  size_t& loaded = server_filter_loaded_[serv];
+  loaded += keys.size();
+  if (loaded >= kServerFilterMaxKeys) {
+    return;
+  }
+
+  // stream next SCAN page into tree
+  proxy::events_info::LoadDatabaseContentRequest req(this, res.inf, res.pattern, res.keys_count, res.cursor_out,
+                                                     res.key_type);
+  serv->LoadDatabaseContent(req);
+}
+
+bool ExplorerTreeView::isActualServerFilter(const proxy::events_info::LoadDatabaseContentRequest& req) const {
+  return !server_filter_pattern_.empty() && req.pattern == server_filter_pattern_ &&
+         req.key_type == server_filter_type_;
 }
 
 void ExplorerTreeView::startExecuteCommand(const proxy::events_info::ExecuteInfoRequest& req) {
@@ -1181,6 +1525,84 @@ void ExplorerTreeView::finishExecuteCommand(const proxy::events_info::ExecuteInf
   UNUSED(res);
 }
 
+void ExplorerTreeView::finishLoadValueRange(const proxy::events_info::LoadValueRangeResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  proxy::IServer* serv = qobject_cast<proxy::IServer*>(sender());
+  CHECK(serv);
+
+  ExplorerKeyItem* node = source_model_->findKey(serv, res.inf, res.key);
+  if (!node) {
+    return;
+  }
+
+  common::Error err = res.errorInfo();
+  if (err || res.value_size < LargeValueDialog::min_value_size) {  // not a string or small enough for GET
+    node->loadValueFromDb();
+    return;
+  }
+
+  proxy::IServerSPtr server = node->server();
+  auto diag = createDialog<LargeValueDialog>(trLargeValueTemplate_1S.arg(node->name()),
+                                             GuiFactory::GetInstance().icon(server->GetType()), node->db()->db(),
+                                             res.key, res.value_size, this);  // +
+  diag->exec();
+}
+
+void ExplorerTreeView::finishLoadValuePage(const proxy::events_info::LoadValuePageResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  proxy::IServer* serv = qobject_cast<proxy::IServer*>(sender());
+  CHECK(serv);
+
+  ExplorerKeyItem* node = source_model_->findKey(serv, res.inf, res.key);
+  if (!node) {
+    return;
+  }
+
+  common::Error err = res.errorInfo();
+  if (err || res.total < CollectionValueDialog::min_elements_count) {
+    node->loadValueFromDb();
+    return;
+  }
+
+  proxy::IServerSPtr server = node->server();
+  auto diag = createDialog<CollectionValueDialog>(trLargeValueTemplate_1S.arg(node->name()),
+                                                  GuiFactory::GetInstance().icon(server->GetType()), node->db()->db(),
+                                                  res.key, res.type, this);  // +
+  diag->exec();
+}
+
+void ExplorerTreeView::finishLoadStreamInfo(const proxy::events_info::LoadStreamInfoResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  proxy::IServer* serv = qobject_cast<proxy::IServer*>(sender());
+  CHECK(serv);
+
+  ExplorerKeyItem* node = source_model_->findKey(serv, res.inf, res.key);
+  if (!node) {
+    return;
+  }
+
+  common::Error err = res.errorInfo();
+  if (err || res.info.length < StreamValueDialog::min_entries_count) {
+    node->loadValueFromDb();
+    return;
+  }
+
+  proxy::IServerSPtr server = node->server();
+  auto diag = createDialog<StreamValueDialog>(trLargeValueTemplate_1S.arg(node->name()),
+                                              GuiFactory::GetInstance().icon(server->GetType()), node->db()->db(),
+                                              res.key, res.info, this);  // +
+  diag->exec();
+}
+
 void ExplorerTreeView::createDatabase(core::IDataBaseInfoSPtr db) {
   proxy::IServer* serv = qobject_cast<proxy::IServer*>(sender());
   CHECK(serv);
@@ -1248,6 +1670,17 @@ void ExplorerTreeView::loadKey(core::IDataBaseInfoSPtr db, core::NDbKValue key)
   source_model_->updateValue(serv, db, key);
 }
 
+void ExplorerTreeView::changeKeys(core::IDataBaseInfoSPtr db, proxy::keyspace_changes_t changes) {
+  proxy::IServer* serv = qobject_cast<proxy::IServer*>(sender());
+  if (!serv) {
+    return;
+  }
+
+  const std::string ns = serv->GetNsSeparator();
+  const proxy::NsDisplayStrategy ns_strategy = serv->GetNsDisplayStrategy();
+  source_model_->applyKeysChanges(serv, db, changes, ns, ns_strategy);
+}
+
 void ExplorerTreeView::changeTTLKey(core::IDataBaseInfoSPtr db, core::NKey key, core::ttl_t ttl) {
   proxy::IServer* serv = qobject_cast<proxy::IServer*>(sender());
   CHECK(serv);
@@ -1290,6 +1723,9 @@ void ExplorerTreeView::syncWithServer(proxy::IServer* server) {
                  &ExplorerTreeView::finishLoadDatabaseContent));
   VERIFY(connect(server, &proxy::IServer::ExecuteStarted, this, &ExplorerTreeView::startExecuteCommand));
   VERIFY(connect(server, &proxy::IServer::ExecuteFinished, this, &ExplorerTreeView::finishExecuteCommand));
+  VERIFY(connect(server, &proxy::IServer::LoadValueRangeFinished, this, &ExplorerTreeView::finishLoadValueRange));
+  VERIFY(connect(server, &proxy::IServer::LoadValuePageFinished, this, &ExplorerTreeView::finishLoadValuePage));
+  VERIFY(connect(server, &proxy::IServer::LoadStreamInfoFinished, this, &ExplorerTreeView::finishLoadStreamInfo));
 
   VERIFY(connect(server, &proxy::IServer::DatabaseRemoved, this, &ExplorerTreeView::removeDatabase));
   VERIFY(connect(server, &proxy::IServer::DatabaseCreated, this, &ExplorerTreeView::createDatabase));
@@ -1300,6 +1736,7 @@ void ExplorerTreeView::syncWithServer(proxy::IServer* server) {
   VERIFY(connect(server, &proxy::IServer::KeyAdded, this, &ExplorerTreeView::addKey, Qt::DirectConnection));
   VERIFY(connect(server, &proxy::IServer::KeyRenamed, this, &ExplorerTreeView::renameKey, Qt::DirectConnection));
   VERIFY(connect(server, &proxy::IServer::KeyLoaded, this, &ExplorerTreeView::loadKey, Qt::DirectConnection));
+  VERIFY(connect(server, &proxy::IServer::KeysChanged, this, &ExplorerTreeView::changeKeys, Qt::DirectConnection));
   VERIFY(connect(server, &proxy::IServer::KeyTTLChanged, this, &ExplorerTreeView::changeTTLKey, Qt::DirectConnection));
 }
 
@@ -1316,6 +1753,9 @@ void ExplorerTreeView::unsyncWithServer(proxy::IServer* server) {
                     &ExplorerTreeView::finishLoadDatabaseContent));
   VERIFY(disconnect(server, &proxy::IServer::ExecuteStarted, this, &ExplorerTreeView::startExecuteCommand));
   VERIFY(disconnect(server, &proxy::IServer::ExecuteFinished, this, &ExplorerTreeView::finishExecuteCommand));
+  VERIFY(disconnect(server, &proxy::IServer::LoadValueRangeFinished, this, &ExplorerTreeView::finishLoadValueRange));
+  VERIFY(disconnect(server, &proxy::IServer::LoadValuePageFinished, this, &ExplorerTreeView::finishLoadValuePage));
+  VERIFY(disconnect(server, &proxy::IServer::LoadStreamInfoFinished, this, &ExplorerTreeView::finishLoadStreamInfo));
 
   VERIFY(disconnect(server, &proxy::IServer::DatabaseRemoved, this, &ExplorerTreeView::removeDatabase));
   VERIFY(disconnect(server, &proxy::IServer::DatabaseCreated, this, &ExplorerTreeView::createDatabase));
@@ -1326,6 +1766,7 @@ void ExplorerTreeView::unsyncWithServer(proxy::IServer* server) {
   VERIFY(disconnect(server, &proxy::IServer::KeyAdded, this, &ExplorerTreeView::addKey));
   VERIFY(disconnect(server, &proxy::IServer::KeyRenamed, this, &ExplorerTreeView::renameKey));
   VERIFY(disconnect(server, &proxy::IServer::KeyLoaded, this, &ExplorerTreeView::loadKey));
+  VERIFY(disconnect(server, &proxy::IServer::KeysChanged, this, &ExplorerTreeView::changeKeys));
   VERIFY(disconnect(server, &proxy::IServer::KeyTTLChanged, this, &ExplorerTreeView::changeTTLKey));
 }
 
@@ -18,9 +18,13 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include <QTreeView>
 
 #include "proxy/events/events_info.h"
+#include "proxy/keyspace_changes.h"
 #include "proxy/proxy_fwd.h"
 
 class QAction;
@@ -61,6 +65,7 @@ class ExplorerTreeView : public QTreeView {
 #endif
 
   void changeTextFilter(const QString& text);
+  void changeServerFilter(const QString& pattern, const QString& key_type);
 
  private Q_SLOTS:
   void showContextMenu(const QPoint& point);
@@ -69,12 +74,16 @@ class ExplorerTreeView : public QTreeView {
   void openConsole();
   void loadDatabases();
   void openInfoServerDialog();
+  void openBenchmarkDialog();
+  void openMassInsertDialog();
+  void viewCommandsLatency();
   void openPropertyServerDialog();
   void openHistoryServerDialog();
   void clearHistory();
   void closeServerConnection();
 #if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
   void closeClusterConnection();
+  void openClusterMassInsertDialog();
   void closeSentinelConnection();
 #endif
 
@@ -92,8 +101,12 @@ class ExplorerTreeView : public QTreeView {
   void createKey();
   void editKey();
   void viewKeys();
+  void analyzeKeyspace();
+  void findBigKeys();
+  void setKeyspaceSync(bool enable);
   void viewPubSub();
   void viewClientsMonitor();
+  void viewHotKeys();
 
   void deleteItem();  // branch or key
 
@@ -102,6 +115,7 @@ class ExplorerTreeView : public QTreeView {
   void renKey();
   void remKey();
   void watchKey();
+  void stopWatchKey();
   void setTTL();
   void removeTTL();
 
@@ -114,6 +128,10 @@ class ExplorerTreeView : public QTreeView {
   void startExecuteCommand(const proxy::events_info::ExecuteInfoRequest& req);
   void finishExecuteCommand(const proxy::events_info::ExecuteInfoResponse& res);
 
+  void finishLoadValueRange(const proxy::events_info::LoadValueRangeResponse& res);
+  void finishLoadValuePage(const proxy::events_info::LoadValuePageResponse& res);
+  void finishLoadStreamInfo(const proxy::events_info::LoadStreamInfoResponse& res);
+
   void createDatabase(core::IDataBaseInfoSPtr db);
   void removeDatabase(core::IDataBaseInfoSPtr db);
 
@@ -124,6 +142,7 @@ class ExplorerTreeView : public QTreeView {
   void renameKey(core::IDataBaseInfoSPtr db, core::NKey key, core::nkey_t new_name);
   void loadKey(core::IDataBaseInfoSPtr db, core::NDbKValue key);
   void changeTTLKey(core::IDataBaseInfoSPtr db, core::NKey key, core::ttl_t ttl);
+  void changeKeys(core::IDataBaseInfoSPtr db, proxy::keyspace_changes_t changes);
 
  protected:
   void changeEvent(QEvent* ev) override;
@@ -136,9 +155,14 @@ class ExplorerTreeView : public QTreeView {
 
   void retranslateUi();
   QModelIndexList selectedEqualTypeIndexes() const;
+  bool isActualServerFilter(const proxy::events_info::LoadDatabaseContentRequest& req) const;
 
   ExplorerTreeModel* source_model_;
   QSortFilterProxyModel* proxy_model_;
+
+  core::pattern_t server_filter_pattern_;  // empty when filtering on client side
+  std::string server_filter_type_;
+  std::map<proxy::IServer*, size_t> server_filter_loaded_;
 };
 
 }  // namespace gui
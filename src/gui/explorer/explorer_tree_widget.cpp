@@ -1,89 +1,152 @@
-/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
-
-    This file is part of FastoNoSQL.
-
-    FastoNoSQL is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    FastoNoSQL is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
-*/
-
-#include "gui/explorer/explorer_tree_widget.h"
-
-#include <QLineEdit>
-#include <QVBoxLayout>
-
-#include "gui/explorer/explorer_tree_view.h"
-#include "gui/gui_factory.h"
-
-#include "translations/global.h"
-
-namespace fastonosql {
-namespace gui {
-
-ExplorerTreeWidget::ExplorerTreeWidget(QWidget* parent) : base_class(parent) {
-  view_ = new ExplorerTreeView(this);
-  filter_edit_ = new QLineEdit;
-  filter_edit_->setClearButtonEnabled(true);
-  filter_edit_->addAction(GuiFactory::GetInstance().search16Icon(), QLineEdit::LeadingPosition);
-
-  VERIFY(connect(filter_edit_, &QLineEdit::textChanged, view_, &ExplorerTreeView::changeTextFilter));
-  VERIFY(connect(view_, &ExplorerTreeView::consoleOpened, this, &ExplorerTreeWidget::consoleOpened));
-  VERIFY(
-      connect(view_, &ExplorerTreeView::consoleOpenedAndExecute, this, &ExplorerTreeWidget::consoleOpenedAndExecute));
-  VERIFY(
-      connect(view_, &ExplorerTreeView::serverClosed, this, &ExplorerTreeWidget::serverClosed, Qt::DirectConnection));
-#if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
-  VERIFY(
-      connect(view_, &ExplorerTreeView::clusterClosed, this, &ExplorerTreeWidget::clusterClosed, Qt::DirectConnection));
-  VERIFY(connect(view_, &ExplorerTreeView::sentinelClosed, this, &ExplorerTreeWidget::sentinelClosed,
-                 Qt::DirectConnection));
-#endif
-
-  QVBoxLayout* main_layout = new QVBoxLayout;
-  main_layout->addWidget(view_);
-  main_layout->addWidget(filter_edit_);
-  setLayout(main_layout);
-}
-
-void ExplorerTreeWidget::addServer(proxy::IServerSPtr server) {
-  view_->addServer(server);
-}
-
-void ExplorerTreeWidget::removeServer(proxy::IServerSPtr server) {
-  view_->removeServer(server);
-}
-
-#if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
-void ExplorerTreeWidget::addSentinel(proxy::ISentinelSPtr sentinel) {
-  view_->addSentinel(sentinel);
-}
-
-void ExplorerTreeWidget::removeSentinel(proxy::ISentinelSPtr sentinel) {
-  view_->removeSentinel(sentinel);
-}
-
-void ExplorerTreeWidget::addCluster(proxy::IClusterSPtr cluster) {
-  view_->addCluster(cluster);
-}
-
-void ExplorerTreeWidget::removeCluster(proxy::IClusterSPtr cluster) {
-  view_->removeCluster(cluster);
-}
-#endif
-
-void ExplorerTreeWidget::retranslateUi() {
-  filter_edit_->setPlaceholderText(translations::trSearch + "...");
-  base_class::retranslateUi();
-}
-
-}  // namespace gui
-}  // namespace fastonosql
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/explorer/explorer_tree_widget.h"
+
+#include <QCheckBox>
+#include <QComboBox>
+#include <QHBoxLayout>
+#include <QLineEdit>
+#include <QVBoxLayout>
+
+#include "gui/explorer/explorer_tree_view.h"
+#include "gui/gui_factory.h"
+
+#include "translations/global.h"
+
+namespace {
+const QString trServerSide = QObject::tr("On server");
+const QString trServerSideToolTip =
+    QObject::tr("Match keys on server side with SCAN MATCH glob pattern, press Enter to apply");
+const QString trAllTypes = QObject::tr("All types");
+const QString trKeyTypeToolTip = QObject::tr("Match keys of type with SCAN TYPE, supported by Redis and KeyDB only");
+const char* const kKeyTypes[] = {"string", "list", "set", "zset", "hash", "stream"};
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+ExplorerTreeWidget::ExplorerTreeWidget(QWidget* parent) : base_class(parent) {
+  view_ = new ExplorerTreeView(this);
+  filter_edit_ = new QLineEdit;
+  filter_edit_->setClearButtonEnabled(true);
+  filter_edit_->addAction(GuiFactory::GetInstance().search16Icon(), QLineEdit::LeadingPosition);
+
+  VERIFY(connect(filter_edit_, &QLineEdit::textChanged, this, &ExplorerTreeWidget::changeTextFilter));
+  VERIFY(connect(filter_edit_, &QLineEdit::returnPressed, this, &ExplorerTreeWidget::applyServerFilter));
+
+  key_type_ = new QComboBox;
+  key_type_->addItem(trAllTypes, QString());
+  for (const char* type : kKeyTypes) {
+    key_type_->addItem(type, type);
+  }
+  key_type_->setEnabled(false);
+  typedef void (QComboBox::*curc)(int);
+  VERIFY(connect(key_type_, static_cast<curc>(&QComboBox::currentIndexChanged), this,
+                 &ExplorerTreeWidget::applyServerFilter));
+
+  server_filter_ = new QCheckBox;
+  VERIFY(connect(server_filter_, &QCheckBox::stateChanged, this, &ExplorerTreeWidget::changeFilterMode));
+  VERIFY(connect(view_, &ExplorerTreeView::consoleOpened, this, &ExplorerTreeWidget::consoleOpened));
+  VERIFY(
+      connect(view_, &ExplorerTreeView::consoleOpenedAndExecute, this, &ExplorerTreeWidget::consoleOpenedAndExecute));
+  VERIFY(
+      connect(view_, &ExplorerTreeView::serverClosed, this, &ExplorerTreeWidget::serverClosed, Qt::DirectConnection));
+#if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
+  VERIFY(
+      connect(view_, &ExplorerTreeView::clusterClosed, this, &ExplorerTreeWidget::clusterClosed, Qt::DirectConnection));
+  VERIFY(connect(view_, &ExplorerTreeView::sentinelClosed, this, &ExplorerTreeWidget::sentinelClosed,
+                 Qt::DirectConnection));
+#endif
+
+  QVBoxLayout* main_layout = new QVBoxLayout;
+  main_layout->addWidget(view_);
+  QHBoxLayout* filter_layout = new QHBoxLayout;
+  filter_layout->addWidget(filter_edit_);
+  filter_layout->addWidget(key_type_);
+  filter_layout->addWidget(server_filter_);
+  main_layout->addLayout(filter_layout);
+  setLayout(main_layout);
+}
+
+void ExplorerTreeWidget::changeTextFilter(const QString& text) {
+  if (!server_filter_->isChecked()) {
+    view_->changeTextFilter(text);
+    return;
+  }
+
+  if (text.isEmpty()) {  // server search applied only by Enter, but cleared immediately
+    view_->changeServerFilter(QString(), QString());
+  }
+}
+
+void ExplorerTreeWidget::changeFilterMode(int state) {
+  const bool server_side = state == Qt::Checked;
+  key_type_->setEnabled(server_side);
+  if (server_side) {
+    applyServerFilter();
+    return;
+  }
+
+  view_->changeTextFilter(filter_edit_->text());
+}
+
+void ExplorerTreeWidget::applyServerFilter() {
+  if (!server_filter_->isChecked()) {
+    return;
+  }
+
+  view_->changeServerFilter(filter_edit_->text(), key_type_->currentData().toString());
+}
+
+void ExplorerTreeWidget::addServer(proxy::IServerSPtr server) {
+  view_->addServer(server);
+}
+
+void ExplorerTreeWidget::removeServer(proxy::IServerSPtr server) {
+  view_->removeServer(server);
+}
+
+#if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
+void ExplorerTreeWidget::addSentinel(proxy::ISentinelSPtr sentinel) {
+  view_->addSentinel(sentinel);
+}
+
+void ExplorerTreeWidget::removeSentinel(proxy::ISentinelSPtr sentinel) {
+  view_->removeSentinel(sentinel);
+}
+
+void ExplorerTreeWidget::addCluster(proxy::IClusterSPtr cluster) {
+  view_->addCluster(cluster);
+}
+
+void ExplorerTreeWidget::removeCluster(proxy::IClusterSPtr cluster) {
+  view_->removeCluster(cluster);
+}
+#endif
+
+void ExplorerTreeWidget::retranslateUi() {
+  filter_edit_->setPlaceholderText(translations::trSearch + "...");
+  server_filter_->setText(trServerSide);
+  server_filter_->setToolTip(trServerSideToolTip);
+  key_type_->setToolTip(trKeyTypeToolTip);
+  base_class::retranslateUi();
+}
+
+}  // namespace gui
+}  // namespace fastonosql
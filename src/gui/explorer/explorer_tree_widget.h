@@ -22,6 +22,8 @@
 
 #include "proxy/proxy_fwd.h"
 
+class QCheckBox;
+class QComboBox;
 class QLineEdit;
 
 namespace fastonosql {
@@ -60,8 +62,15 @@ class ExplorerTreeWidget : public BaseWidget {
   explicit ExplorerTreeWidget(QWidget* parent = Q_NULLPTR);
   void retranslateUi() override;
 
+ private Q_SLOTS:
+  void changeTextFilter(const QString& text);
+  void changeFilterMode(int state);
+  void applyServerFilter();
+
  private:
   QLineEdit* filter_edit_;
+  QComboBox* key_type_;
+  QCheckBox* server_filter_;
   ExplorerTreeView* view_;
 };
 
@@ -0,0 +1,476 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/fast_codecs.h"
+
+#include <stdint.h>
+
+// FAST_CODECS_SCALAR_ONLY leaves only scalar code, benchmark uses it as baseline
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && \
+    !defined(FAST_CODECS_SCALAR_ONLY)
+#define FAST_CODECS_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+const char hex_lower_digits[] = "0123456789abcdef";
+const char hex_upper_digits[] = "0123456789ABCDEF";
+const char base64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+int HexValue(unsigned char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+
+  c |= 0x20;
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+
+  return -1;
+}
+
+int Base64Value(unsigned char c) {
+  if (c >= 'A' && c <= 'Z') {
+    return c - 'A';
+  } else if (c >= 'a' && c <= 'z') {
+    return c - 'a' + 26;
+  } else if (c >= '0' && c <= '9') {
+    return c - '0' + 52;
+  } else if (c == '+') {
+    return 62;
+  } else if (c == '/') {
+    return 63;
+  }
+
+  return -1;
+}
+
+void HexEncodeScalar(const unsigned char* in, size_t size, const char* digits, char* out) {
+  for (size_t i = 0; i < size; ++i) {
+    out[4 * i] = '\\';
+    out[4 * i + 1] = 'x';
+    out[4 * i + 2] = digits[in[i] >> 4];
+    out[4 * i + 3] = digits[in[i] & 0x0F];
+  }
+}
+
+// size is multiple of 4
+bool HexDecodeScalar(const char* in, size_t size, unsigned char* out) {
+  for (size_t i = 0; i < size; i += 4) {
+    if (in[i] != '\\' || in[i + 1] != 'x') {
+      return false;
+    }
+
+    const int hi = HexValue(in[i + 2]);
+    const int lo = HexValue(in[i + 3]);
+    if (hi < 0 || lo < 0) {
+      return false;
+    }
+    out[i / 4] = static_cast<unsigned char>((hi << 4) | lo);
+  }
+  return true;
+}
+
+void Base64EncodeScalar(const unsigned char* in, size_t size, char* out) {
+  size_t i = 0;
+  for (; i + 3 <= size; i += 3) {
+    const uint32_t triple = (in[i] << 16) | (in[i + 1] << 8) | in[i + 2];
+    *out++ = base64_alphabet[(triple >> 18) & 0x3F];
+    *out++ = base64_alphabet[(triple >> 12) & 0x3F];
+    *out++ = base64_alphabet[(triple >> 6) & 0x3F];
+    *out++ = base64_alphabet[triple & 0x3F];
+  }
+
+  const size_t rest = size - i;
+  if (rest) {
+    const uint32_t triple = (in[i] << 16) | (rest == 2 ? in[i + 1] << 8 : 0);
+    *out++ = base64_alphabet[(triple >> 18) & 0x3F];
+    *out++ = base64_alphabet[(triple >> 12) & 0x3F];
+    *out++ = rest == 2 ? base64_alphabet[(triple >> 6) & 0x3F] : '=';
+    *out++ = '=';
+  }
+}
+
+// size is multiple of 4
+bool Base64DecodeScalar(const char* in, size_t size, unsigned char* out, size_t* out_size) {
+  size_t written = 0;
+  for (size_t i = 0; i < size; i += 4) {
+    const bool is_last = i + 4 == size;
+    const int a = Base64Value(in[i]);
+    const int b = Base64Value(in[i + 1]);
+    if (a < 0 || b < 0) {
+      return false;
+    }
+
+    if (is_last && in[i + 2] == '=' && in[i + 3] == '=') {
+      out[written++] = static_cast<unsigned char>((a << 2) | (b >> 4));
+      break;
+    }
+
+    const int c = Base64Value(in[i + 2]);
+    if (c < 0) {
+      return false;
+    }
+
+    if (is_last && in[i + 3] == '=') {
+      out[written++] = static_cast<unsigned char>((a << 2) | (b >> 4));
+      out[written++] = static_cast<unsigned char>((b << 4) | (c >> 2));
+      break;
+    }
+
+    const int d = Base64Value(in[i + 3]);
+    if (d < 0) {
+      return false;
+    }
+
+    out[written++] = static_cast<unsigned char>((a << 2) | (b >> 4));
+    out[written++] = static_cast<unsigned char>((b << 4) | (c >> 2));
+    out[written++] = static_cast<unsigned char>((c << 6) | d);
+  }
+
+  *out_size = written;
+  return true;
+}
+
+#if defined(FAST_CODECS_X86)
+enum SimdLevel { kSimdNone = 0, kSimdSse41, kSimdAvx2 };
+
+SimdLevel DetectSimdLevel() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return kSimdAvx2;
+  } else if (__builtin_cpu_supports("sse4.1")) {
+    return kSimdSse41;
+  }
+  return kSimdNone;
+}
+
+SimdLevel GetSimdLevel() {
+  static const SimdLevel level = DetectSimdLevel();
+  return level;
+}
+
+// kernels return count of consumed input bytes, caller finishes the tail with scalar code
+
+__attribute__((target("sse4.1"))) size_t HexEncodeSse41(const unsigned char* in,
+                                                        size_t size,
+                                                        const char* digits,
+                                                        char* out) {
+  const __m128i lut = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+  const __m128i mask = _mm_set1_epi8(0x0F);
+  const __m128i prefix = _mm_set1_epi16('\\' | ('x' << 8));
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    const __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(v, 4), mask));
+    const __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(v, mask));
+    const __m128i first = _mm_unpacklo_epi8(hi, lo);
+    const __m128i second = _mm_unpackhi_epi8(hi, lo);
+    __m128i* dst = reinterpret_cast<__m128i*>(out + 4 * i);
+    _mm_storeu_si128(dst, _mm_unpacklo_epi16(prefix, first));
+    _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(prefix, first));
+    _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(prefix, second));
+    _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(prefix, second));
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) size_t HexEncodeAvx2(const unsigned char* in,
+                                                     size_t size,
+                                                     const char* digits,
+                                                     char* out) {
+  const __m128i lut128 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+  const __m256i lut = _mm256_inserti128_si256(_mm256_castsi128_si256(lut128), lut128, 1);
+  const __m256i mask = _mm256_set1_epi8(0x0F);
+  const __m256i prefix = _mm256_set1_epi16('\\' | ('x' << 8));
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+    const __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), mask));
+    const __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(v, mask));
+    // unpack works inside 128 bit lanes: first holds bytes 0-7 and 16-23, second 8-15 and 24-31
+    const __m256i first = _mm256_unpacklo_epi8(hi, lo);
+    const __m256i second = _mm256_unpackhi_epi8(hi, lo);
+    const __m256i first_lo = _mm256_unpacklo_epi16(prefix, first);
+    const __m256i first_hi = _mm256_unpackhi_epi16(prefix, first);
+    const __m256i second_lo = _mm256_unpacklo_epi16(prefix, second);
+    const __m256i second_hi = _mm256_unpackhi_epi16(prefix, second);
+    __m256i* dst = reinterpret_cast<__m256i*>(out + 4 * i);
+    _mm256_storeu_si256(dst, _mm256_permute2x128_si256(first_lo, first_hi, 0x20));
+    _mm256_storeu_si256(dst + 1, _mm256_permute2x128_si256(second_lo, second_hi, 0x20));
+    _mm256_storeu_si256(dst + 2, _mm256_permute2x128_si256(first_lo, first_hi, 0x31));
+    _mm256_storeu_si256(dst + 3, _mm256_permute2x128_si256(second_lo, second_hi, 0x31));
+  }
+  return i;
+}
+
+// hex digits of 4 "\xHH" groups in the low half, sets bits of invalid if some group has no "\x" prefix
+__attribute__((target("sse4.1"))) __m128i HexDigitsSse41(const char* in, __m128i* invalid) {
+  const __m128i prefix_mask = _mm_set1_epi32(0x0000FFFF);
+  const __m128i prefix = _mm_set1_epi32('\\' | ('x' << 8));
+  const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+  *invalid = _mm_or_si128(*invalid, _mm_xor_si128(_mm_and_si128(v, prefix_mask), prefix));
+  return _mm_shuffle_epi8(v, _mm_setr_epi8(2, 3, 6, 7, 10, 11, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1));
+}
+
+// nibble values of 16 hex chars, sets bits of invalid for non hex chars
+__attribute__((target("sse4.1"))) __m128i HexNibblesSse41(__m128i c, __m128i* invalid) {
+  const __m128i digit = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+  const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+  const __m128i letter = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+  const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+  *invalid = _mm_or_si128(*invalid, _mm_xor_si128(_mm_or_si128(is_digit, is_letter), _mm_set1_epi8(-1)));
+  return _mm_blendv_epi8(_mm_add_epi8(letter, _mm_set1_epi8(10)), digit, is_digit);
+}
+
+// 64 chars into 16 bytes per step, wide enough for memory bandwidth so there is no avx2 variant
+__attribute__((target("sse4.1"))) size_t HexDecodeSse41(const char* in, size_t size, unsigned char* out, bool* ok) {
+  const __m128i weights = _mm_set1_epi16(0x0110);  // high nibble * 16 + low nibble
+  size_t i = 0;
+  for (; i + 64 <= size; i += 64) {
+    __m128i invalid = _mm_setzero_si128();
+    const __m128i first_digits =
+        _mm_unpacklo_epi64(HexDigitsSse41(in + i, &invalid), HexDigitsSse41(in + i + 16, &invalid));
+    const __m128i second_digits =
+        _mm_unpacklo_epi64(HexDigitsSse41(in + i + 32, &invalid), HexDigitsSse41(in + i + 48, &invalid));
+    const __m128i first = HexNibblesSse41(first_digits, &invalid);
+    const __m128i second = HexNibblesSse41(second_digits, &invalid);
+    if (!_mm_testz_si128(invalid, invalid)) {
+      *ok = false;
+      return i;
+    }
+    const __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 4), bytes);
+  }
+  *ok = true;
+  return i;
+}
+
+// 6 bit indexes of 12 input bytes reshuffled into 4 byte groups, see Wojciech Mula base64 sse
+__attribute__((target("sse4.1"))) __m128i Base64IndexesSse41(__m128i in) {
+  in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+  const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+  const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(t1, t3);
+}
+
+__attribute__((target("sse4.1"))) __m128i Base64CharsSse41(__m128i indexes) {
+  const __m128i shift_lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  __m128i reduced = _mm_subs_epu8(indexes, _mm_set1_epi8(51));
+  const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indexes);
+  reduced = _mm_or_si128(reduced, _mm_and_si128(less, _mm_set1_epi8(13)));
+  return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, reduced), indexes);
+}
+
+__attribute__((target("sse4.1"))) size_t Base64EncodeSse41(const unsigned char* in, size_t size, char* out) {
+  size_t i = 0;
+  for (; i + 16 <= size; i += 12) {  // reads 16 bytes, encodes 12
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 3 * 4), Base64CharsSse41(Base64IndexesSse41(v)));
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) size_t Base64EncodeAvx2(const unsigned char* in, size_t size, char* out) {
+  const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4,
+                                           7, 6, 8, 7, 10, 9, 11, 10);
+  const __m128i shift_lut128 = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  const __m256i shift_lut = _mm256_inserti128_si256(_mm256_castsi128_si256(shift_lut128), shift_lut128, 1);
+  size_t i = 0;
+  for (; i + 28 <= size; i += 24) {  // 12 bytes per lane, second lane reads up to 28
+    const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 12));
+    __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+    v = _mm256_shuffle_epi8(v, shuffle);
+    const __m256i t0 = _mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i indexes = _mm256_or_si256(t1, t3);
+
+    __m256i reduced = _mm256_subs_epu8(indexes, _mm256_set1_epi8(51));
+    const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indexes);
+    reduced = _mm256_or_si256(reduced, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+    const __m256i chars = _mm256_add_epi8(_mm256_shuffle_epi8(shift_lut, reduced), indexes);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i / 3 * 4), chars);
+  }
+  return i;
+}
+
+// decodes 16 chars into 12 bytes in the low part of result, ok is false for non alphabet chars
+__attribute__((target("sse4.1"))) __m128i Base64DecodeBlockSse41(__m128i str, bool* ok) {
+  const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B,
+                                       0x1B, 0x1B, 0x1A);
+  const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                       0x10, 0x10, 0x10);
+  const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i mask_2f = _mm_set1_epi8(0x2F);
+
+  const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(str, 4), mask_2f);
+  const __m128i lo = _mm_shuffle_epi8(lut_lo, _mm_and_si128(str, mask_2f));
+  const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+  if (!_mm_testz_si128(lo, hi)) {
+    *ok = false;
+    return str;
+  }
+
+  const __m128i eq_2f = _mm_cmpeq_epi8(str, mask_2f);
+  const __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_2f, hi_nibbles));
+  const __m128i values = _mm_add_epi8(str, roll);
+  const __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  const __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+  *ok = true;
+  return _mm_shuffle_epi8(packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+// last quad with padding is always left for scalar code, stores write 4 bytes beyond decoded block
+__attribute__((target("sse4.1"))) size_t Base64DecodeSse41(const char* in, size_t size, unsigned char* out) {
+  size_t i = 0;
+  for (; i + 24 <= size; i += 16) {
+    bool ok = false;
+    const __m128i bytes = Base64DecodeBlockSse41(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)), &ok);
+    if (!ok) {
+      break;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 4 * 3), bytes);
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) size_t Base64DecodeAvx2(const char* in, size_t size, unsigned char* out) {
+  const __m128i lut_lo128 = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+                                          0x1B, 0x1B, 0x1B, 0x1A);
+  const __m128i lut_hi128 = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+                                          0x10, 0x10, 0x10, 0x10);
+  const __m128i lut_roll128 = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i pack_shuffle128 = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  const __m256i lut_lo = _mm256_inserti128_si256(_mm256_castsi128_si256(lut_lo128), lut_lo128, 1);
+  const __m256i lut_hi = _mm256_inserti128_si256(_mm256_castsi128_si256(lut_hi128), lut_hi128, 1);
+  const __m256i lut_roll = _mm256_inserti128_si256(_mm256_castsi128_si256(lut_roll128), lut_roll128, 1);
+  const __m256i pack_shuffle = _mm256_inserti128_si256(_mm256_castsi128_si256(pack_shuffle128), pack_shuffle128, 1);
+  const __m256i mask_2f = _mm256_set1_epi8(0x2F);
+
+  size_t i = 0;
+  for (; i + 48 <= size; i += 32) {
+    const __m256i str = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+    const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask_2f);
+    const __m256i lo = _mm256_shuffle_epi8(lut_lo, _mm256_and_si256(str, mask_2f));
+    const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+    if (!_mm256_testz_si256(lo, hi)) {
+      break;
+    }
+
+    const __m256i eq_2f = _mm256_cmpeq_epi8(str, mask_2f);
+    const __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2f, hi_nibbles));
+    const __m256i values = _mm256_add_epi8(str, roll);
+    const __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    const __m256i packed = _mm256_shuffle_epi8(_mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000)), pack_shuffle);
+    // 12 bytes in each lane, join them
+    const __m256i bytes = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i / 4 * 3), bytes);
+  }
+  return i;
+}
+#endif
+
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+void hex_encode(const unsigned char* in, size_t size, bool is_lower, char* out) {
+  const char* digits = is_lower ? hex_lower_digits : hex_upper_digits;
+  size_t done = 0;
+#if defined(FAST_CODECS_X86)
+  const SimdLevel level = GetSimdLevel();
+  if (level == kSimdAvx2) {
+    done = HexEncodeAvx2(in, size, digits, out);
+  } else if (level == kSimdSse41) {
+    done = HexEncodeSse41(in, size, digits, out);
+  }
+#endif
+  HexEncodeScalar(in + done, size - done, digits, out + 4 * done);
+}
+
+bool hex_decode(const char* in, size_t size, unsigned char* out) {
+  if (size % 4) {
+    return false;
+  }
+
+  size_t done = 0;
+#if defined(FAST_CODECS_X86)
+  if (GetSimdLevel() != kSimdNone) {
+    bool ok = true;
+    done = HexDecodeSse41(in, size, out, &ok);
+    if (!ok) {
+      return false;
+    }
+  }
+#endif
+  return HexDecodeScalar(in + done, size - done, out + done / 4);
+}
+
+size_t base64_encoded_size(size_t size) {
+  return (size + 2) / 3 * 4;
+}
+
+void base64_encode(const unsigned char* in, size_t size, char* out) {
+  size_t done = 0;
+#if defined(FAST_CODECS_X86)
+  const SimdLevel level = GetSimdLevel();
+  if (level == kSimdAvx2) {
+    done = Base64EncodeAvx2(in, size, out);
+  } else if (level == kSimdSse41) {
+    done = Base64EncodeSse41(in, size, out);
+  }
+#endif
+  Base64EncodeScalar(in + done, size - done, out + done / 3 * 4);
+}
+
+bool base64_decode(const char* in, size_t size, unsigned char* out, size_t* out_size) {
+  if (size % 4 || !out_size) {
+    return false;
+  }
+
+  size_t done = 0;
+#if defined(FAST_CODECS_X86)
+  const SimdLevel level = GetSimdLevel();
+  if (level == kSimdAvx2) {
+    done = Base64DecodeAvx2(in, size, out);
+  } else if (level == kSimdSse41) {
+    done = Base64DecodeSse41(in, size, out);
+  }
+#endif
+  // invalid block stops vector loop, scalar code reports it
+  size_t tail_size = 0;
+  if (!Base64DecodeScalar(in + done, size - done, out + done / 4 * 3, &tail_size)) {
+    return false;
+  }
+
+  *out_size = done / 4 * 3 + tail_size;
+  return true;
+}
+
+}  // namespace gui
+}  // namespace fastonosql
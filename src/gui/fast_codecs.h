@@ -0,0 +1,39 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+
+namespace fastonosql {
+namespace gui {
+
+// hex and base64 kernels used by text converters, AVX2 or SSE4.1 when cpu supports them, scalar otherwise
+
+// "\xHH" per byte like common::XHexEDcoder, out has 4 * size bytes
+void hex_encode(const unsigned char* in, size_t size, bool is_lower, char* out);
+bool hex_decode(const char* in, size_t size, unsigned char* out);  // digits of any case, out has size / 4 bytes
+
+size_t base64_encoded_size(size_t size);
+void base64_encode(const unsigned char* in, size_t size, char* out);  // padded, out has base64_encoded_size bytes
+
+// strict: size multiple of 4, padding only at the end, no whitespaces; out has size / 4 * 3 bytes
+bool base64_decode(const char* in, size_t size, unsigned char* out, size_t* out_size);
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -248,7 +248,8 @@ MainWindow::MainWindow() : QMainWindow() {
 
   LogTabWidget* log = new LogTabWidget;
   VERIFY(connect(&common::qt::Logger::GetInstance(), &common::qt::Logger::printed, log, &LogTabWidget::addLogMessage));
-  VERIFY(connect(&proxy::CommandLogger::GetInstance(), &proxy::CommandLogger::Printed, log, &LogTabWidget::addCommand));
+  VERIFY(
+      connect(&proxy::CommandLogger::GetInstance(), &proxy::CommandLogger::Printed, log, &LogTabWidget::addCommands));
   SET_LOG_WATCHER(&LogWatcherRedirect);
   log_dock_ = new QDockWidget;
   logs_action_ = log_dock_->toggleViewAction();
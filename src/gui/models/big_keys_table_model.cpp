@@ -0,0 +1,169 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/big_keys_table_model.h"
+
+#include <algorithm>
+
+#include <QColor>
+#include <QIcon>
+
+#include <common/qt/utils_qt.h>
+
+#include "gui/gui_factory.h"
+#include "gui/models/items/big_key_table_item.h"
+
+#include "translations/global.h"
+
+namespace {
+const QString trElements = QObject::tr("Elements");
+const QString trMemoryBytes = QObject::tr("Memory, bytes");
+
+std::string GetRawKey(const fastonosql::proxy::NDbKeyStat& stat) {
+  const auto data = stat.GetKey().GetKey().GetData();
+  return std::string(data.begin(), data.end());
+}
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+BigKeysTableModel::BigKeysTableModel(QObject* parent)
+    : TableModel(parent), heaps_(), kept_keys_(), keys_per_type_(0), rank_(kRankByMemory) {}
+
+QVariant BigKeysTableModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid()) {
+    return QVariant();
+  }
+
+  BigKeyTableItem* node = common::qt::item<common::qt::gui::TableItem*, BigKeyTableItem*>(index);
+  if (!node) {
+    return QVariant();
+  }
+
+  int col = index.column();
+  if (role == Qt::DecorationRole && col == kKey) {
+    return GuiFactory::GetInstance().icon(node->type());
+  }
+
+  if (role == Qt::TextColorRole && col == kType) {
+    return QColor(Qt::gray);
+  }
+
+  QVariant result;
+  if (role == Qt::DisplayRole) {
+    const proxy::NDbKeyStat stat = node->stat();
+    if (col == kKey) {
+      result = node->keyString();
+    } else if (col == kType) {
+      result = node->typeText();
+    } else if (col == kElements) {
+      result = static_cast<qulonglong>(stat.GetElementsCount());
+    } else if (col == kMemory) {
+      result = static_cast<qulonglong>(stat.GetMemoryUsage());
+    } else if (col == kTTL) {
+      result = static_cast<qlonglong>(stat.GetKey().GetTTL());
+    }
+  }
+
+  return result;
+}
+
+QVariant BigKeysTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+  if (role != Qt::DisplayRole) {
+    return QVariant();
+  }
+
+  if (orientation == Qt::Horizontal) {
+    if (section == kKey) {
+      return translations::trKey;
+    } else if (section == kType) {
+      return translations::trType;
+    } else if (section == kElements) {
+      return trElements;
+    } else if (section == kMemory) {
+      return trMemoryBytes;
+    } else if (section == kTTL) {
+      return "TTL";
+    }
+  }
+
+  return TableModel::headerData(section, orientation, role);
+}
+
+int BigKeysTableModel::columnCount(const QModelIndex& parent) const {
+  UNUSED(parent);
+
+  return kCountColumns;
+}
+
+void BigKeysTableModel::clear() {
+  beginResetModel();
+  clearData();
+  heaps_.clear();
+  kept_keys_.clear();
+  endResetModel();
+}
+
+void BigKeysTableModel::reset(size_t keys_per_type, eRank rank) {
+  clear();
+  keys_per_type_ = keys_per_type;
+  rank_ = rank;
+}
+
+void BigKeysTableModel::offerKey(const proxy::NDbKeyStat& stat) {
+  if (keys_per_type_ == 0) {
+    return;
+  }
+
+  const auto greater = [this](const BigKeyTableItem* left, const BigKeyTableItem* right) {
+    return rankValue(left->stat()) > rankValue(right->stat());
+  };
+
+  std::set<std::string>& kept = kept_keys_[stat.GetType()];
+  const std::string raw_key = GetRawKey(stat);
+  if (kept.find(raw_key) != kept.end()) {
+    return;
+  }
+
+  heap_t& heap = heaps_[stat.GetType()];
+  if (heap.size() >= keys_per_type_) {
+    if (rankValue(stat) <= rankValue(heap.front()->stat())) {
+      return;
+    }
+
+    std::pop_heap(heap.begin(), heap.end(), greater);
+    BigKeyTableItem* evicted = heap.back();
+    heap.pop_back();
+    kept.erase(GetRawKey(evicted->stat()));
+    removeItem(evicted);
+  }
+
+  BigKeyTableItem* item = new BigKeyTableItem(stat);
+  insertItem(item);
+  heap.push_back(item);
+  std::push_heap(heap.begin(), heap.end(), greater);
+  kept.insert(raw_key);
+}
+
+uint64_t BigKeysTableModel::rankValue(const proxy::NDbKeyStat& stat) const {
+  return rank_ == kRankByElements ? stat.GetElementsCount() : stat.GetMemoryUsage();
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,66 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <common/qt/gui/base/table_model.h>
+
+#include "proxy/db_key_stat.h"
+
+namespace fastonosql {
+namespace gui {
+
+class BigKeyTableItem;
+
+// keeps only biggest keys of every type, memory doesn't depend on scanned keyspace size
+class BigKeysTableModel : public common::qt::gui::TableModel {
+  Q_OBJECT
+
+ public:
+  enum eColumn { kKey = 0, kType = 1, kElements = 2, kMemory = 3, kTTL = 4, kCountColumns = 5 };
+  enum eRank { kRankByMemory = 0, kRankByElements = 1 };
+
+  explicit BigKeysTableModel(QObject* parent = Q_NULLPTR);
+
+  QVariant data(const QModelIndex& index, int role) const override;
+  QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
+
+  int columnCount(const QModelIndex& parent) const override;
+  void clear();
+
+  void reset(size_t keys_per_type, eRank rank);
+  void offerKey(const proxy::NDbKeyStat& stat);
+
+ private:
+  typedef std::vector<BigKeyTableItem*> heap_t;  // min-heap by rank, front is the smallest kept key
+
+  uint64_t rankValue(const proxy::NDbKeyStat& stat) const;
+
+  std::map<common::Value::Type, heap_t> heaps_;
+  std::map<common::Value::Type, std::set<std::string>> kept_keys_;  // SCAN returns key again during rehash
+  size_t keys_per_type_;
+  eRank rank_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
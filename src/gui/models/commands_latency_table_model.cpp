@@ -0,0 +1,123 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/commands_latency_table_model.h"
+
+#include <common/qt/convert2string.h>
+#include <common/qt/utils_qt.h>
+
+#include "gui/models/items/command_latency_table_item.h"
+
+namespace {
+const QString trCommand = QObject::tr("Command");
+const QString trCalls = QObject::tr("Calls");
+const QString trP50 = QObject::tr("p50, usec");
+const QString trP90 = QObject::tr("p90, usec");
+const QString trP99 = QObject::tr("p99, usec");
+const QString trP999 = QObject::tr("p99.9, usec");
+const QString trMax = QObject::tr("Max, usec");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+CommandsLatencyTableModel::CommandsLatencyTableModel(QObject* parent) : TableModel(parent) {}
+
+QVariant CommandsLatencyTableModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid()) {
+    return QVariant();
+  }
+
+  CommandLatencyTableItem* node = common::qt::item<common::qt::gui::TableItem*, CommandLatencyTableItem*>(index);
+  if (!node) {
+    return QVariant();
+  }
+
+  int col = index.column();
+  QVariant result;
+  if (role == Qt::DisplayRole) {
+    const proxy::ValueHistogram latency = node->latency();
+    if (col == kCommand) {
+      result = node->command();
+    } else if (col == kCalls) {
+      result = static_cast<qulonglong>(latency.GetCount());
+    } else if (col == kP50) {
+      result = static_cast<qulonglong>(latency.GetPercentile(50));
+    } else if (col == kP90) {
+      result = static_cast<qulonglong>(latency.GetPercentile(90));
+    } else if (col == kP99) {
+      result = static_cast<qulonglong>(latency.GetPercentile(99));
+    } else if (col == kP999) {
+      result = static_cast<qulonglong>(latency.GetPercentile(99.9));
+    } else if (col == kMax) {
+      result = static_cast<qulonglong>(latency.GetMax());
+    }
+  }
+
+  return result;
+}
+
+QVariant CommandsLatencyTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+  if (role != Qt::DisplayRole) {
+    return QVariant();
+  }
+
+  if (orientation == Qt::Horizontal) {
+    if (section == kCommand) {
+      return trCommand;
+    } else if (section == kCalls) {
+      return trCalls;
+    } else if (section == kP50) {
+      return trP50;
+    } else if (section == kP90) {
+      return trP90;
+    } else if (section == kP99) {
+      return trP99;
+    } else if (section == kP999) {
+      return trP999;
+    } else if (section == kMax) {
+      return trMax;
+    }
+  }
+
+  return TableModel::headerData(section, orientation, role);
+}
+
+int CommandsLatencyTableModel::columnCount(const QModelIndex& parent) const {
+  UNUSED(parent);
+
+  return kCountColumns;
+}
+
+void CommandsLatencyTableModel::clear() {
+  beginResetModel();
+  clearData();
+  endResetModel();
+}
+
+void CommandsLatencyTableModel::setLatency(const proxy::CommandsLatencyStats::snapshot_t& snapshot) {
+  clear();
+  for (const auto& command : snapshot) {
+    QString qcommand;
+    common::ConvertFromString(command.first, &qcommand);
+    insertItem(new CommandLatencyTableItem(qcommand, command.second));
+  }
+}
+
+}  // namespace gui
+}  // namespace fastonosql
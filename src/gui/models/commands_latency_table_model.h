@@ -0,0 +1,46 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <common/qt/gui/base/table_model.h>
+
+#include "proxy/commands_latency_stats.h"
+
+namespace fastonosql {
+namespace gui {
+
+class CommandsLatencyTableModel : public common::qt::gui::TableModel {
+  Q_OBJECT
+
+ public:
+  enum eColumn { kCommand = 0, kCalls = 1, kP50 = 2, kP90 = 3, kP99 = 4, kP999 = 5, kMax = 6, kCountColumns = 7 };
+
+  explicit CommandsLatencyTableModel(QObject* parent = Q_NULLPTR);
+
+  QVariant data(const QModelIndex& index, int role) const override;
+  QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
+
+  int columnCount(const QModelIndex& parent) const override;
+  void clear();
+
+  void setLatency(const proxy::CommandsLatencyStats::snapshot_t& snapshot);
+};
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -18,6 +18,7 @@
 
 #include "gui/models/explorer_tree_model.h"
 
+#include <functional>
 #include <string>
 
 #include <QIcon>
@@ -482,6 +483,42 @@ void ExplorerTreeModel::updateValue(proxy::IServer* server, core::IDataBaseInfoS
   }
 }
 
+void ExplorerTreeModel::applyKeysChanges(proxy::IServer* server,
+                                         core::IDataBaseInfoSPtr db,
+                                         const proxy::keyspace_changes_t& changes,
+                                         const std::string& ns_separator,
+                                         proxy::NsDisplayStrategy ns_strategy) {
+  for (const proxy::KeyspaceChange& change : changes) {
+    const core::NKey key = change.key.GetKey();
+    if (change.type == proxy::KeyspaceChange::ADDED) {
+      addKey(server, db, change.key, ns_separator, ns_strategy);
+    } else if (change.type == proxy::KeyspaceChange::REMOVED) {
+      removeKey(server, db, key);
+    } else if (change.type == proxy::KeyspaceChange::RENAMED) {
+      core::NKey new_key = key;
+      new_key.SetKey(change.new_name);
+      renameKey(server, db, key, new_key, ns_separator, ns_strategy);
+    }
+  }
+}
+
+ExplorerKeyItem* ExplorerTreeModel::findKey(proxy::IServer* server,
+                                            core::IDataBaseInfoSPtr db,
+                                            const core::NKey& key) const {
+  ExplorerServerItem* parent = findServerItem(server);
+  if (!parent) {
+    return nullptr;
+  }
+
+  int db_index = 0;
+  ExplorerDatabaseItem* dbs = findDatabaseItem(parent, db, &db_index);
+  if (!dbs) {
+    return nullptr;
+  }
+
+  return findKeyItem(dbs, key);
+}
+
 void ExplorerTreeModel::removeAllKeys(proxy::IServer* server, core::IDataBaseInfoSPtr db) {
   ExplorerServerItem* parent = findServerItem(server);
   if (!parent) {
@@ -498,6 +535,26 @@ void ExplorerTreeModel::removeAllKeys(proxy::IServer* server, core::IDataBaseInf
   removeAllItems(parentdb);
 }
 
+std::vector<ExplorerDatabaseItem*> ExplorerTreeModel::findDefaultDatabaseItems() const {
+  std::vector<ExplorerDatabaseItem*> result;
+  std::function<void(common::qt::gui::TreeItem*)> collect = [&result, &collect](common::qt::gui::TreeItem* parent) {
+    for (size_t i = 0; i < parent->childrenCount(); ++i) {
+      IExplorerTreeItem* item = static_cast<IExplorerTreeItem*>(parent->child(i));
+      if (item->type() == IExplorerTreeItem::eDatabase) {
+        ExplorerDatabaseItem* db_item = static_cast<ExplorerDatabaseItem*>(item);
+        if (db_item->isDefault()) {
+          result.push_back(db_item);
+        }
+      } else if (item->type() != IExplorerTreeItem::eNamespace && item->type() != IExplorerTreeItem::eKey) {
+        collect(item);  // servers inside clusters and sentinels
+      }
+    }
+  };
+
+  collect(root());
+  return result;
+}
+
 #if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
 ExplorerClusterItem* ExplorerTreeModel::findClusterItem(proxy::IClusterSPtr cl) {
   common::qt::gui::TreeItem* parent = root();
@@ -24,6 +24,7 @@
 #include <common/qt/gui/base/tree_model.h>
 
 #include "proxy/database/idatabase.h"
+#include "proxy/keyspace_changes.h"
 #include "proxy/proxy_fwd.h"
 #include "proxy/types.h"
 
@@ -87,8 +88,16 @@ class ExplorerTreeModel : public common::qt::gui::TreeModel {
                  const core::NKey& old_key,
                  const core::NKey& new_key);
   void updateValue(proxy::IServer* server, core::IDataBaseInfoSPtr db, const core::NDbKValue& dbv);
+  void applyKeysChanges(proxy::IServer* server,
+                        core::IDataBaseInfoSPtr db,
+                        const proxy::keyspace_changes_t& changes,
+                        const std::string& ns_separator,
+                        proxy::NsDisplayStrategy ns_strategy);
   void removeAllKeys(proxy::IServer* server, core::IDataBaseInfoSPtr db);
 
+  std::vector<ExplorerDatabaseItem*> findDefaultDatabaseItems() const;
+  ExplorerKeyItem* findKey(proxy::IServer* server, core::IDataBaseInfoSPtr db, const core::NKey& key) const;
+
  private:
 #if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
   ExplorerClusterItem* findClusterItem(proxy::IClusterSPtr cl);
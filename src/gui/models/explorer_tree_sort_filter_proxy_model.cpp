@@ -40,24 +40,7 @@ bool ExplorerTreeSortFilterProxyModel::lessThan(const QModelIndex& left, const Q
     return true;
   }
 
-  if (rnode->type() == IExplorerTreeItem::eDatabase && lnode->type() == IExplorerTreeItem::eDatabase) {
-    QString leftString = lnode->name();
-    QString rightString = rnode->name();
-
-    bool lok, rok;
-    int lint = leftString.toInt(&lok);
-    int rint = rightString.toInt(&rok);
-    if (lok && rok) {
-      return lint < rint;
-    }
-
-    return QString::localeAwareCompare(leftString, rightString) < 0;
-  }
-
-  QString leftString = lnode->name();
-  QString rightString = rnode->name();
-
-  return QString::localeAwareCompare(leftString, rightString) < 0;
+  return lnode->sortKey().compare(rnode->sortKey()) < 0;
 }
 
 bool ExplorerTreeSortFilterProxyModel::filterAcceptsRow(int source_row, const QModelIndex& source_parent) const {
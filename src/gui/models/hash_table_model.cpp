@@ -29,7 +29,15 @@ namespace fastonosql {
 namespace gui {
 
 HashTableModel::HashTableModel(QObject* parent)
-    : common::qt::gui::TableModel(parent), first_column_name_(), second_column_name_() {
+    : common::qt::gui::TableModel(parent),
+      first_column_name_(),
+      second_column_name_(),
+      paged_(false),
+      fetching_(false),
+      at_end_(false),
+      loaded_(0),
+      total_(0),
+      removed_() {
   insertItem(createEmptyRow());
 }
 
@@ -126,6 +134,11 @@ void HashTableModel::clear() {
   beginResetModel();
   clearData();
   insertItem(createEmptyRow());
+  fetching_ = false;
+  at_end_ = false;
+  loaded_ = 0;
+  total_ = 0;
+  removed_.clear();
   endResetModel();
 }
 
@@ -179,6 +192,10 @@ void HashTableModel::removeRow(int row) {
   size_t stabled_index_row = static_cast<size_t>(row);
   beginRemoveRows(QModelIndex(), row, row);
   common::qt::gui::TableItem* child = data_[stabled_index_row];
+  KeyValueTableItem* node = static_cast<KeyValueTableItem*>(child);
+  if (node->isStored()) {
+    removed_.push_back({node->storedKey(), node->storedValue(), node->key(), node->value()});
+  }
   data_.erase(data_.begin() + row);
   delete child;
   endRemoveRows();
@@ -192,6 +209,84 @@ void HashTableModel::setSecondColumnName(const QString& name) {
   second_column_name_ = name;
 }
 
+void HashTableModel::setPaged(bool paged) {
+  paged_ = paged;
+}
+
+bool HashTableModel::isPaged() const {
+  return paged_;
+}
+
+void HashTableModel::appendPage(const std::vector<row_t>& rows, uint64_t total, bool is_last) {
+  fetching_ = false;
+  at_end_ = is_last;
+  total_ = total;
+  if (rows.empty()) {
+    return;
+  }
+
+  // before empty add row
+  const int first = static_cast<int>(data_.size() - 1);
+  beginInsertRows(QModelIndex(), first, first + static_cast<int>(rows.size()) - 1);
+  std::vector<common::qt::gui::TableItem*> items;
+  items.reserve(rows.size());
+  for (const row_t& row : rows) {
+    KeyValueTableItem* item = new KeyValueTableItem(row.first, row.second, KeyValueTableItem::RemoveAction);
+    item->setStored();
+    items.push_back(item);
+  }
+  data_.insert(data_.end() - 1, items.begin(), items.end());
+  loaded_ += rows.size();
+  endInsertRows();
+}
+
+void HashTableModel::stopFetch() {
+  fetching_ = false;
+  at_end_ = true;
+}
+
+uint64_t HashTableModel::loadedCount() const {
+  return loaded_;
+}
+
+uint64_t HashTableModel::totalCount() const {
+  return total_;
+}
+
+bool HashTableModel::isFullyLoaded() const {
+  return at_end_;
+}
+
+void HashTableModel::changes(std::vector<RowChange>* removed,
+                             std::vector<RowChange>* edited,
+                             std::vector<row_t>* added) const {
+  *removed = removed_;
+  for (size_t i = 0; i < data_.size() - 1; ++i) {
+    KeyValueTableItem* node = static_cast<KeyValueTableItem*>(data_[i]);
+    if (!node->isStored()) {
+      added->push_back(row_t(node->key(), node->value()));
+      continue;
+    }
+
+    if (node->key() != node->storedKey() || node->value() != node->storedValue()) {
+      edited->push_back({node->storedKey(), node->storedValue(), node->key(), node->value()});
+    }
+  }
+}
+
+bool HashTableModel::canFetchMore(const QModelIndex& parent) const {
+  return !parent.isValid() && paged_ && !fetching_ && !at_end_;
+}
+
+void HashTableModel::fetchMore(const QModelIndex& parent) {
+  if (!canFetchMore(parent)) {
+    return;
+  }
+
+  fetching_ = true;
+  emit fetchMoreRequested();
+}
+
 common::qt::gui::TableItem* HashTableModel::createEmptyRow() const {
   return new KeyValueTableItem(KeyValueTableItem::key_t(), KeyValueTableItem::value_t(), KeyValueTableItem::AddAction);
 }
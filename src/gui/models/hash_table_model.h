@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include <common/qt/gui/base/table_model.h>
 #include <common/value.h>
 
@@ -30,7 +33,14 @@ class HashTableModel : public common::qt::gui::TableModel {
  public:
   typedef common::Value::string_t key_t;
   typedef common::Value::string_t value_t;
+  typedef std::pair<key_t, value_t> row_t;
   enum eColumn : uint8_t { kKey = 0, kValue = 1, kAction = 2, kCountColumns = 3 };
+  struct RowChange {
+    key_t stored_key;
+    value_t stored_value;
+    key_t key;
+    value_t value;
+  };
 
   explicit HashTableModel(QObject* parent = Q_NULLPTR);
 
@@ -51,6 +61,23 @@ class HashTableModel : public common::qt::gui::TableModel {
   void setFirstColumnName(const QString& name);
   void setSecondColumnName(const QString& name);
 
+  // paged mode: rows are appended by pages from database when view asks for more,
+  // only loaded rows are resident and changes are kept against stored rows
+  void setPaged(bool paged);
+  bool isPaged() const;
+  void appendPage(const std::vector<row_t>& rows, uint64_t total, bool is_last);
+  void stopFetch();
+  uint64_t loadedCount() const;
+  uint64_t totalCount() const;
+  bool isFullyLoaded() const;
+  void changes(std::vector<RowChange>* removed, std::vector<RowChange>* edited, std::vector<row_t>* added) const;
+
+  bool canFetchMore(const QModelIndex& parent) const override;
+  void fetchMore(const QModelIndex& parent) override;
+
+ Q_SIGNALS:
+  void fetchMoreRequested();
+
  private:
   using TableModel::insertItem;
   using TableModel::removeItem;
@@ -59,6 +86,13 @@ class HashTableModel : public common::qt::gui::TableModel {
 
   QString first_column_name_;
   QString second_column_name_;
+
+  bool paged_;
+  bool fetching_;
+  bool at_end_;
+  uint64_t loaded_;
+  uint64_t total_;
+  std::vector<RowChange> removed_;
 };
 
 }  // namespace gui
@@ -0,0 +1,125 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/hot_keys_table_model.h"
+
+#include <map>
+#include <string>
+
+#include <common/qt/convert2string.h>
+#include <common/qt/utils_qt.h>
+
+#include "gui/models/items/hot_key_table_item.h"
+
+#include "translations/global.h"
+
+namespace {
+const QString trNamespace = QObject::tr("Namespace");
+const QString trCommand = QObject::tr("Command");
+const QString trHits = QObject::tr("Hits (estimated)");
+const QString trOpsPerSec = QObject::tr("Ops/sec");
+const QString trWithoutNamespace = QObject::tr("(without namespace)");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+HotKeysTableModel::HotKeysTableModel(eKind kind, QObject* parent) : TableModel(parent), kind_(kind) {}
+
+QVariant HotKeysTableModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid()) {
+    return QVariant();
+  }
+
+  HotKeyTableItem* node = common::qt::item<common::qt::gui::TableItem*, HotKeyTableItem*>(index);
+  if (!node) {
+    return QVariant();
+  }
+
+  int col = index.column();
+  QVariant result;
+  if (role == Qt::DisplayRole) {
+    if (col == kName) {
+      const QString name = node->name();
+      result = kind_ == kNamespaces && name.isEmpty() ? trWithoutNamespace : name;
+    } else if (col == kHits) {
+      result = static_cast<qulonglong>(node->hits());
+    } else if (col == kOpsPerSec) {
+      result = node->opsPerSec();
+    }
+  }
+
+  return result;
+}
+
+QVariant HotKeysTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+  if (role != Qt::DisplayRole) {
+    return QVariant();
+  }
+
+  if (orientation == Qt::Horizontal) {
+    if (section == kName) {
+      if (kind_ == kNamespaces) {
+        return trNamespace;
+      } else if (kind_ == kCommands) {
+        return trCommand;
+      }
+      return translations::trKey;
+    } else if (section == kHits) {
+      return trHits;
+    } else if (section == kOpsPerSec) {
+      return trOpsPerSec;
+    }
+  }
+
+  return TableModel::headerData(section, orientation, role);
+}
+
+int HotKeysTableModel::columnCount(const QModelIndex& parent) const {
+  UNUSED(parent);
+
+  return kCountColumns;
+}
+
+void HotKeysTableModel::clear() {
+  beginResetModel();
+  clearData();
+  endResetModel();
+}
+
+void HotKeysTableModel::setHitters(const items_t& totals,
+                                   const items_t& window,
+                                   double scale,
+                                   common::time64_t window_msec) {
+  std::map<std::string, proxy::HotKeysSampler::count_t> window_counts(window.begin(), window.end());
+  clear();
+  for (const auto& total : totals) {
+    double ops_per_sec = 0;
+    auto it = window_counts.find(total.first);
+    if (it != window_counts.end() && window_msec > 0) {
+      ops_per_sec = static_cast<double>(it->second) * scale * 1000 / window_msec;
+    }
+
+    QString name;
+    common::ConvertFromString(total.first, &name);
+    insertItem(new HotKeyTableItem(name, static_cast<HotKeyTableItem::count_t>(total.second * scale), ops_per_sec));
+  }
+}
+
+}  // namespace gui
+}  // namespace fastonosql
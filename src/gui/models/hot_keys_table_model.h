@@ -0,0 +1,55 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <common/qt/gui/base/table_model.h>
+#include <common/types.h>
+
+#include "proxy/hot_keys_sampler.h"
+
+namespace fastonosql {
+namespace gui {
+
+// top-K of one sampled dimension: keys, key namespaces or commands
+class HotKeysTableModel : public common::qt::gui::TableModel {
+  Q_OBJECT
+
+ public:
+  typedef proxy::HotKeysSampler::items_t items_t;
+  enum eColumn { kName = 0, kHits = 1, kOpsPerSec = 2, kCountColumns = 3 };
+  enum eKind { kKeys = 0, kNamespaces = 1, kCommands = 2 };
+
+  explicit HotKeysTableModel(eKind kind, QObject* parent = Q_NULLPTR);
+
+  QVariant data(const QModelIndex& index, int role) const override;
+  QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
+
+  int columnCount(const QModelIndex& parent) const override;
+  void clear();
+
+  // totals: accumulated top-K, window: top-K of last sampling window,
+  // scale converts sampled counts into estimated real counts
+  void setHitters(const items_t& totals, const items_t& window, double scale, common::time64_t window_msec);
+
+ private:
+  const eKind kind_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
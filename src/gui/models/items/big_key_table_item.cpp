@@ -0,0 +1,51 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/items/big_key_table_item.h"
+
+#include <common/qt/convert2string.h>
+
+#include <fastonosql/core/value.h>
+
+namespace fastonosql {
+namespace gui {
+
+BigKeyTableItem::BigKeyTableItem(const proxy::NDbKeyStat& stat) : stat_(stat) {}
+
+QString BigKeyTableItem::keyString() const {
+  QString qkey;
+  const core::NKey key = stat_.GetKey();
+  const auto raw_key = key.GetKey();
+  common::ConvertFromBytes(raw_key.GetHumanReadable(), &qkey);
+  return qkey;
+}
+
+QString BigKeyTableItem::typeText() const {
+  return core::GetTypeName(stat_.GetType());
+}
+
+common::Value::Type BigKeyTableItem::type() const {
+  return stat_.GetType();
+}
+
+proxy::NDbKeyStat BigKeyTableItem::stat() const {
+  return stat_;
+}
+
+}  // namespace gui
+}  // namespace fastonosql
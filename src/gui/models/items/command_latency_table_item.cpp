@@ -0,0 +1,36 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/items/command_latency_table_item.h"
+
+namespace fastonosql {
+namespace gui {
+
+CommandLatencyTableItem::CommandLatencyTableItem(const QString& command, const proxy::ValueHistogram& latency)
+    : command_(command), latency_(latency) {}
+
+QString CommandLatencyTableItem::command() const {
+  return command_;
+}
+
+proxy::ValueHistogram CommandLatencyTableItem::latency() const {
+  return latency_;
+}
+
+}  // namespace gui
+}  // namespace fastonosql
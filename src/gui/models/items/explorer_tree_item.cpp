@@ -18,10 +18,11 @@
 
 #include "gui/models/items/explorer_tree_item.h"
 
-#include <limits>
 #include <string>
 #include <vector>
 
+#include <QCollator>
+
 #include <common/convert2string.h>
 
 #include <common/qt/convert2string.h>
@@ -38,12 +39,36 @@
 namespace fastonosql {
 namespace gui {
 
-IExplorerTreeItem::IExplorerTreeItem(TreeItem* parent, eType type) : TreeItem(parent, nullptr), type_(type) {}
+namespace {
+const QCollator& ItemCollator(IExplorerTreeItem::eType type) {
+  static const QCollator name_collator;
+  static const QCollator numeric_collator = []() {
+    QCollator collator;
+    collator.setNumericMode(true);  // databases 0, 1, ..., 10 instead of 0, 1, 10
+    return collator;
+  }();
+  return type == IExplorerTreeItem::eDatabase ? numeric_collator : name_collator;
+}
+}  // namespace
+
+IExplorerTreeItem::IExplorerTreeItem(TreeItem* parent, eType type)
+    : TreeItem(parent, nullptr), type_(type), sort_key_() {}
 
 ExplorerServerItem::eType IExplorerTreeItem::type() const {
   return type_;
 }
 
+const QCollatorSortKey& IExplorerTreeItem::sortKey() const {
+  if (!sort_key_) {
+    sort_key_.reset(new QCollatorSortKey(ItemCollator(type_).sortKey(name())));
+  }
+  return *sort_key_;
+}
+
+void IExplorerTreeItem::resetSortKey() {
+  sort_key_.reset();
+}
+
 ExplorerServerItem::ExplorerServerItem(proxy::IServerSPtr server, TreeItem* parent)
     : IExplorerTreeItem(parent, eServer), server_(server) {}
 
@@ -333,17 +358,30 @@ void ExplorerDatabaseItem::watchKey(const core::NDbKValue& key, int interval) {
     return;
   }
 
-  proxy::IServerSPtr server = dbs->GetServer();
-  core::translator_t tran = server->GetTranslator();
-  core::command_buffer_t cmd_str;
-  common::Error err = tran->LoadKeyCommand(key.GetKey(), key.GetType(), &cmd_str);
-  if (err) {
-    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  proxy::events_info::WatchKeyRequest req(this, dbs->GetInfo(), key, interval, true);
+  dbs->GetServer()->WatchKey(req);
+}
+
+void ExplorerDatabaseItem::stopWatchKey(const core::NDbKValue& key) {
+  proxy::IDatabaseSPtr dbs = db();
+  if (!dbs) {
+    DNOTREACHED();
     return;
   }
 
-  proxy::events_info::ExecuteInfoRequest req(this, cmd_str, std::numeric_limits<size_t>::max() - 1, interval, false);
-  dbs->Execute(req);
+  proxy::events_info::WatchKeyRequest req(this, dbs->GetInfo(), key, 0, false);
+  dbs->GetServer()->WatchKey(req);
+}
+
+void ExplorerDatabaseItem::setKeyspaceSync(bool enable) {
+  proxy::IDatabaseSPtr dbs = db();
+  if (!dbs) {
+    DNOTREACHED();
+    return;
+  }
+
+  proxy::events_info::KeyspaceSyncRequest req(this, dbs->GetInfo(), enable);
+  dbs->GetServer()->SetKeyspaceSync(req);
 }
 
 void ExplorerDatabaseItem::createKey(const core::NDbKValue& key) {
@@ -374,6 +412,22 @@ void ExplorerDatabaseItem::editValue(const core::NDbKValue& key, const core::NVa
   createKey(copy_key);
 }
 
+void ExplorerDatabaseItem::saveValueChanges(const core::NDbKValue& key,
+                                            const core::NValue& value,
+                                            const proxy::ValueChangesCommands& commands) {
+  proxy::IDatabaseSPtr dbs = db();
+  if (!dbs) {
+    DNOTREACHED();
+    return;
+  }
+
+  core::NDbKValue copy_key = key;
+  copy_key.SetValue(value);
+
+  proxy::events_info::SaveValueChangesRequest req(this, dbs->GetInfo(), copy_key, commands);
+  dbs->GetServer()->SaveValueChanges(req);
+}
+
 void ExplorerDatabaseItem::setTTL(const core::NKey& key, core::ttl_t ttl) {
   proxy::IDatabaseSPtr dbs = db();
   if (!dbs) {
@@ -440,6 +494,7 @@ core::NDbKValue ExplorerKeyItem::dbv() const {
 
 void ExplorerKeyItem::setDbv(const core::NDbKValue& key) {
   dbv_ = key;
+  resetSortKey();
 }
 
 bool ExplorerKeyItem::equalsKey(const core::NKey& key) const {
@@ -452,6 +507,7 @@ core::NKey ExplorerKeyItem::key() const {
 
 void ExplorerKeyItem::setKey(const core::NKey& key) {
   dbv_.SetKey(key);
+  resetSortKey();
 }
 
 QString ExplorerKeyItem::name() const {
@@ -498,6 +554,13 @@ void ExplorerKeyItem::editValue(const core::NValue& value) {
   }
 }
 
+void ExplorerKeyItem::saveValueChanges(const core::NValue& value, const proxy::ValueChangesCommands& commands) {
+  ExplorerDatabaseItem* par = db();
+  if (par) {
+    par->saveValueChanges(dbv_, value, commands);
+  }
+}
+
 void ExplorerKeyItem::removeFromDb() {
   ExplorerDatabaseItem* par = db();
   if (par) {
@@ -512,6 +575,13 @@ void ExplorerKeyItem::watchKey(int interval) {
   }
 }
 
+void ExplorerKeyItem::stopWatchKey() {
+  ExplorerDatabaseItem* par = db();
+  if (par) {
+    par->stopWatchKey(dbv_);
+  }
+}
+
 void ExplorerKeyItem::loadValueFromDb() {
   ExplorerDatabaseItem* par = db();
   if (par) {
@@ -18,9 +18,11 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include <QCollatorSortKey>
 #include <QString>
 
 #include <common/qt/gui/base/tree_item.h>
@@ -54,8 +56,15 @@ class IExplorerTreeItem : public common::qt::gui::TreeItem {
   virtual string_t basicStringName() const = 0;
   eType type() const;
 
+  // collation key of name(), built once and compared by sort model
+  const QCollatorSortKey& sortKey() const;
+
+ protected:
+  void resetSortKey();
+
  private:
   const eType type_;
+  mutable std::unique_ptr<QCollatorSortKey> sort_key_;
 };
 
 class ExplorerServerItem : public IExplorerTreeItem {
@@ -125,8 +134,13 @@ class ExplorerDatabaseItem : public IExplorerTreeItem {
   void loadValue(const core::NDbKValue& key);
   void loadType(const core::NDbKValue& key);
   void watchKey(const core::NDbKValue& key, int interval);
+  void stopWatchKey(const core::NDbKValue& key);  // watch of any key, there is one per connection
+  void setKeyspaceSync(bool enable);
   void createKey(const core::NDbKValue& key);
   void editValue(const core::NDbKValue& key, const core::NValue& value);
+  void saveValueChanges(const core::NDbKValue& key,
+                        const core::NValue& value,
+                        const proxy::ValueChangesCommands& commands);
   void setTTL(const core::NKey& key, core::ttl_t ttl);
 
   void removeAllKeys();
@@ -158,8 +172,10 @@ class ExplorerKeyItem : public IExplorerTreeItem {
 
   void renameKey(const QString& newName);
   void editValue(const core::NValue& value);
+  void saveValueChanges(const core::NValue& value, const proxy::ValueChangesCommands& commands);
   void removeFromDb();
   void watchKey(int interval);
+  void stopWatchKey();
   void loadValueFromDb();
   void loadTypeFromDb();
   void setTTL(core::ttl_t ttl);
@@ -0,0 +1,40 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/items/hot_key_table_item.h"
+
+namespace fastonosql {
+namespace gui {
+
+HotKeyTableItem::HotKeyTableItem(const QString& name, count_t hits, double ops_per_sec)
+    : name_(name), hits_(hits), ops_per_sec_(ops_per_sec) {}
+
+QString HotKeyTableItem::name() const {
+  return name_;
+}
+
+HotKeyTableItem::count_t HotKeyTableItem::hits() const {
+  return hits_;
+}
+
+double HotKeyTableItem::opsPerSec() const {
+  return ops_per_sec_;
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -22,7 +22,7 @@ namespace fastonosql {
 namespace gui {
 
 KeyValueTableItem::KeyValueTableItem(const key_t& key, const key_t& value, Mode state)
-    : base_class(state), key_(key), value_(value) {}
+    : base_class(state), key_(key), value_(value), stored_(false), stored_key_(), stored_value_() {}
 
 KeyValueTableItem::key_t KeyValueTableItem::key() const {
   return key_;
@@ -40,5 +40,23 @@ void KeyValueTableItem::setValue(const value_t& val) {
   value_ = val;
 }
 
+bool KeyValueTableItem::isStored() const {
+  return stored_;
+}
+
+void KeyValueTableItem::setStored() {
+  stored_ = true;
+  stored_key_ = key_;
+  stored_value_ = value_;
+}
+
+KeyValueTableItem::key_t KeyValueTableItem::storedKey() const {
+  return stored_key_;
+}
+
+KeyValueTableItem::value_t KeyValueTableItem::storedValue() const {
+  return stored_value_;
+}
+
 }  // namespace gui
 }  // namespace fastonosql
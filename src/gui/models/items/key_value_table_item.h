@@ -39,9 +39,18 @@ class KeyValueTableItem : public ActionTableItem {
   value_t value() const;
   void setValue(const value_t& val);
 
+  // row loaded from database by paged editors, changes are saved against stored pair
+  bool isStored() const;
+  void setStored();
+  key_t storedKey() const;
+  value_t storedValue() const;
+
  private:
   key_t key_;
   value_t value_;
+  bool stored_;
+  key_t stored_key_;
+  value_t stored_value_;
 };
 
 }  // namespace gui
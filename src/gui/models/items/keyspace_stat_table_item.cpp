@@ -0,0 +1,102 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/items/keyspace_stat_table_item.h"
+
+#include <algorithm>
+
+#define SECONDS_IN_HOUR 3600
+#define SECONDS_IN_DAY (24 * SECONDS_IN_HOUR)
+
+namespace fastonosql {
+namespace gui {
+
+KeyspaceStatTableItem::KeyspaceStatTableItem(const QString& ns)
+    : ns_(ns),
+      sizes_(),
+      no_ttl_count_(0),
+      ttl_hour_count_(0),
+      ttl_day_count_(0),
+      ttl_longer_count_(0),
+      strings_count_(0),
+      codecs_count_() {
+  std::fill(codecs_count_, codecs_count_ + proxy::kValueCodecCount, 0);
+}
+
+QString KeyspaceStatTableItem::ns() const {
+  return ns_;
+}
+
+void KeyspaceStatTableItem::addKey(const proxy::NDbKeyStat& stat) {
+  sizes_.Record(stat.GetMemoryUsage());
+
+  const core::ttl_t ttl = stat.GetKey().GetTTL();
+  if (ttl < 0) {  // NO_TTL, or key expired while scanning
+    no_ttl_count_++;
+  } else if (ttl < SECONDS_IN_HOUR) {
+    ttl_hour_count_++;
+  } else if (ttl < SECONDS_IN_DAY) {
+    ttl_day_count_++;
+  } else {
+    ttl_longer_count_++;
+  }
+
+  if (stat.GetType() == common::Value::TYPE_STRING) {
+    strings_count_++;
+    codecs_count_[stat.GetValueCodec()]++;
+  }
+}
+
+size_t KeyspaceStatTableItem::keysCount() const {
+  return sizes_.GetCount();
+}
+
+uint64_t KeyspaceStatTableItem::totalBytes() const {
+  return sizes_.GetSum();
+}
+
+uint64_t KeyspaceStatTableItem::sizePercentile(double percentile) const {
+  return sizes_.GetPercentile(percentile);
+}
+
+size_t KeyspaceStatTableItem::noTTLCount() const {
+  return no_ttl_count_;
+}
+
+size_t KeyspaceStatTableItem::ttlHourCount() const {
+  return ttl_hour_count_;
+}
+
+size_t KeyspaceStatTableItem::ttlDayCount() const {
+  return ttl_day_count_;
+}
+
+size_t KeyspaceStatTableItem::ttlLongerCount() const {
+  return ttl_longer_count_;
+}
+
+size_t KeyspaceStatTableItem::stringsCount() const {
+  return strings_count_;
+}
+
+size_t KeyspaceStatTableItem::codecCount(proxy::ValueCodec codec) const {
+  return codecs_count_[codec];
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,63 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QString>
+
+#include <common/qt/gui/base/table_item.h>
+
+#include "proxy/db_key_stat.h"
+#include "proxy/value_histogram.h"
+
+namespace fastonosql {
+namespace gui {
+
+// aggregated statistics of all keys in one namespace
+class KeyspaceStatTableItem : public common::qt::gui::TableItem {
+ public:
+  explicit KeyspaceStatTableItem(const QString& ns);
+
+  QString ns() const;
+  void addKey(const proxy::NDbKeyStat& stat);
+
+  size_t keysCount() const;
+  uint64_t totalBytes() const;
+  uint64_t sizePercentile(double percentile) const;
+
+  size_t noTTLCount() const;
+  size_t ttlHourCount() const;  // expire in less than hour
+  size_t ttlDayCount() const;   // expire in less than day
+  size_t ttlLongerCount() const;
+
+  size_t stringsCount() const;
+  size_t codecCount(proxy::ValueCodec codec) const;  // sniffed codecs of string values
+
+ private:
+  const QString ns_;
+  proxy::ValueHistogram sizes_;
+  size_t no_ttl_count_;
+  size_t ttl_hour_count_;
+  size_t ttl_day_count_;
+  size_t ttl_longer_count_;
+  size_t strings_count_;
+  size_t codecs_count_[proxy::kValueCodecCount];
+};
+
+}  // namespace gui
+}  // namespace fastonosql
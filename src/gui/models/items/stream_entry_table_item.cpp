@@ -0,0 +1,53 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/items/stream_entry_table_item.h"
+
+#include <QStringList>
+
+#include <common/qt/convert2string.h>
+
+namespace fastonosql {
+namespace gui {
+
+StreamEntryTableItem::StreamEntryTableItem(const core::StreamValue::Stream& stream) : stream_(stream) {}
+
+core::StreamValue::Stream StreamEntryTableItem::stream() const {
+  return stream_;
+}
+
+QString StreamEntryTableItem::id() const {
+  QString qid;
+  common::ConvertFromBytes(stream_.sid, &qid);
+  return qid;
+}
+
+QString StreamEntryTableItem::fields() const {
+  QStringList fields;
+  for (const core::StreamValue::Entry& ent : stream_.entries) {
+    QString qname;
+    QString qvalue;
+    common::ConvertFromBytes(ent.name, &qname);
+    common::ConvertFromBytes(ent.value, &qvalue);
+    fields.append(qname + "=" + qvalue);
+  }
+  return fields.join(" ");
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -21,7 +21,8 @@
 namespace fastonosql {
 namespace gui {
 
-ValueTableItem::ValueTableItem(const value_t& value, Mode state) : base_class(state), value_(value) {}
+ValueTableItem::ValueTableItem(const value_t& value, Mode state)
+    : base_class(state), value_(value), stored_(false), stored_index_(0), stored_value_() {}
 
 ValueTableItem::value_t ValueTableItem::value() const {
   return value_;
@@ -31,5 +32,23 @@ void ValueTableItem::setValue(const value_t& val) {
   value_ = val;
 }
 
+bool ValueTableItem::isStored() const {
+  return stored_;
+}
+
+void ValueTableItem::setStored(size_t index) {
+  stored_ = true;
+  stored_index_ = index;
+  stored_value_ = value_;
+}
+
+size_t ValueTableItem::storedIndex() const {
+  return stored_index_;
+}
+
+ValueTableItem::value_t ValueTableItem::storedValue() const {
+  return stored_value_;
+}
+
 }  // namespace gui
 }  // namespace fastonosql
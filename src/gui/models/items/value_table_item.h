@@ -35,8 +35,17 @@ class ValueTableItem : public ActionTableItem {
   value_t value() const;
   void setValue(const value_t& val);
 
+  // row loaded from database by paged editors, changes are saved against stored value
+  bool isStored() const;
+  void setStored(size_t index);
+  size_t storedIndex() const;
+  value_t storedValue() const;
+
  private:
   value_t value_;
+  bool stored_;
+  size_t stored_index_;
+  value_t stored_value_;
 };
 
 }  // namespace gui
@@ -0,0 +1,197 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/keyspace_stat_table_model.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <QStringList>
+
+#include <common/qt/convert2string.h>
+#include <common/qt/utils_qt.h>
+
+#include "gui/key_info.h"
+#include "gui/models/items/keyspace_stat_table_item.h"
+
+namespace {
+const QString trNamespace = QObject::tr("Namespace");
+const QString trKeys = QObject::tr("Keys");
+const QString trTotalBytes = QObject::tr("Total bytes");
+const QString trSizeP50 = QObject::tr("p50 bytes");
+const QString trSizeP99 = QObject::tr("p99 bytes");
+const QString trNoTTL = QObject::tr("No TTL");
+const QString trTTLHour = QObject::tr("TTL < 1h");
+const QString trTTLDay = QObject::tr("TTL < 1d");
+const QString trTTLLonger = QObject::tr("TTL >= 1d");
+const QString trCodecs = QObject::tr("Codecs");
+const QString trWithoutNamespace = QObject::tr("(without namespace)");
+const QString trCodecShareTemplate_2S = QObject::tr("%1 %2%");
+
+// most frequent first, like "GZip 90%, Json 10%"
+QString codecsText(const fastonosql::gui::KeyspaceStatTableItem* node) {
+  const size_t strings_count = node->stringsCount();
+  if (!strings_count) {
+    return QString();
+  }
+
+  std::vector<std::pair<size_t, int>> codecs;
+  for (int i = 0; i < fastonosql::proxy::kValueCodecCount; ++i) {
+    const size_t count = node->codecCount(static_cast<fastonosql::proxy::ValueCodec>(i));
+    if (count) {
+      codecs.push_back(std::make_pair(count, i));
+    }
+  }
+  std::stable_sort(codecs.begin(), codecs.end(),
+                   [](const std::pair<size_t, int>& lhs, const std::pair<size_t, int>& rhs) {
+                     return lhs.first > rhs.first;
+                   });
+
+  QStringList parts;
+  for (const auto& codec : codecs) {
+    const int percent = static_cast<int>(codec.first * 100 / strings_count);
+    parts << trCodecShareTemplate_2S.arg(fastonosql::proxy::g_value_codecs_text[codec.second]).arg(percent);
+  }
+  return parts.join(", ");
+}
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+KeyspaceStatTableModel::KeyspaceStatTableModel(QObject* parent) : TableModel(parent), rows_() {}
+
+QVariant KeyspaceStatTableModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid()) {
+    return QVariant();
+  }
+
+  KeyspaceStatTableItem* node = common::qt::item<common::qt::gui::TableItem*, KeyspaceStatTableItem*>(index);
+  if (!node) {
+    return QVariant();
+  }
+
+  int col = index.column();
+  QVariant result;
+  if (role == Qt::DisplayRole) {
+    if (col == kNamespace) {
+      const QString ns = node->ns();
+      result = ns.isEmpty() ? trWithoutNamespace : ns;
+    } else if (col == kKeys) {
+      result = static_cast<qulonglong>(node->keysCount());
+    } else if (col == kTotalBytes) {
+      result = static_cast<qulonglong>(node->totalBytes());
+    } else if (col == kSizeP50) {
+      result = static_cast<qulonglong>(node->sizePercentile(50));
+    } else if (col == kSizeP99) {
+      result = static_cast<qulonglong>(node->sizePercentile(99));
+    } else if (col == kNoTTL) {
+      result = static_cast<qulonglong>(node->noTTLCount());
+    } else if (col == kTTLHour) {
+      result = static_cast<qulonglong>(node->ttlHourCount());
+    } else if (col == kTTLDay) {
+      result = static_cast<qulonglong>(node->ttlDayCount());
+    } else if (col == kTTLLonger) {
+      result = static_cast<qulonglong>(node->ttlLongerCount());
+    } else if (col == kCodecs) {
+      result = codecsText(node);
+    }
+  }
+
+  return result;
+}
+
+QVariant KeyspaceStatTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+  if (role != Qt::DisplayRole) {
+    return QVariant();
+  }
+
+  if (orientation == Qt::Horizontal) {
+    if (section == kNamespace) {
+      return trNamespace;
+    } else if (section == kKeys) {
+      return trKeys;
+    } else if (section == kTotalBytes) {
+      return trTotalBytes;
+    } else if (section == kSizeP50) {
+      return trSizeP50;
+    } else if (section == kSizeP99) {
+      return trSizeP99;
+    } else if (section == kNoTTL) {
+      return trNoTTL;
+    } else if (section == kTTLHour) {
+      return trTTLHour;
+    } else if (section == kTTLDay) {
+      return trTTLDay;
+    } else if (section == kTTLLonger) {
+      return trTTLLonger;
+    } else if (section == kCodecs) {
+      return trCodecs;
+    }
+  }
+
+  return TableModel::headerData(section, orientation, role);
+}
+
+int KeyspaceStatTableModel::columnCount(const QModelIndex& parent) const {
+  UNUSED(parent);
+
+  return kCountColumns;
+}
+
+void KeyspaceStatTableModel::clear() {
+  beginResetModel();
+  clearData();
+  rows_.clear();
+  endResetModel();
+}
+
+void KeyspaceStatTableModel::addKeyStat(const proxy::NDbKeyStat& stat,
+                                        const std::string& ns_separator,
+                                        size_t ns_depth) {
+  const auto key_str = stat.GetKey().GetKey();
+  const KeyInfo kinf(key_str.GetHumanReadable(), ns_separator);
+  const KeyInfo::splited_namespaces_t namespaces = kinf.namespaces();
+  KeyInfo::string_t ns_str;
+  for (size_t i = 0; i < namespaces.size() && i < ns_depth; ++i) {
+    if (i != 0) {
+      ns_str += ns_separator;
+    }
+    ns_str += namespaces[i];
+  }
+
+  QString ns;
+  common::ConvertFromBytes(ns_str, &ns);
+  auto it = rows_.find(ns);
+  if (it == rows_.end()) {
+    KeyspaceStatTableItem* item = new KeyspaceStatTableItem(ns);
+    item->addKey(stat);
+    rows_[ns] = data_.size();
+    insertItem(item);
+    return;
+  }
+
+  const int row = static_cast<int>(it->second);
+  KeyspaceStatTableItem* item = static_cast<KeyspaceStatTableItem*>(data_[it->second]);
+  item->addKey(stat);
+  updateItem(index(row, kKeys, QModelIndex()), index(row, kCodecs, QModelIndex()));
+}
+
+}  // namespace gui
+}  // namespace fastonosql
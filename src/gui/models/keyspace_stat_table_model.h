@@ -0,0 +1,67 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include <common/qt/gui/base/table_model.h>
+
+#include "proxy/db_key_stat.h"
+
+namespace fastonosql {
+namespace gui {
+
+class KeyspaceStatTableItem;
+
+class KeyspaceStatTableModel : public common::qt::gui::TableModel {
+  Q_OBJECT
+
+ public:
+  enum eColumn {
+    kNamespace = 0,
+    kKeys = 1,
+    kTotalBytes = 2,
+    kSizeP50 = 3,
+    kSizeP99 = 4,
+    kNoTTL = 5,
+    kTTLHour = 6,
+    kTTLDay = 7,
+    kTTLLonger = 8,
+    kCodecs = 9,
+    kCountColumns = 10
+  };
+
+  explicit KeyspaceStatTableModel(QObject* parent = Q_NULLPTR);
+
+  QVariant data(const QModelIndex& index, int role) const override;
+  QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
+
+  int columnCount(const QModelIndex& parent) const override;
+  void clear();
+
+  // aggregates key into namespace built from first ns_depth parts of key name
+  void addKeyStat(const proxy::NDbKeyStat& stat, const std::string& ns_separator, size_t ns_depth);
+
+ private:
+  std::map<QString, size_t> rows_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
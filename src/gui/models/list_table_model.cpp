@@ -28,7 +28,15 @@
 namespace fastonosql {
 namespace gui {
 
-ListTableModel::ListTableModel(QObject* parent) : common::qt::gui::TableModel(parent), first_column_name_() {
+ListTableModel::ListTableModel(QObject* parent)
+    : common::qt::gui::TableModel(parent),
+      first_column_name_(),
+      paged_(false),
+      fetching_(false),
+      at_end_(false),
+      loaded_(0),
+      total_(0),
+      removed_() {
   insertItem(createEmptyRow());
 }
 
@@ -115,6 +123,11 @@ void ListTableModel::clear() {
   beginResetModel();
   clearData();
   insertItem(createEmptyRow());
+  fetching_ = false;
+  at_end_ = false;
+  loaded_ = 0;
+  total_ = 0;
+  removed_.clear();
   endResetModel();
 }
 
@@ -165,6 +178,10 @@ void ListTableModel::removeRow(int row) {
   size_t stabled_index_row = static_cast<size_t>(row);
   beginRemoveRows(QModelIndex(), row, row);
   common::qt::gui::TableItem* child = data_[stabled_index_row];
+  ValueTableItem* node = static_cast<ValueTableItem*>(child);
+  if (node->isStored()) {
+    removed_.push_back({node->storedIndex(), node->storedValue(), node->value()});
+  }
   data_.erase(data_.begin() + row);
   delete child;
   endRemoveRows();
@@ -174,6 +191,84 @@ void ListTableModel::setFirstColumnName(const QString& name) {
   first_column_name_ = name;
 }
 
+void ListTableModel::setPaged(bool paged) {
+  paged_ = paged;
+}
+
+bool ListTableModel::isPaged() const {
+  return paged_;
+}
+
+void ListTableModel::appendPage(const std::vector<row_t>& rows, uint64_t total, bool is_last) {
+  fetching_ = false;
+  at_end_ = is_last;
+  total_ = total;
+  if (rows.empty()) {
+    return;
+  }
+
+  // before empty add row
+  const int first = static_cast<int>(data_.size() - 1);
+  beginInsertRows(QModelIndex(), first, first + static_cast<int>(rows.size()) - 1);
+  std::vector<common::qt::gui::TableItem*> items;
+  items.reserve(rows.size());
+  for (const row_t& row : rows) {
+    ValueTableItem* item = new ValueTableItem(row, ValueTableItem::RemoveAction);
+    item->setStored(loaded_ + items.size());
+    items.push_back(item);
+  }
+  data_.insert(data_.end() - 1, items.begin(), items.end());
+  loaded_ += rows.size();
+  endInsertRows();
+}
+
+void ListTableModel::stopFetch() {
+  fetching_ = false;
+  at_end_ = true;
+}
+
+uint64_t ListTableModel::loadedCount() const {
+  return loaded_;
+}
+
+uint64_t ListTableModel::totalCount() const {
+  return total_;
+}
+
+bool ListTableModel::isFullyLoaded() const {
+  return at_end_;
+}
+
+void ListTableModel::changes(std::vector<RowChange>* removed,
+                             std::vector<RowChange>* edited,
+                             std::vector<row_t>* added) const {
+  *removed = removed_;
+  for (size_t i = 0; i < data_.size() - 1; ++i) {
+    ValueTableItem* node = static_cast<ValueTableItem*>(data_[i]);
+    if (!node->isStored()) {
+      added->push_back(node->value());
+      continue;
+    }
+
+    if (node->value() != node->storedValue()) {
+      edited->push_back({node->storedIndex(), node->storedValue(), node->value()});
+    }
+  }
+}
+
+bool ListTableModel::canFetchMore(const QModelIndex& parent) const {
+  return !parent.isValid() && paged_ && !fetching_ && !at_end_;
+}
+
+void ListTableModel::fetchMore(const QModelIndex& parent) {
+  if (!canFetchMore(parent)) {
+    return;
+  }
+
+  fetching_ = true;
+  emit fetchMoreRequested();
+}
+
 common::qt::gui::TableItem* ListTableModel::createEmptyRow() const {
   return new ValueTableItem(row_t(), ValueTableItem::AddAction);
 }
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <common/qt/gui/base/table_model.h>
 #include <common/value.h>
 
@@ -30,6 +32,11 @@ class ListTableModel : public common::qt::gui::TableModel {
  public:
   typedef common::Value::string_t row_t;
   enum eColumn : uint8_t { kValue = 0, kAction = 1, kCountColumns = 2 };
+  struct RowChange {
+    size_t stored_index;  // position in database list
+    row_t stored_value;
+    row_t value;
+  };
 
   explicit ListTableModel(QObject* parent = Q_NULLPTR);
 
@@ -49,6 +56,23 @@ class ListTableModel : public common::qt::gui::TableModel {
 
   void setFirstColumnName(const QString& name);
 
+  // paged mode: rows are appended by pages from database when view asks for more,
+  // only loaded rows are resident and changes are kept against stored rows
+  void setPaged(bool paged);
+  bool isPaged() const;
+  void appendPage(const std::vector<row_t>& rows, uint64_t total, bool is_last);
+  void stopFetch();
+  uint64_t loadedCount() const;
+  uint64_t totalCount() const;
+  bool isFullyLoaded() const;
+  void changes(std::vector<RowChange>* removed, std::vector<RowChange>* edited, std::vector<row_t>* added) const;
+
+  bool canFetchMore(const QModelIndex& parent) const override;
+  void fetchMore(const QModelIndex& parent) override;
+
+ Q_SIGNALS:
+  void fetchMoreRequested();
+
  private:
   using TableModel::insertItem;
   using TableModel::removeItem;
@@ -56,6 +80,13 @@ class ListTableModel : public common::qt::gui::TableModel {
   common::qt::gui::TableItem* createEmptyRow() const;
 
   QString first_column_name_;
+
+  bool paged_;
+  bool fetching_;
+  bool at_end_;
+  uint64_t loaded_;
+  uint64_t total_;
+  std::vector<RowChange> removed_;
 };
 
 }  // namespace gui
@@ -0,0 +1,161 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/log_messages_model.h"
+
+#include <QColor>
+#include <QTime>
+
+#include <common/qt/convert2string.h>
+
+namespace fastonosql {
+namespace gui {
+
+LogMessagesModel::LogMessagesModel(size_t capacity, QObject* parent)
+    : QAbstractListModel(parent),
+      capacity_(capacity ? capacity : 1),
+      evict_batch_(capacity_ / evict_batch_divider ? capacity_ / evict_batch_divider : 1),
+      messages_(),
+      head_(0),
+      size_(0),
+      spill_file_() {
+  messages_.resize(capacity_);
+}
+
+LogMessagesModel::~LogMessagesModel() {
+  setSpillFile(std::string());
+}
+
+int LogMessagesModel::rowCount(const QModelIndex& parent) const {
+  if (parent.isValid()) {
+    return 0;
+  }
+
+  return static_cast<int>(size_);
+}
+
+QVariant LogMessagesModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid() || index.row() < 0 || static_cast<size_t>(index.row()) >= size_) {
+    return QVariant();
+  }
+
+  const Message& message = messageAt(index.row());
+  if (role == Qt::DisplayRole) {
+    return message.text;
+  } else if (role == Qt::ForegroundRole) {
+    return message.level <= common::logging::LOG_LEVEL_CRIT ? QColor(Qt::red) : QColor(Qt::black);
+  } else if (role == kLevelRole) {
+    return static_cast<int>(message.level);
+  }
+
+  return QVariant();
+}
+
+void LogMessagesModel::addMessage(const QString& message, common::logging::LOG_LEVEL level) {
+  if (size_ == capacity_) {
+    beginRemoveRows(QModelIndex(), 0, static_cast<int>(evict_batch_) - 1);
+    for (size_t i = 0; i < evict_batch_; ++i) {
+      spill(messages_[head_]);
+      messages_[head_] = Message();
+      head_ = (head_ + 1) % capacity_;
+    }
+    size_ -= evict_batch_;
+    endRemoveRows();
+  }
+
+  const int row = static_cast<int>(size_);
+  beginInsertRows(QModelIndex(), row, row);
+  Message& slot = messages_[(head_ + size_) % capacity_];
+  slot.text = QTime::currentTime().toString("hh:mm:ss.zzz: %1").arg(message);
+  slot.level = level;
+  size_++;
+  endInsertRows();
+}
+
+void LogMessagesModel::clear() {
+  beginResetModel();
+  for (size_t i = 0; i < size_; ++i) {
+    Message& message = messages_[(head_ + i) % capacity_];
+    spill(message);
+    message = Message();
+  }
+  head_ = 0;
+  size_ = 0;
+  endResetModel();
+}
+
+bool LogMessagesModel::setSpillFile(const std::string& path) {
+  if (spill_file_) {
+    spill_file_->Close();
+    spill_file_.reset();
+  }
+
+  if (path.empty()) {
+    return true;
+  }
+
+  std::unique_ptr<common::file_system::ANSIFile> file(new common::file_system::ANSIFile);
+  common::ErrnoError err = file->Open(common::file_system::ascii_string_path(path), "ab");
+  if (err) {
+    return false;
+  }
+
+  spill_file_ = std::move(file);
+  return true;
+}
+
+bool LogMessagesModel::isSpillEnabled() const {
+  return static_cast<bool>(spill_file_);
+}
+
+const LogMessagesModel::Message& LogMessagesModel::messageAt(size_t row) const {
+  return messages_[(head_ + row) % capacity_];
+}
+
+void LogMessagesModel::spill(const Message& message) {
+  if (!spill_file_) {
+    return;
+  }
+
+  spill_file_->Write(common::ConvertToString(message.text) + "\n");
+}
+
+LogLevelFilterModel::LogLevelFilterModel(QObject* parent)
+    : QSortFilterProxyModel(parent), max_level_(common::logging::LOG_LEVEL_DEBUG) {}
+
+common::logging::LOG_LEVEL LogLevelFilterModel::maxLevel() const {
+  return max_level_;
+}
+
+void LogLevelFilterModel::setMaxLevel(common::logging::LOG_LEVEL level) {
+  if (max_level_ == level) {
+    return;
+  }
+
+  max_level_ = level;
+  invalidateFilter();
+}
+
+bool LogLevelFilterModel::filterAcceptsRow(int source_row, const QModelIndex& source_parent) const {
+  const QModelIndex index = sourceModel()->index(source_row, 0, source_parent);
+  const int level = sourceModel()->data(index, LogMessagesModel::kLevelRole).toInt();
+  return level <= max_level_;
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,90 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <QAbstractListModel>
+#include <QSortFilterProxyModel>
+
+#include <common/file_system/file.h>
+#include <common/log_levels.h>
+#include <common/types.h>
+
+namespace fastonosql {
+namespace gui {
+
+// fixed capacity ring of log messages, oldest rows are evicted (and optionally spilled to file),
+// eviction goes in batches of capacity / evict_batch_divider rows, so proxy models remap rows once per batch
+class LogMessagesModel : public QAbstractListModel {
+  Q_OBJECT
+
+ public:
+  enum { default_capacity = 10000, evict_batch_divider = 10 };
+  enum eRole { kLevelRole = Qt::UserRole + 1 };
+
+  explicit LogMessagesModel(size_t capacity = default_capacity, QObject* parent = Q_NULLPTR);
+  ~LogMessagesModel() override;
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+  QVariant data(const QModelIndex& index, int role) const override;
+
+  void addMessage(const QString& message, common::logging::LOG_LEVEL level);
+  void clear();
+
+  bool setSpillFile(const std::string& path);  // empty path disables spill
+  bool isSpillEnabled() const;
+
+ private:
+  struct Message {
+    QString text;  // already formatted with time
+    common::logging::LOG_LEVEL level;
+  };
+
+  const Message& messageAt(size_t row) const;
+  void spill(const Message& message);
+
+  const size_t capacity_;
+  const size_t evict_batch_;
+  std::vector<Message> messages_;
+  size_t head_;
+  size_t size_;
+  std::unique_ptr<common::file_system::ANSIFile> spill_file_;
+};
+
+class LogLevelFilterModel : public QSortFilterProxyModel {
+  Q_OBJECT
+
+ public:
+  explicit LogLevelFilterModel(QObject* parent = Q_NULLPTR);
+
+  common::logging::LOG_LEVEL maxLevel() const;
+  void setMaxLevel(common::logging::LOG_LEVEL level);  // shows messages with level <= max
+
+ protected:
+  bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override;
+
+ private:
+  common::logging::LOG_LEVEL max_level_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
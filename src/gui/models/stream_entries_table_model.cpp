@@ -0,0 +1,94 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/stream_entries_table_model.h"
+
+#include <common/qt/utils_qt.h>
+
+#include "gui/models/items/stream_entry_table_item.h"
+
+namespace {
+const QString trId = QObject::tr("ID");
+const QString trFields = QObject::tr("Fields");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+StreamEntriesTableModel::StreamEntriesTableModel(QObject* parent) : TableModel(parent) {}
+
+QVariant StreamEntriesTableModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid()) {
+    return QVariant();
+  }
+
+  StreamEntryTableItem* node = common::qt::item<common::qt::gui::TableItem*, StreamEntryTableItem*>(index);
+  if (!node) {
+    return QVariant();
+  }
+
+  int col = index.column();
+  QVariant result;
+  if (role == Qt::DisplayRole) {
+    if (col == kId) {
+      result = node->id();
+    } else if (col == kFields) {
+      result = node->fields();
+    }
+  }
+
+  return result;
+}
+
+QVariant StreamEntriesTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+  if (role != Qt::DisplayRole) {
+    return QVariant();
+  }
+
+  if (orientation == Qt::Horizontal) {
+    if (section == kId) {
+      return trId;
+    } else if (section == kFields) {
+      return trFields;
+    }
+  }
+
+  return TableModel::headerData(section, orientation, role);
+}
+
+int StreamEntriesTableModel::columnCount(const QModelIndex& parent) const {
+  UNUSED(parent);
+
+  return kCountColumns;
+}
+
+void StreamEntriesTableModel::clear() {
+  beginResetModel();
+  clearData();
+  endResetModel();
+}
+
+void StreamEntriesTableModel::setStreams(const std::vector<core::StreamValue::Stream>& streams) {
+  clear();
+  for (const core::StreamValue::Stream& stream : streams) {
+    insertItem(new StreamEntryTableItem(stream));
+  }
+}
+
+}  // namespace gui
+}  // namespace fastonosql
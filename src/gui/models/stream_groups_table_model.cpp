@@ -0,0 +1,117 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/models/stream_groups_table_model.h"
+
+#include <common/qt/convert2string.h>
+#include <common/qt/utils_qt.h>
+
+#include "gui/models/items/stream_group_table_item.h"
+
+#include "translations/global.h"
+
+namespace {
+const QString trConsumers = QObject::tr("Consumers");
+const QString trPending = QObject::tr("Pending");
+const QString trLastDeliveredId = QObject::tr("Last delivered ID");
+const QString trLag = QObject::tr("Lag");
+const QString trUnknownLag = QObject::tr("n/a");
+}  // namespace
+
+namespace fastonosql {
+namespace gui {
+
+StreamGroupsTableModel::StreamGroupsTableModel(QObject* parent) : TableModel(parent) {}
+
+QVariant StreamGroupsTableModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid()) {
+    return QVariant();
+  }
+
+  StreamGroupTableItem* node = common::qt::item<common::qt::gui::TableItem*, StreamGroupTableItem*>(index);
+  if (!node) {
+    return QVariant();
+  }
+
+  const proxy::StreamGroupInfo group = node->group();
+  int col = index.column();
+  QVariant result;
+  if (role == Qt::DisplayRole) {
+    if (col == kName) {
+      QString qname;
+      common::ConvertFromString(group.name, &qname);
+      result = qname;
+    } else if (col == kConsumers) {
+      result = static_cast<qulonglong>(group.consumers);
+    } else if (col == kPending) {
+      result = static_cast<qulonglong>(group.pending);
+    } else if (col == kLastDeliveredId) {
+      QString qid;
+      common::ConvertFromBytes(group.last_delivered_id, &qid);
+      result = qid;
+    } else if (col == kLag) {
+      result = group.lag < 0 ? QVariant(trUnknownLag) : QVariant(static_cast<qlonglong>(group.lag));
+    }
+  }
+
+  return result;
+}
+
+QVariant StreamGroupsTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+  if (role != Qt::DisplayRole) {
+    return QVariant();
+  }
+
+  if (orientation == Qt::Horizontal) {
+    if (section == kName) {
+      return translations::trName;
+    } else if (section == kConsumers) {
+      return trConsumers;
+    } else if (section == kPending) {
+      return trPending;
+    } else if (section == kLastDeliveredId) {
+      return trLastDeliveredId;
+    } else if (section == kLag) {
+      return trLag;
+    }
+  }
+
+  return TableModel::headerData(section, orientation, role);
+}
+
+int StreamGroupsTableModel::columnCount(const QModelIndex& parent) const {
+  UNUSED(parent);
+
+  return kCountColumns;
+}
+
+void StreamGroupsTableModel::clear() {
+  beginResetModel();
+  clearData();
+  endResetModel();
+}
+
+void StreamGroupsTableModel::setGroups(const std::vector<proxy::StreamGroupInfo>& groups) {
+  clear();
+  for (const proxy::StreamGroupInfo& group : groups) {
+    insertItem(new StreamGroupTableItem(group));
+  }
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -18,6 +18,10 @@
 
 #include "gui/shell/base_lexer.h"
 
+#include <ctype.h>
+
+#include <algorithm>
+
 #include <common/qt/convert2string.h>
 #include <common/sprintf.h>
 
@@ -31,43 +35,93 @@ BaseCommandsQsciLexer::validated_commands_t MakeValidatedCommands(const std::vec
   }
   return res;
 }
+
+bool IsWordSeparator(char c) {
+  return isspace(static_cast<unsigned char>(c));
+}
+
+bool IsInlineSpace(char c) {
+  return c == ' ' || c == '\t';
+}
+
+std::string ToUpperWord(const std::string& word) {
+  std::string result = word;
+  for (auto& c : result) {
+    c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+  }
+  return result;
+}
+
+size_t FindWordEnd(const std::string& source, size_t pos) {
+  while (pos < source.size() && !IsWordSeparator(source[pos])) {
+    pos++;
+  }
+  return pos;
+}
 }  // namespace
 
 BaseQsciApi::BaseQsciApi(QsciLexer* lexer) : QsciAbstractAPIs(lexer), filtered_version_(UNDEFINED_SINCE) {}
 
 bool BaseQsciApi::canSkipCommand(const core::CommandInfo& info) const {
+  return canSkipVersion(info.since);
+}
+
+bool BaseQsciApi::canSkipVersion(uint32_t since) const {
   if (filtered_version_ == UNDEFINED_SINCE) {
     return false;
   }
 
-  if (info.since == UNDEFINED_SINCE) {
+  if (since == UNDEFINED_SINCE) {
     return false;
   }
 
-  return info.since > filtered_version_;
+  return since > filtered_version_;
 }
 
 void BaseQsciApi::setFilteredVersion(uint32_t version) {
   filtered_version_ = version;
 }
 
-BaseCommandsQsciApi::BaseCommandsQsciApi(BaseCommandsQsciLexer* lexer) : BaseQsciApi(lexer) {}
+BaseCommandsQsciApi::BaseCommandsQsciApi(BaseCommandsQsciLexer* lexer) : BaseQsciApi(lexer), index_() {
+  const BaseCommandsQsciLexer::validated_commands_t& commands = lexer->commands();
+  index_.reserve(commands.size());
+  for (const core::CommandInfo& cmd : commands) {
+    QString name;
+    if (!common::ConvertFromBytes(cmd.name, &name)) {
+      continue;
+    }
+
+    IndexEntry entry;
+    entry.key = name.toUpper();
+    entry.completion = name + "?1";
+    entry.call_tip = makeCallTip(cmd);
+    entry.since = cmd.since;
+    entry.skipped = canSkipCommand(cmd);
+    index_.push_back(entry);
+  }
+
+  std::stable_sort(index_.begin(), index_.end(),
+                   [](const IndexEntry& lhs, const IndexEntry& rhs) { return lhs.key < rhs.key; });
+}
+
+void BaseCommandsQsciApi::setFilteredVersion(uint32_t version) {
+  BaseQsciApi::setFilteredVersion(version);
+  for (IndexEntry& entry : index_) {
+    entry.skipped = canSkipVersion(entry.since);
+  }
+}
+
+BaseCommandsQsciApi::index_t::const_iterator BaseCommandsQsciApi::lowerBound(const QString& key) const {
+  return std::lower_bound(index_.begin(), index_.end(), key,
+                          [](const IndexEntry& entry, const QString& value) { return entry.key < value; });
+}
 
 void BaseCommandsQsciApi::updateAutoCompletionList(const QStringList& context, QStringList& list) {
-  BaseCommandsQsciLexer* lex = static_cast<BaseCommandsQsciLexer*>(lexer());
-  auto commands = lex->commands();
   for (auto it = context.begin(); it != context.end(); ++it) {
-    QString val = *it;
-    for (size_t i = 0; i < commands.size(); ++i) {
-      core::CommandInfo cmd = commands[i];
-      if (canSkipCommand(cmd)) {
-        continue;
-      }
-
-      QString jval;
-      common::ConvertFromBytes(cmd.name, &jval);
-      if (jval.startsWith(val, Qt::CaseInsensitive)) {
-        list.append(jval + "?1");
+    const QString prefix = it->toUpper();
+    for (auto entry = lowerBound(prefix); entry != index_.end() && entry->key.startsWith(prefix); ++entry) {
+      if (!entry->skipped) {
+        list.append(entry->completion);
       }
     }
   }
@@ -80,18 +134,11 @@ QStringList BaseCommandsQsciApi::callTips(const QStringList& context,
   UNUSED(commas);
   UNUSED(style);
   UNUSED(shifts);
-  BaseCommandsQsciLexer* lex = static_cast<BaseCommandsQsciLexer*>(lexer());
-  auto commands = lex->commands();
   for (auto it = context.begin(); it != context.end(); ++it) {
-    QString val = *it;
-    for (size_t i = 0; i < commands.size(); ++i) {
-      core::CommandInfo cmd = commands[i];
-
-      QString jval;
-      common::ConvertFromBytes(cmd.name, &jval);
-      if (QString::compare(jval, val, Qt::CaseInsensitive) == 0) {
-        return QStringList() << makeCallTip(cmd);
-      }
+    const QString key = it->toUpper();
+    auto entry = lowerBound(key);
+    if (entry != index_.end() && entry->key == key) {
+      return QStringList() << entry->call_tip;
     }
   }
 
@@ -133,7 +180,36 @@ BaseQsciApi* BaseQsciLexer::apis() const {
 }
 
 BaseCommandsQsciLexer::BaseCommandsQsciLexer(const std::vector<core::CommandHolder>& commands, QObject* parent)
-    : BaseQsciLexer(parent), commands_(MakeValidatedCommands(commands)) {}
+    : BaseQsciLexer(parent), commands_(MakeValidatedCommands(commands)), keywords_(MakeKeywords(commands_)) {}
+
+BaseCommandsQsciLexer::keywords_t BaseCommandsQsciLexer::MakeKeywords(const validated_commands_t& commands) {
+  keywords_t result;
+  for (const core::CommandInfo& cmd : commands) {
+    const std::string name(cmd.name.begin(), cmd.name.end());
+    Keyword keyword;
+    keyword.style = cmd.type == core::CommandInfo::Native ? Command : ExCommand;
+    for (size_t pos = 0; pos < name.size();) {
+      if (IsWordSeparator(name[pos])) {
+        pos++;
+        continue;
+      }
+      const size_t word_end = FindWordEnd(name, pos);
+      keyword.words.push_back(ToUpperWord(name.substr(pos, word_end - pos)));
+      pos = word_end;
+    }
+
+    if (!keyword.words.empty()) {
+      result[keyword.words[0]].push_back(keyword);
+    }
+  }
+
+  for (auto& candidates : result) {
+    std::stable_sort(candidates.second.begin(), candidates.second.end(), [](const Keyword& lhs, const Keyword& rhs) {
+      return lhs.words.size() > rhs.words.size();
+    });
+  }
+  return result;
+}
 
 std::vector<uint32_t> BaseCommandsQsciLexer::supportedVersions() const {
   std::vector<uint32_t> result;
@@ -171,36 +247,77 @@ void BaseCommandsQsciLexer::styleText(int start, int end) {
     return;
   }
 
-  char* data = new char[end - start + 1];
-  editor()->SendScintilla(QsciScintilla::SCI_GETTEXTRANGE, start, end, data);
-  QString source(data);
-  delete[] data;
-
-  if (source.isEmpty()) {
+  // scintilla asks only for invalidated range, widen it to whole lines so words are not cut
+  const long start_line = editor()->SendScintilla(QsciScintilla::SCI_LINEFROMPOSITION, start);
+  const long end_line = editor()->SendScintilla(QsciScintilla::SCI_LINEFROMPOSITION, end);
+  start = static_cast<int>(editor()->SendScintilla(QsciScintilla::SCI_POSITIONFROMLINE, start_line));
+  end = static_cast<int>(editor()->SendScintilla(QsciScintilla::SCI_GETLINEENDPOSITION, end_line));
+  if (end <= start) {
     return;
   }
 
+  std::string source(end - start + 1, 0);
+  editor()->SendScintilla(QsciScintilla::SCI_GETTEXTRANGE, start, end, &source[0]);
+  source.resize(end - start);
   paintCommands(source, start);
 }
 
-void BaseCommandsQsciLexer::paintCommands(const QString& source, int start) {
-  for (size_t i = 0; i < commands_.size(); ++i) {
-    core::CommandInfo cmd = commands_[i];
-    QString word;
-    if (common::ConvertFromBytes(cmd.name, &word)) {
-      int index = 0;
-      int begin = 0;
-
-      int st = cmd.type == core::CommandInfo::Native ? Command : ExCommand;
-      while ((begin = source.indexOf(word, index, Qt::CaseInsensitive)) != -1) {
-        index = begin + word.length();
-
-        startStyling(start + begin);
-        setStyling(word.length(), st);
-        startStyling(start + begin);
+void BaseCommandsQsciLexer::paintCommands(const std::string& source, int start) {
+  // single pass over words, positions are bytes as scintilla expects
+  startStyling(start);
+  size_t styled = 0;
+  size_t pos = 0;
+  while (pos < source.size()) {
+    if (IsWordSeparator(source[pos])) {
+      pos++;
+      continue;
+    }
+
+    const size_t word_end = FindWordEnd(source, pos);
+    int style = Default;
+    const size_t match_end = matchCommand(source, pos, word_end, &style);
+    if (match_end) {
+      setStyling(pos - styled, Default);
+      setStyling(match_end - pos, style);
+      styled = match_end;
+      pos = match_end;
+    } else {
+      pos = word_end;
+    }
+  }
+
+  setStyling(source.size() - styled, Default);
+}
+
+size_t BaseCommandsQsciLexer::matchCommand(const std::string& source, size_t pos, size_t word_end, int* style) const {
+  const auto it = keywords_.find(ToUpperWord(source.substr(pos, word_end - pos)));
+  if (it == keywords_.end()) {
+    return 0;
+  }
+
+  for (const Keyword& keyword : it->second) {
+    size_t end = word_end;
+    bool matched = true;
+    for (size_t i = 1; i < keyword.words.size(); ++i) {
+      size_t next = end;
+      while (next < source.size() && IsInlineSpace(source[next])) {
+        next++;
+      }
+      const size_t next_end = FindWordEnd(source, next);
+      if (next == end || ToUpperWord(source.substr(next, next_end - next)) != keyword.words[i]) {
+        matched = false;
+        break;
       }
+      end = next_end;
+    }
+
+    if (matched) {
+      *style = keyword.style;
+      return end;
     }
   }
+
+  return 0;
 }
 
 QString makeCallTip(const core::CommandInfo& info) {
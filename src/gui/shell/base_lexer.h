@@ -18,6 +18,10 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <Qsci/qsciabstractapis.h>
 #include <Qsci/qscilexercustom.h>
 
@@ -31,10 +35,11 @@ class BaseQsciApi : public QsciAbstractAPIs {
 
  public:
   explicit BaseQsciApi(QsciLexer* lexer);
-  void setFilteredVersion(uint32_t version);
+  virtual void setFilteredVersion(uint32_t version);
 
  protected:
   bool canSkipCommand(const core::CommandInfo& info) const;
+  bool canSkipVersion(uint32_t since) const;
 
  private:
   uint32_t filtered_version_;
@@ -80,16 +85,28 @@ class BaseCommandsQsciLexer : public BaseQsciLexer {
   explicit BaseCommandsQsciLexer(const std::vector<core::CommandHolder>& commands, QObject* parent = Q_NULLPTR);
 
  private:
+  // command name split into upper case words, e.g. "CLIENT", "LIST"
+  struct Keyword {
+    std::vector<std::string> words;
+    int style;
+  };
+  // keyed by upper case first word, candidates ordered by words count (longest match first)
+  typedef std::unordered_map<std::string, std::vector<Keyword>> keywords_t;
+  static keywords_t MakeKeywords(const validated_commands_t& commands);
+
   void styleText(int start, int end) override;
-  void paintCommands(const QString& source, int start);
+  void paintCommands(const std::string& source, int start);
+  size_t matchCommand(const std::string& source, size_t pos, size_t word_end, int* style) const;
 
   const validated_commands_t commands_;
+  const keywords_t keywords_;
 };
 
 class BaseCommandsQsciApi : public BaseQsciApi {
   Q_OBJECT
 
  public:
+  void setFilteredVersion(uint32_t version) override;
   void updateAutoCompletionList(const QStringList& context, QStringList& list) override;
   QStringList callTips(const QStringList& context,
                        int commas,
@@ -98,6 +115,21 @@ class BaseCommandsQsciApi : public BaseQsciApi {
 
  protected:
   explicit BaseCommandsQsciApi(BaseCommandsQsciLexer* lexer);
+
+ private:
+  // strings are prepared once, lookups only share them
+  struct IndexEntry {
+    QString key;  // upper case name
+    QString completion;
+    QString call_tip;
+    uint32_t since;
+    bool skipped;  // newer than filtered version
+  };
+  typedef std::vector<IndexEntry> index_t;
+
+  index_t::const_iterator lowerBound(const QString& key) const;
+
+  index_t index_;  // sorted by key
 };
 
 QString makeCallTip(const core::CommandInfo& info);
@@ -24,6 +24,7 @@
 #include <QCheckBox>
 #include <QComboBox>
 #include <QFileDialog>
+#include <QFileInfo>
 #include <QLabel>
 #include <QMessageBox>
 #include <QProgressBar>
@@ -65,6 +66,10 @@ const QString trCantSaveTemplate_2S = QObject::tr(PROJECT_NAME_TITLE " can't sav
 const QString trAdvancedOptions = QObject::tr("Advanced options");
 const QString trIntervalMsec = QObject::tr("Interval msec:");
 const QString trBasedOn_2S = QObject::tr("Based on <b>%1</b> version: <b>%2</b>");
+const QString trRunFile = QObject::tr("Run file");
+const QString trResumeRunFileTemplate_2S = QObject::tr("Previous run stopped at byte %1 of %2.\nContinue from there?");
+const QString trRunFileStoppedTemplate_3S =
+    QObject::tr("Stopped after %1 commands at byte %2 of %3.\nRun the same file again to continue.");
 
 }  // namespace
 
@@ -103,6 +108,7 @@ BaseShellWidget::BaseShellWidget(proxy::IServerSPtr server, const QString& file_
       connect_action_(nullptr),
       disconnect_action_(nullptr),
       load_action_(nullptr),
+      run_file_action_(nullptr),
       save_action_(nullptr),
       save_as_action_(nullptr),
       validate_action_(nullptr),
@@ -120,7 +126,9 @@ BaseShellWidget::BaseShellWidget(proxy::IServerSPtr server, const QString& file_
       repeat_count_(nullptr),
       interval_msec_(nullptr),
       history_call_(nullptr),
-      file_path_(file_path) {}
+      file_path_(file_path),
+      run_file_path_(),
+      run_file_offset_(0) {}
 
 QHBoxLayout* BaseShellWidget::createActionBar() {
   QHBoxLayout* savebar = new QHBoxLayout;
@@ -128,6 +136,10 @@ QHBoxLayout* BaseShellWidget::createActionBar() {
   VERIFY(connect(load_action_, &IconButton::clicked, this, &BaseShellWidget::loadFromFileEmptyPath));
   savebar->addWidget(load_action_);
 
+  run_file_action_ = new IconButton(gui::GuiFactory::GetInstance().importIcon(), kIconSize);
+  VERIFY(connect(run_file_action_, &IconButton::clicked, this, &BaseShellWidget::runFile));
+  savebar->addWidget(run_file_action_);
+
   save_action_ = new IconButton(gui::GuiFactory::GetInstance().saveIcon(), kIconSize);
   VERIFY(connect(save_action_, &IconButton::clicked, this, &BaseShellWidget::saveToFile));
   savebar->addWidget(save_action_);
@@ -181,6 +193,8 @@ void BaseShellWidget::init() {
                  Qt::DirectConnection));
   VERIFY(connect(server_.get(), &proxy::IServer::ExecuteFinished, this, &BaseShellWidget::finishExecute,
                  Qt::DirectConnection));
+  VERIFY(connect(server_.get(), &proxy::IServer::ExecuteFileStarted, this, &BaseShellWidget::startExecuteFile));
+  VERIFY(connect(server_.get(), &proxy::IServer::ExecuteFileFinished, this, &BaseShellWidget::finishExecuteFile));
 
   VERIFY(connect(server_.get(), &proxy::IServer::DatabaseChanged, this, &BaseShellWidget::updateDefaultDatabase));
   VERIFY(connect(server_.get(), &proxy::IServer::Disconnected, this, &BaseShellWidget::serverDisconnect));
@@ -337,6 +351,7 @@ void BaseShellWidget::retranslateUi() {
   validate_action_->setToolTip(translations::trValidate);
   help_action_->setToolTip(translations::trHelp);
   load_action_->setToolTip(translations::trLoad);
+  run_file_action_->setToolTip(trRunFile);
   save_action_->setToolTip(translations::trSave);
   save_as_action_->setToolTip(translations::trSaveAs);
   connect_action_->setToolTip(translations::trConnect);
@@ -410,6 +425,28 @@ void BaseShellWidget::loadFromFileEmptyPath() {
   loadFromFile(QString());
 }
 
+void BaseShellWidget::runFile() {
+  // script is streamed by driver, editor never holds it
+  QString filepath = QFileDialog::getOpenFileName(this, trRunFile, run_file_path_, translations::trfilterForScripts);
+  if (filepath.isEmpty()) {
+    return;
+  }
+
+  uint64_t offset = 0;
+  if (filepath == run_file_path_ && run_file_offset_) {
+    QFileInfo info(filepath);
+    const QMessageBox::StandardButton answer = QMessageBox::question(
+        this, trRunFile, trResumeRunFileTemplate_2S.arg(run_file_offset_).arg(info.size()),
+        QMessageBox::Yes | QMessageBox::No, QMessageBox::Yes);
+    if (answer == QMessageBox::Yes) {
+      offset = run_file_offset_;
+    }
+  }
+
+  proxy::events_info::ExecuteFileRequest req(this, common::ConvertToString(filepath), offset, run_file_pipeline);
+  server_->ExecuteFile(req);
+}
+
 bool BaseShellWidget::loadFromFile(const QString& path) {
   QString filepath = QFileDialog::getOpenFileName(this, path, QString(), translations::trfilterForScripts);
   if (!filepath.isEmpty()) {
@@ -600,6 +637,34 @@ void BaseShellWidget::finishExecute(const proxy::events_info::ExecuteInfoRespons
   stop_action_->setEnabled(false);
 }
 
+void BaseShellWidget::startExecuteFile(const proxy::events_info::ExecuteFileRequest& req) {
+  if (req.initiator() != this) {
+    return;
+  }
+
+  execute_action_->setEnabled(false);
+  run_file_action_->setEnabled(false);
+  stop_action_->setEnabled(true);
+}
+
+void BaseShellWidget::finishExecuteFile(const proxy::events_info::ExecuteFileResponse& res) {
+  if (res.initiator() != this) {
+    return;
+  }
+
+  execute_action_->setEnabled(true);
+  run_file_action_->setEnabled(true);
+  stop_action_->setEnabled(false);
+
+  common::Error err = res.errorInfo();
+  common::ConvertFromString(res.path, &run_file_path_);
+  run_file_offset_ = err ? res.offset_out : 0;
+  if (err) {
+    QMessageBox::warning(this, trRunFile,
+                         trRunFileStoppedTemplate_3S.arg(res.executed).arg(res.offset_out).arg(res.file_size));
+  }
+}
+
 void BaseShellWidget::serverConnect() {
   OnServerConnected();
 }
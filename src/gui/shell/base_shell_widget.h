@@ -60,6 +60,8 @@ struct DiscoveryInfoRequest;
 struct DiscoveryInfoResponse;
 struct ExecuteInfoRequest;
 struct ExecuteInfoResponse;
+struct ExecuteFileRequest;
+struct ExecuteFileResponse;
 struct EnterModeInfo;
 struct LeaveModeInfo;
 struct ProgressInfoResponse;
@@ -81,6 +83,7 @@ class BaseShellWidget : public BaseWidget {
 
   static const QSize kIconSize;
   static const QSize kShellIconSize;
+  enum { run_file_pipeline = 100 };
 
   static BaseShellWidget* createWidgetFactory(proxy::IServerSPtr server,
                                               const QString& file_path = QString(),
@@ -100,6 +103,7 @@ class BaseShellWidget : public BaseWidget {
   void disconnectFromServer();
   void loadFromFile();
   void loadFromFileEmptyPath();
+  void runFile();
   bool loadFromFile(const QString& path);
   void saveToFileAs();
   void saveToFile();
@@ -129,6 +133,9 @@ class BaseShellWidget : public BaseWidget {
   void startExecute(const proxy::events_info::ExecuteInfoRequest& req);
   void finishExecute(const proxy::events_info::ExecuteInfoResponse& res);
 
+  void startExecuteFile(const proxy::events_info::ExecuteFileRequest& req);
+  void finishExecuteFile(const proxy::events_info::ExecuteFileResponse& res);
+
   void serverConnect();
   void serverDisconnect();
 
@@ -170,6 +177,7 @@ class BaseShellWidget : public BaseWidget {
   QPushButton* connect_action_;
   QPushButton* disconnect_action_;
   QPushButton* load_action_;
+  QPushButton* run_file_action_;
   QPushButton* save_action_;
   QPushButton* save_as_action_;
   QPushButton* validate_action_;
@@ -191,6 +199,8 @@ class BaseShellWidget : public BaseWidget {
   QSpinBox* interval_msec_;
   QCheckBox* history_call_;
   QString file_path_;
+  QString run_file_path_;
+  uint64_t run_file_offset_;  // where interrupted run of run_file_path_ stopped
 };
 
 }  // namespace gui
@@ -34,6 +34,8 @@
 
 #include <fastonosql/core/types.h>
 
+#include "gui/fast_codecs.h"
+
 namespace {
 struct json_object* json_tokener_parse_hacked(const char* str, int len) {
   struct json_tokener* tok = json_tokener_new();
@@ -92,6 +94,19 @@ bool string_to_json(const convert_in_t& data, convert_out_t* out) {
 }
 
 bool string_from_hex(const convert_in_t& value, convert_out_t* out) {
+  if (!out) {
+    return false;
+  }
+
+  convert_out_t fast_out;
+  fast_out.resize(value.size() / 4);
+  if (value.size() >= 4 && hex_decode(reinterpret_cast<const char*>(value.data()), value.size(),
+                                   reinterpret_cast<unsigned char*>(&fast_out[0]))) {
+    *out = fast_out;
+    return true;
+  }
+
+  // not "\xHH" text is left for generic decoder
   common::XHexEDcoder enc(core::ReadableString::is_lower_hex);
 
   convert_out_t sout;
@@ -105,14 +120,19 @@ bool string_from_hex(const convert_in_t& value, convert_out_t* out) {
 }
 
 bool string_to_hex(const convert_in_t& data, convert_out_t* out) {
-  common::XHexEDcoder enc(core::ReadableString::is_lower_hex);
-
-  convert_out_t sout;
-  common::Error err = enc.Encode(data, &sout);
-  if (err) {
+  if (!out) {
     return false;
   }
 
+  if (data.empty()) {
+    out->clear();
+    return true;
+  }
+
+  convert_out_t sout;
+  sout.resize(data.size() * 4);
+  hex_encode(reinterpret_cast<const unsigned char*>(data.data()), data.size(), core::ReadableString::is_lower_hex,
+             reinterpret_cast<char*>(&sout[0]));
   *out = sout;
   return true;
 }
@@ -331,6 +351,21 @@ bool string_to_msgpack(const convert_in_t& data, convert_out_t* out) {
 }
 
 bool string_from_base64(const convert_in_t& value, convert_out_t* out) {
+  if (!out) {
+    return false;
+  }
+
+  convert_out_t fast_out;
+  fast_out.resize(value.size() / 4 * 3);
+  size_t fast_size = 0;
+  if (value.size() >= 4 && base64_decode(reinterpret_cast<const char*>(value.data()), value.size(),
+                                      reinterpret_cast<unsigned char*>(&fast_out[0]), &fast_size)) {
+    fast_out.resize(fast_size);
+    *out = fast_out;
+    return true;
+  }
+
+  // unpadded or wrapped text is left for generic decoder
   common::Base64EDcoder enc;
 
   convert_out_t sout;
@@ -344,14 +379,18 @@ bool string_from_base64(const convert_in_t& value, convert_out_t* out) {
 }
 
 bool string_to_base64(const convert_in_t& data, convert_out_t* out) {
-  common::Base64EDcoder enc;
-
-  convert_out_t sout;
-  common::Error err = enc.Encode(data, &sout);
-  if (err) {
+  if (!out) {
     return false;
   }
 
+  if (data.empty()) {
+    out->clear();
+    return true;
+  }
+
+  convert_out_t sout;
+  sout.resize(base64_encoded_size(data.size()));
+  base64_encode(reinterpret_cast<const unsigned char*>(data.data()), data.size(), reinterpret_cast<char*>(&sout[0]));
   *out = sout;
   return true;
 }
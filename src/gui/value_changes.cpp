@@ -0,0 +1,200 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/value_changes.h"
+
+#include <QUuid>
+
+#include <common/qt/convert2string.h>
+
+#include "gui/models/hash_table_model.h"
+#include "gui/models/list_table_model.h"
+
+#define WATCH_COMMAND "WATCH"
+#define UNWATCH_COMMAND "UNWATCH"
+#define MULTI_COMMAND "MULTI"
+#define EXEC_COMMAND "EXEC"
+#define HSET_COMMAND "HSET"
+#define HDEL_COMMAND "HDEL"
+#define SADD_COMMAND "SADD"
+#define SREM_COMMAND "SREM"
+#define ZADD_COMMAND "ZADD"
+#define ZREM_COMMAND "ZREM"
+#define LINDEX_COMMAND "LINDEX"
+#define LSET_COMMAND "LSET"
+#define LREM_COMMAND "LREM"
+#define RPUSH_COMMAND "RPUSH"
+
+namespace fastonosql {
+namespace gui {
+namespace {
+
+core::command_buffer_t KeyCommand(const char* command,
+                                  const core::command_buffer_t& key,
+                                  const common::Value::string_t& arg) {
+  core::command_buffer_writer_t wr;
+  wr << command << " " << key << " " << core::nkey_t(arg).GetForCommandLine();
+  return wr.str();
+}
+
+core::command_buffer_t KeyCommand(const char* command,
+                                  const core::command_buffer_t& key,
+                                  const common::Value::string_t& arg1,
+                                  const common::Value::string_t& arg2) {
+  core::command_buffer_writer_t wr;
+  wr << command << " " << key << " " << core::nkey_t(arg1).GetForCommandLine() << " "
+     << core::nkey_t(arg2).GetForCommandLine();
+  return wr.str();
+}
+
+std::vector<core::command_buffer_t> MakeTransaction(const std::vector<core::command_buffer_t>& commands) {
+  if (commands.empty()) {
+    return commands;
+  }
+
+  // one transaction, other clients never see value half saved; server doesn't roll back commands failed inside EXEC
+  std::vector<core::command_buffer_t> transaction;
+  transaction.reserve(commands.size() + 2);
+  transaction.push_back(GEN_CMD_STRING(MULTI_COMMAND));
+  transaction.insert(transaction.end(), commands.begin(), commands.end());
+  transaction.push_back(GEN_CMD_STRING(EXEC_COMMAND));
+  return transaction;
+}
+
+// removed list elements are marked by LSET and dropped by one LREM, indexes of others stay valid meanwhile;
+// marker is unique per save, so LREM never takes elements of user
+common::Value::string_t MakeListRemovedMarker() {
+  const QString uuid = QString::fromLatin1(QUuid::createUuid().toRfc4122().toHex());
+  return common::ConvertToCharBytes(QString("__fastonosql_removed_%1__").arg(uuid));
+}
+
+}  // namespace
+
+proxy::ValueChangesCommands MakeHashChangesCommands(const core::NKey& key,
+                                                    common::Value::Type type,
+                                                    const HashTableModel* model) {
+  std::vector<HashTableModel::RowChange> removed;
+  std::vector<HashTableModel::RowChange> edited;
+  std::vector<HashTableModel::row_t> added;
+  model->changes(&removed, &edited, &added);
+
+  // all removals go first, renames swapping names would delete just written fields otherwise
+  const core::command_buffer_t key_str = key.GetKey().GetForCommandLine();
+  std::vector<core::command_buffer_t> commands;
+  std::vector<core::command_buffer_t> sets;
+  if (type == common::Value::TYPE_ZSET) {
+    // rows are score, member
+    for (const auto& change : removed) {
+      commands.push_back(KeyCommand(ZREM_COMMAND, key_str, change.stored_value));
+    }
+    for (const auto& change : edited) {
+      if (change.value != change.stored_value) {
+        commands.push_back(KeyCommand(ZREM_COMMAND, key_str, change.stored_value));
+      }
+      sets.push_back(KeyCommand(ZADD_COMMAND, key_str, change.key, change.value));
+    }
+    for (const auto& row : added) {
+      sets.push_back(KeyCommand(ZADD_COMMAND, key_str, row.first, row.second));
+    }
+  } else {
+    for (const auto& change : removed) {
+      commands.push_back(KeyCommand(HDEL_COMMAND, key_str, change.stored_key));
+    }
+    for (const auto& change : edited) {
+      if (change.key != change.stored_key) {
+        commands.push_back(KeyCommand(HDEL_COMMAND, key_str, change.stored_key));
+      }
+      sets.push_back(KeyCommand(HSET_COMMAND, key_str, change.key, change.value));
+    }
+    for (const auto& row : added) {
+      sets.push_back(KeyCommand(HSET_COMMAND, key_str, row.first, row.second));
+    }
+  }
+
+  commands.insert(commands.end(), sets.begin(), sets.end());
+  proxy::ValueChangesCommands result;
+  result.transaction = MakeTransaction(commands);
+  return result;
+}
+
+proxy::ValueChangesCommands MakeListChangesCommands(const core::NKey& key,
+                                                    common::Value::Type type,
+                                                    const ListTableModel* model) {
+  std::vector<ListTableModel::RowChange> removed;
+  std::vector<ListTableModel::RowChange> edited;
+  std::vector<ListTableModel::row_t> added;
+  model->changes(&removed, &edited, &added);
+
+  const core::command_buffer_t key_str = key.GetKey().GetForCommandLine();
+  proxy::ValueChangesCommands result;
+  std::vector<core::command_buffer_t> commands;
+  if (type == common::Value::TYPE_SET) {
+    // all removals go first like for hashes
+    std::vector<core::command_buffer_t> adds;
+    for (const auto& change : removed) {
+      commands.push_back(KeyCommand(SREM_COMMAND, key_str, change.stored_value));
+    }
+    for (const auto& change : edited) {
+      commands.push_back(KeyCommand(SREM_COMMAND, key_str, change.stored_value));
+      adds.push_back(KeyCommand(SADD_COMMAND, key_str, change.value));
+    }
+    for (const auto& value : added) {
+      adds.push_back(KeyCommand(SADD_COMMAND, key_str, value));
+    }
+    commands.insert(commands.end(), adds.begin(), adds.end());
+  } else {
+    // rows are addressed by index: each of them must still hold value seen at load until EXEC
+    auto add_check = [&result, &key_str](const ListTableModel::RowChange& change) {
+      core::command_buffer_writer_t wr;
+      wr << LINDEX_COMMAND " " << key_str << " " << change.stored_index;
+      result.checks.push_back(std::make_pair(wr.str(), change.stored_value));
+    };
+    for (const auto& change : edited) {
+      add_check(change);
+      core::command_buffer_writer_t wr;
+      wr << LSET_COMMAND " " << key_str << " " << change.stored_index << " "
+         << core::nkey_t(change.value).GetForCommandLine();
+      commands.push_back(wr.str());
+    }
+    if (!removed.empty()) {
+      const core::command_buffer_t marker = core::nkey_t(MakeListRemovedMarker()).GetForCommandLine();
+      for (const auto& change : removed) {
+        add_check(change);
+        core::command_buffer_writer_t wr;
+        wr << LSET_COMMAND " " << key_str << " " << change.stored_index << " " << marker;
+        commands.push_back(wr.str());
+      }
+      core::command_buffer_writer_t wr;
+      wr << LREM_COMMAND " " << key_str << " " << removed.size() << " " << marker;
+      commands.push_back(wr.str());
+    }
+    for (const auto& value : added) {
+      commands.push_back(KeyCommand(RPUSH_COMMAND, key_str, value));
+    }
+    if (!result.checks.empty()) {
+      result.watch = KeyCommand(WATCH_COMMAND, key_str);
+      result.unwatch = GEN_CMD_STRING(UNWATCH_COMMAND);
+    }
+  }
+
+  result.transaction = MakeTransaction(commands);
+  return result;
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,43 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include <fastonosql/core/db_key.h>
+
+#include "proxy/types.h"
+
+namespace fastonosql {
+namespace gui {
+
+class HashTableModel;
+class ListTableModel;
+
+// minimal commands turning stored rows of model into edited ones (HSET/HDEL, ZADD/ZREM, SADD/SREM, LSET/RPUSH),
+// wrapped in MULTI/EXEC; list changes address rows by index, so they are guarded by WATCH and checks of stored rows
+proxy::ValueChangesCommands MakeHashChangesCommands(const core::NKey& key,
+                                                    common::Value::Type type,
+                                                    const HashTableModel* model);
+proxy::ValueChangesCommands MakeListChangesCommands(const core::NKey& key,
+                                                    common::Value::Type type,
+                                                    const ListTableModel* model);
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -203,7 +203,7 @@ void FastoEditorModelOutput::layoutChanged() {
 
   int vm = editor_->viewMethod();
   if (result.empty()) {
-    editor_->setError(translations::trCannotConvertPattern_1S.arg(QString(g_output_views_text[vm])));
+    editor_->setError(translations::trCannotConvertPattern_1S.arg(outputViewText(vm)));
     return;
   }
 
@@ -22,7 +22,7 @@
 #include <QMenu>
 #include <QScrollBar>
 #include <QTextEdit>
-#include <QTime>
+#include <QDateTime>
 
 #include <common/qt/convert2string.h>
 
@@ -33,6 +33,7 @@ namespace gui {
 
 CommandsWidget::CommandsWidget(QWidget* parent) : base_class(parent), log_text_edit_(new QTextEdit) {
   log_text_edit_->setReadOnly(true);
+  log_text_edit_->document()->setMaximumBlockCount(max_lines);
   log_text_edit_->setContextMenuPolicy(Qt::CustomContextMenu);
   VERIFY(connect(log_text_edit_, &QTextEdit::customContextMenuRequested, this, &CommandsWidget::showContextMenu));
 
@@ -42,22 +43,26 @@ CommandsWidget::CommandsWidget(QWidget* parent) : base_class(parent), log_text_e
   setLayout(main_layout);
 }
 
-void CommandsWidget::addCommand(core::FastoObjectCommandIPtr command) {
-  QString mess;
-  if (!common::ConvertFromBytes(command->GetInputCommand(), &mess)) {
-    return;
+void CommandsWidget::addCommands(const proxy::command_log_entries_t& entries) {
+  // one repaint per batch instead of per command
+  log_text_edit_->setUpdatesEnabled(false);
+  for (const auto& entry : entries) {
+    QString mess;
+    if (!common::ConvertFromBytes(entry.input, &mess)) {
+      continue;
+    }
+
+    std::string stype = core::ConnectionTypeToString(entry.connection_type);
+    QString qstype;
+    if (!common::ConvertFromString(stype, &qstype)) {
+      continue;
+    }
+
+    QTime time = QDateTime::fromMSecsSinceEpoch(entry.timestamp).time();
+    log_text_edit_->setTextColor(entry.logging_type == core::C_INNER ? QColor(Qt::gray) : QColor(Qt::black));
+    log_text_edit_->append(time.toString("[%1] hh:mm:ss.zzz: %2").arg(qstype.toUpper(), mess));
   }
-
-  std::string stype = core::ConnectionTypeToString(command->GetConnectionType());
-  QString qstype;
-  if (!common::ConvertFromString(stype, &qstype)) {
-    return;
-  }
-
-  QTime time = QTime::currentTime();
-  log_text_edit_->setTextColor(command->GetCommandLoggingType() == core::C_INNER ? QColor(Qt::gray)
-                                                                                 : QColor(Qt::black));
-  log_text_edit_->append(time.toString("[%1] hh:mm:ss.zzz: %2").arg(qstype.toUpper(), mess));
+  log_text_edit_->setUpdatesEnabled(true);
   QScrollBar* sb = log_text_edit_->verticalScrollBar();
   sb->setValue(sb->maximum());
 }
@@ -22,6 +22,8 @@
 
 #include <fastonosql/core/global.h>
 
+#include "proxy/command/command_log_ring.h"
+
 class QTextEdit;
 
 namespace fastonosql {
@@ -34,9 +36,10 @@ class CommandsWidget : public BaseWidget {
   typedef BaseWidget base_class;
   template <typename T, typename... Args>
   friend T* createWidget(Args&&... args);
+  enum { max_lines = 10000 };
 
  public Q_SLOTS:
-  void addCommand(core::FastoObjectCommandIPtr command);
+  void addCommands(const proxy::command_log_entries_t& entries);
 
  private Q_SLOTS:
   void showContextMenu(const QPoint& pt);
@@ -34,12 +34,18 @@
 
 #include <fastonosql/core/types.h>
 
+#include "proxy/value_codec_sniffer.h"
+
+#include "gui/converter_plugins.h"
+#include "gui/fast_codecs.h"
 #include "gui/python_converter.h"
 #include "gui/text_converter.h"
+#include "gui/workers/view_converter.h"
 #include "translations/global.h"
 
 namespace {
 const QString trNoteInHexedView = QObject::tr("Note: value is hexed (contains unreadable symbols).");
+const QString trConverting = QObject::tr("Converting...");
 }
 
 namespace fastonosql {
@@ -88,12 +94,16 @@ bool convertFromViewImplRoutine(OutputView view_method, const convert_in_t& val,
   } else if (view_method == XML_VIEW) {
     *out = val;
     return true;
+  } else if (view_method >= PLUGIN_VIEW) {
+    return ConverterPlugins::GetInstance().Encode(view_method - PLUGIN_VIEW, val, out);
   }
 
   NOTREACHED() << "Please handle all types!";
   return false;
 }
 
+bool convertToViewTask(int view_method, const convert_in_t& text, convert_out_t* out);
+
 bool convertFromViewImpl(OutputView view_method, const convert_out_t& val, convert_in_t* out) {
   return convertFromViewImplRoutine(view_method, val, out);
 }
@@ -139,12 +149,18 @@ bool convertToViewImpl(OutputView view_method, const convert_in_t& text, convert
   } else if (view_method == XML_VIEW) {  // raw
     *out = text;
     return true;
+  } else if (view_method >= PLUGIN_VIEW) {
+    return ConverterPlugins::GetInstance().Decode(view_method - PLUGIN_VIEW, text, out);
   }
 
   NOTREACHED() << "Please handle all types!";
   return false;
 }
 
+bool convertToViewTask(int view_method, const convert_in_t& text, convert_out_t* out) {
+  return convertToViewImpl(static_cast<OutputView>(view_method), text, out);
+}
+
 }  // namespace
 
 const std::vector<const char*> g_output_views_text = {
@@ -152,18 +168,55 @@ const std::vector<const char*> g_output_views_text = {
     "From Unicode", "To Pickle", "From Pickle", "MsgPack (Beta)", "Zlib",      "GZip",        "LZ4",
     "BZip2",        "Snappy",    "Xml"};
 
+QString outputViewText(int view_method) {
+  if (view_method >= PLUGIN_VIEW) {
+    return ConverterPlugins::GetInstance().GetName(view_method - PLUGIN_VIEW);
+  }
+
+  return g_output_views_text[view_method];
+}
+
+OutputView sniffOutputView(const core::readable_string_t& text) {
+  const proxy::ValueCodec codec = proxy::SniffValueCodec(reinterpret_cast<const char*>(text.data()), text.size());
+  if (codec == proxy::kValueCodecJson) {
+    return JSON_VIEW;
+  } else if (codec == proxy::kValueCodecXml) {
+    return XML_VIEW;
+  } else if (codec == proxy::kValueCodecMsgPack) {
+    return MSGPACK_VIEW;
+  } else if (codec == proxy::kValueCodecPickle) {
+    return FROM_PICKLE_VIEW;
+  } else if (codec == proxy::kValueCodecZlib) {
+    return ZLIB_VIEW;
+  } else if (codec == proxy::kValueCodecGzip) {
+    return GZIP_VIEW;
+  } else if (codec == proxy::kValueCodecLz4) {
+    return LZ4_VIEW;
+  } else if (codec == proxy::kValueCodecBzip2) {
+    return BZIP2_VIEW;
+  } else if (codec == proxy::kValueCodecSnappy) {
+    return SNAPPY_VIEW;
+  }
+
+  return RAW_VIEW;
+}
+
 FastoViewer::FastoViewer(QWidget* parent)
     : base_class(parent),
       view_method_(RAW_VIEW),
       error_box_(nullptr),
       note_box_(nullptr),
       last_valid_text_(),
-      is_binary_(false) {
+      is_binary_(false),
+      is_view_text_setting_(false),
+      read_only_(false),
+      convert_request_id_(0) {
   text_json_editor_ = createWidget<FastoEditor>();
   json_lexer_ = new QsciLexerJSON(this);
   xml_lexer_ = new QsciLexerXML(this);
   VERIFY(connect(text_json_editor_, &FastoEditor::textChanged, this, &FastoViewer::textChange));
   VERIFY(connect(text_json_editor_, &FastoEditor::readOnlyChanged, this, &FastoViewer::readOnlyChanged));
+  VERIFY(connect(ViewConverter::GetInstance(), &ViewConverter::converted, this, &FastoViewer::finishConvert));
 
   error_box_ = new QLabel;
   error_box_->setVisible(false);
@@ -176,6 +229,9 @@ FastoViewer::FastoViewer(QWidget* parent)
   for (unsigned i = 0; i < g_output_views_text.size(); ++i) {
     views_combo_box_->addItem(g_output_views_text[i], i);
   }
+  for (size_t i = 0; i < ConverterPlugins::GetInstance().GetCount(); ++i) {
+    views_combo_box_->addItem(ConverterPlugins::GetInstance().GetName(i), static_cast<unsigned>(PLUGIN_VIEW + i));
+  }
 
   typedef void (QComboBox::*ind)(int);
   VERIFY(connect(views_combo_box_, static_cast<ind>(&QComboBox::currentIndexChanged), this, &FastoViewer::viewChange));
@@ -218,7 +274,8 @@ void FastoViewer::setViewChangeEnabled(bool enable) {
 }
 
 void FastoViewer::setReadOnly(bool ro) {
-  text_json_editor_->setReadOnly(ro);
+  read_only_ = ro;
+  text_json_editor_->setReadOnly(read_only_ || convert_request_id_ != 0);
 }
 
 void FastoViewer::viewChange(int view_method) {
@@ -229,8 +286,9 @@ void FastoViewer::viewChange(int view_method) {
 }
 
 void FastoViewer::textChange() {
+  // value is already known when view text is set from it, converting back would repeat heavy conversion
   view_output_text_t str_text;
-  if (convertFromView(&str_text)) {
+  if (!is_view_text_setting_ && convert_request_id_ == 0 && convertFromView(&str_text)) {
     clearError();
     last_valid_text_ = str_text;
   }
@@ -238,6 +296,7 @@ void FastoViewer::textChange() {
 }
 
 void FastoViewer::clear() {
+  cancelConvert();
   text_json_editor_->clear();
   clearError();
   last_valid_text_.clear();
@@ -253,9 +312,22 @@ FastoViewer::view_input_text_t FastoViewer::text() const {
 }
 
 bool FastoViewer::setText(const view_input_text_t& text) {
+  cancelConvert();
+  if (isAsyncConvert(text)) {
+    last_valid_text_ = text;
+    clearError();
+    setEditorText(QString());
+    note_box_->setText(trConverting);
+    note_box_->setVisible(true);
+    // typed text would replace value, but view of value isn't shown yet
+    text_json_editor_->setReadOnly(true);
+    convert_request_id_ = ViewConverter::GetInstance()->ConvertAsync(&convertToViewTask, view_method_, text);
+    return true;
+  }
+
   view_output_text_t result_str;
   if (!convertToView(text, &result_str)) {
-    QString method_text = g_output_views_text[view_method_];
+    QString method_text = outputViewText(view_method_);
     setError(translations::trCannotConvertPattern_1S.arg(method_text));
     note_box_->setVisible(false);
     return false;
@@ -266,25 +338,62 @@ bool FastoViewer::setText(const view_input_text_t& text) {
   return true;
 }
 
+void FastoViewer::finishConvert(quint64 id, bool is_ok, const QByteArray& data) {
+  if (convert_request_id_ == 0 || id != convert_request_id_) {
+    return;
+  }
+
+  convert_request_id_ = 0;
+  text_json_editor_->setReadOnly(read_only_);
+  note_box_->setText(trNoteInHexedView);
+  if (!is_ok) {
+    QString method_text = outputViewText(view_method_);
+    setError(translations::trCannotConvertPattern_1S.arg(method_text));
+    note_box_->setVisible(false);
+    return;
+  }
+
+  setViewText(GEN_READABLE_STRING_SIZE(data.constData(), data.size()));
+}
+
 void FastoViewer::setViewText(const view_input_text_t& text) {
   clearError();
   QString qtext;
   is_binary_ = core::detail::is_binary_data(text);
   if (is_binary_) {
     convert_in_t hexed;
-    bool is_ok = common::utils::xhex::encode(text, is_lower_hex, &hexed);
-    DCHECK(is_ok) << "Can't hexed: " << text;
+    hexed.resize(text.size() * 4);
+    hex_encode(reinterpret_cast<const unsigned char*>(text.data()), text.size(), is_lower_hex,
+               reinterpret_cast<char*>(&hexed[0]));
     common::ConvertFromBytes(hexed, &qtext);
     note_box_->setVisible(true);
   } else {
     common::ConvertFromBytes(text, &qtext);
     note_box_->setVisible(false);
   }
-  text_json_editor_->setText(qtext);
+  setEditorText(qtext);
+}
+
+void FastoViewer::setEditorText(const QString& text) {
+  is_view_text_setting_ = true;
+  text_json_editor_->setText(text);
+  is_view_text_setting_ = false;
+}
+
+void FastoViewer::cancelConvert() {
+  if (convert_request_id_ == 0) {
+    return;
+  }
+
+  ViewConverter::GetInstance()->Cancel(convert_request_id_);
+  convert_request_id_ = 0;
+  text_json_editor_->setReadOnly(read_only_);
+  note_box_->setText(trNoteInHexedView);
+  note_box_->setVisible(false);
 }
 
 bool FastoViewer::isReadOnly() const {
-  return text_json_editor_->isReadOnly();
+  return read_only_;
 }
 
 void FastoViewer::retranslateUi() {
@@ -302,6 +411,15 @@ void FastoViewer::clearError() {
   error_box_->setVisible(false);
 }
 
+bool FastoViewer::isAsyncConvert(const view_input_text_t& text) const {
+  if (text.empty() || view_method_ == RAW_VIEW || view_method_ == XML_VIEW) {
+    return false;
+  }
+
+  // pickle waits for python interpreter, small values are converted in place to avoid flicker
+  return view_method_ == TO_PICKLE_VIEW || view_method_ == FROM_PICKLE_VIEW || text.size() >= async_convert_min_size;
+}
+
 bool FastoViewer::isError() const {
   return error_box_->isVisible();
 }
@@ -315,7 +433,9 @@ bool FastoViewer::convertFromView(view_output_text_t* out) const {
   convert_out_t cout;
   if (is_binary_) {
     convert_in_t cin = common::ConvertToCharBytes(cur_text);
-    common::utils::xhex::decode(cin, &cout);
+    if (!string_from_hex(cin, &cout)) {
+      return false;
+    }
   } else {
     cout = common::ConvertToCharBytes(cur_text);
   }
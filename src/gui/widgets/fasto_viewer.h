@@ -20,6 +20,8 @@
 
 #include <vector>
 
+#include <QByteArray>
+
 #include <fastonosql/core/basic_types.h>
 
 #include "gui/widgets/base_widget.h"
@@ -53,10 +55,13 @@ enum OutputView : uint8_t {
   LZ4_VIEW,      // from
   BZIP2_VIEW,    // from
   SNAPPY_VIEW,   // from
-  XML_VIEW       // raw
+  XML_VIEW,      // raw
+  PLUGIN_VIEW    // first of ConverterPlugins, from
 };
 
 extern const std::vector<const char*> g_output_views_text;
+QString outputViewText(int view_method);  // built-in or plugin name
+OutputView sniffOutputView(const core::readable_string_t& text);  // by signature of first bytes, RAW_VIEW if unknown
 
 class FastoViewer : public BaseWidget {
   Q_OBJECT
@@ -66,7 +71,7 @@ class FastoViewer : public BaseWidget {
   template <typename T, typename... Args>
   friend T* createWidget(Args&&... args);
 
-  enum { is_lower_hex = true };
+  enum { is_lower_hex = true, async_convert_min_size = 64 * 1024 };
   typedef core::readable_string_t view_input_text_t;
   typedef core::readable_string_t view_output_text_t;
 
@@ -94,6 +99,7 @@ class FastoViewer : public BaseWidget {
  private Q_SLOTS:
   void viewChange(int view_method);
   void textChange();
+  void finishConvert(quint64 id, bool is_ok, const QByteArray& data);
 
  protected:
   explicit FastoViewer(QWidget* parent = Q_NULLPTR);
@@ -101,7 +107,11 @@ class FastoViewer : public BaseWidget {
 
  private:
   void setViewText(const view_input_text_t& text);
+  void setEditorText(const QString& text);  // without converting text back to value
+  void cancelConvert();
 
+  // conversion goes to ViewConverter pool, view is filled when it replies
+  bool isAsyncConvert(const view_input_text_t& text) const;
   bool isError() const;
 
   bool convertToView(const view_input_text_t& text, view_output_text_t* out) const;
@@ -122,6 +132,9 @@ class FastoViewer : public BaseWidget {
 
   view_input_text_t last_valid_text_;
   bool is_binary_;
+  bool is_view_text_setting_;
+  bool read_only_;              // set by owner, editor is also read only while converting
+  quint64 convert_request_id_;  // 0 if nothing is converting
 };
 
 }  // namespace gui
@@ -63,6 +63,12 @@ void HashTypeView::clear() {
   emit dataChangedSignal();
 }
 
+void HashTypeView::setStoredRows(const std::vector<row_t>& rows) {
+  model_->clear();
+  model_->appendPage(rows, rows.size(), true);
+  emit dataChangedSignal();
+}
+
 common::ZSetValue* HashTypeView::zsetValue() const {
   return model_->zsetValue();
 }
@@ -88,6 +94,10 @@ void HashTypeView::setCurrentMode(Mode mode) {
   }
 }
 
+HashTableModel* HashTypeView::tableModel() const {
+  return model_;
+}
+
 void HashTypeView::addRow(const QModelIndex& index) {
   KeyValueTableItem* node = common::qt::item<common::qt::gui::TableItem*, KeyValueTableItem*>(index);
   insertRow(node->key(), node->value());
@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include <QTableView>
 
 #include <common/value.h>
@@ -33,6 +36,7 @@ class HashTypeView : public QTableView {
  public:
   typedef common::Value::string_t key_t;
   typedef common::Value::string_t value_t;
+  typedef std::pair<key_t, value_t> row_t;
   typedef QTableView base_class;
   enum Mode : uint8_t { kHash = 0, kZset };
 
@@ -40,6 +44,7 @@ class HashTypeView : public QTableView {
 
   void insertRow(const key_t& key, const value_t& value);
   void clear();
+  void setStoredRows(const std::vector<row_t>& rows);  // rows as in database, edits are tracked against them
 
   common::ZSetValue* zsetValue() const;  // alocate memory
   common::HashValue* hashValue() const;  // alocate memory
@@ -47,6 +52,8 @@ class HashTypeView : public QTableView {
   Mode currentMode() const;
   void setCurrentMode(Mode mode);
 
+  HashTableModel* tableModel() const;
+
  Q_SIGNALS:
   void dataChangedSignal();
   void rowChanged(const key_t& key, const value_t& value);
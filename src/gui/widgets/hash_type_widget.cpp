@@ -76,6 +76,10 @@ void HashTypeWidget::clear() {
   view_->clear();
 }
 
+void HashTypeWidget::setStoredRows(const std::vector<HashTypeView::row_t>& rows) {
+  view_->setStoredRows(rows);
+}
+
 common::ZSetValue* HashTypeWidget::zsetValue() const {
   return view_->zsetValue();
 }
@@ -92,6 +96,10 @@ void HashTypeWidget::setCurrentMode(HashTypeView::Mode mode) {
   view_->setCurrentMode(mode);
 }
 
+HashTableModel* HashTypeWidget::tableModel() const {
+  return view_->tableModel();
+}
+
 void HashTypeWidget::valueUpdate(const HashTypeView::key_t& key, const HashTypeView::value_t& value) {
   key_edit_->clear();
   key_edit_->setText(key);
@@ -38,6 +38,7 @@ class HashTypeWidget : public BaseWidget {
 
   void insertRow(const HashTypeView::key_t& key, const HashTypeView::value_t& value);
   void clear();
+  void setStoredRows(const std::vector<HashTypeView::row_t>& rows);
 
   common::ZSetValue* zsetValue() const;  // alocate memory
   common::HashValue* hashValue() const;  // alocate memory
@@ -45,6 +46,8 @@ class HashTypeWidget : public BaseWidget {
   HashTypeView::Mode currentMode() const;
   void setCurrentMode(HashTypeView::Mode mode);
 
+  HashTableModel* tableModel() const;
+
  Q_SIGNALS:
   void dataChangedSignal();
 
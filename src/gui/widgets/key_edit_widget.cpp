@@ -33,6 +33,7 @@
 
 #include "gui/gui_factory.h"
 #include "gui/models/hash_table_model.h"
+#include "gui/value_changes.h"
 
 #include "gui/widgets/fasto_viewer.h"
 #include "gui/widgets/hash_type_widget.h"
@@ -44,7 +45,8 @@
 namespace fastonosql {
 namespace gui {
 
-KeyEditWidget::KeyEditWidget(QWidget* parent) : base_class(parent) {
+KeyEditWidget::KeyEditWidget(QWidget* parent)
+    : base_class(parent), init_key_(), init_key_name_(), stored_type_(common::Value::TYPE_NULL) {
   type_label_ = new QLabel;
   types_combo_box_ = new QComboBox;
   typedef void (QComboBox::*ind)(int);
@@ -123,6 +125,8 @@ void KeyEditWidget::initialize(const std::vector<common::Value::Type>& availible
   if (common::ConvertFromBytes(raw_key.GetForCommandLine(), &qkey)) {
     key_edit_->setText(qkey);
   }
+  init_key_ = nkey;
+  init_key_name_ = key_edit_->text();
 
   types_combo_box_->setCurrentIndex(current_index);
   syncControls(val);
@@ -235,6 +239,7 @@ void KeyEditWidget::changeType(int index) {
   QVariant var = types_combo_box_->itemData(index);
   common::Value::Type type = static_cast<common::Value::Type>(qvariant_cast<unsigned char>(var));
 
+  stored_type_ = common::Value::TYPE_NULL;
   value_edit_->clear();
   json_value_edit_->clear();
   value_table_edit_->clear();
@@ -326,30 +331,41 @@ void KeyEditWidget::syncControls(const core::NValue& item) {
   if (type == common::Value::TYPE_ARRAY) {
     common::ArrayValue* arr = nullptr;
     if (item->GetAsList(&arr)) {
+      std::vector<ListTypeView::row_t> rows;
+      rows.reserve(arr->GetSize());
       for (auto it = arr->begin(); it != arr->end(); ++it) {
         const auto val = core::ConvertValue(*it, core::NValue::default_delimiter);
         if (val.empty()) {
           continue;
         }
 
-        value_list_edit_->insertRow(val);
+        rows.push_back(val);
+      }
+      value_list_edit_->setStoredRows(rows);
+      // skipped elements shift indexes of stored rows
+      if (rows.size() == arr->GetSize()) {
+        stored_type_ = type;
       }
     }
   } else if (type == common::Value::TYPE_SET) {
     common::SetValue* set = nullptr;
     if (item->GetAsSet(&set)) {
+      std::vector<ListTypeView::row_t> rows;
       for (auto it = set->begin(); it != set->end(); ++it) {
         const auto val = core::ConvertValue(*it, core::NValue::default_delimiter);
         if (val.empty()) {
           continue;
         }
 
-        value_list_edit_->insertRow(val);
+        rows.push_back(val);
       }
+      value_list_edit_->setStoredRows(rows);
+      stored_type_ = type;
     }
   } else if (type == common::Value::TYPE_ZSET) {
     common::ZSetValue* zset = nullptr;
     if (item->GetAsZSet(&zset)) {
+      std::vector<HashTypeView::row_t> rows;
       for (auto it = zset->begin(); it != zset->end(); ++it) {
         auto element = (*it);
         common::Value* key = element.first;
@@ -364,12 +380,15 @@ void KeyEditWidget::syncControls(const core::NValue& item) {
           continue;
         }
 
-        value_table_edit_->insertRow(key_str, value_str);
+        rows.push_back(HashTypeView::row_t(key_str, value_str));
       }
+      value_table_edit_->setStoredRows(rows);
+      stored_type_ = type;
     }
   } else if (type == common::Value::TYPE_HASH) {
     common::HashValue* hash = nullptr;
     if (item->GetAsHash(&hash)) {
+      std::vector<HashTypeView::row_t> rows;
       for (auto it = hash->begin(); it != hash->end(); ++it) {
         auto element = (*it);
         const auto key_str = element.first;
@@ -383,8 +402,10 @@ void KeyEditWidget::syncControls(const core::NValue& item) {
           continue;
         }
 
-        value_table_edit_->insertRow(key_str, value_str);
+        rows.push_back(HashTypeView::row_t(key_str, value_str));
       }
+      value_table_edit_->setStoredRows(rows);
+      stored_type_ = type;
     }
   } else if (type == core::StreamValue::TYPE_STREAM) {
     core::StreamValue* stream = static_cast<core::StreamValue*>(item.get());
@@ -400,7 +421,7 @@ void KeyEditWidget::syncControls(const core::NValue& item) {
         json_value_edit_->setView(JSON_VIEW);
         json_value_edit_->setViewChangeEnabled(false);
       } else {
-        json_value_edit_->setView(RAW_VIEW);
+        json_value_edit_->setView(sniffOutputView(text));
         json_value_edit_->setViewChangeEnabled(true);
       }
       json_value_edit_->setText(text);
@@ -456,6 +477,29 @@ bool KeyEditWidget::getKey(core::NDbKValue* key) const {
   return true;
 }
 
+bool KeyEditWidget::getChangesCommands(proxy::ValueChangesCommands* commands) const {
+  if (!commands) {
+    return false;
+  }
+
+  int index = types_combo_box_->currentIndex();
+  QVariant var = types_combo_box_->itemData(index);
+  common::Value::Type type = static_cast<common::Value::Type>(qvariant_cast<unsigned char>(var));
+  if (stored_type_ == common::Value::TYPE_NULL || type != stored_type_ || key_edit_->text() != init_key_name_) {
+    return false;
+  }
+
+  if (type == common::Value::TYPE_ARRAY || type == common::Value::TYPE_SET) {
+    *commands = MakeListChangesCommands(init_key_, type, value_list_edit_->tableModel());
+    return true;
+  } else if (type == common::Value::TYPE_ZSET || type == common::Value::TYPE_HASH) {
+    *commands = MakeHashChangesCommands(init_key_, type, value_table_edit_->tableModel());
+    return true;
+  }
+
+  return false;
+}
+
 void KeyEditWidget::retranslateUi() {
   value_label_->setText(translations::trValue + ":");
   key_label_->setText(translations::trKey + ":");
@@ -24,6 +24,8 @@
 
 #include "gui/widgets/base_widget.h"
 
+#include "proxy/types.h"
+
 class QLineEdit;
 class QComboBox;
 class QLabel;
@@ -49,6 +51,9 @@ class KeyEditWidget : public BaseWidget {
   void setEnableKeyEdit(bool key_edit);
 
   bool getKey(core::NDbKValue* key) const;
+  // commands saving only edited rows of collection value, false if key must be rewritten whole
+  // (not a collection, renamed or retyped), empty commands if nothing changed
+  bool getChangesCommands(proxy::ValueChangesCommands* commands) const;
 
  Q_SIGNALS:
   void typeChanged(common::Value::Type type);
@@ -75,6 +80,10 @@ class KeyEditWidget : public BaseWidget {
   ListTypeWidget* value_list_edit_;
   HashTypeWidget* value_table_edit_;
   StreamTypeWidget* stream_table_edit_;
+
+  core::NKey init_key_;
+  QString init_key_name_;
+  common::Value::Type stored_type_;  // type of rows synced from database, TYPE_NULL if there are none
 };
 
 }  // namespace gui
@@ -72,6 +72,12 @@ void ListTypeView::clear() {
   emit dataChangedSignal();
 }
 
+void ListTypeView::setStoredRows(const std::vector<row_t>& rows) {
+  model_->clear();
+  model_->appendPage(rows, rows.size(), true);
+  emit dataChangedSignal();
+}
+
 ListTypeView::Mode ListTypeView::currentMode() const {
   return mode_;
 }
@@ -87,6 +93,10 @@ void ListTypeView::setCurrentMode(Mode mode) {
   }
 }
 
+ListTableModel* ListTypeView::tableModel() const {
+  return model_;
+}
+
 void ListTypeView::addRow(const QModelIndex& index) {
   ValueTableItem* node = common::qt::item<common::qt::gui::TableItem*, ValueTableItem*>(index);
   insertRow(node->value());
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <QTableView>
 
 #include <common/value.h>
@@ -42,10 +44,13 @@ class ListTypeView : public QTableView {
 
   void insertRow(const row_t& value);
   void clear();
+  void setStoredRows(const std::vector<row_t>& rows);  // rows as in database, edits are tracked against them
 
   Mode currentMode() const;
   void setCurrentMode(Mode mode);
 
+  ListTableModel* tableModel() const;
+
  Q_SIGNALS:
   void dataChangedSignal();
   void rowChanged(const row_t& value);
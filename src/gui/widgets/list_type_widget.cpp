@@ -78,6 +78,10 @@ void ListTypeWidget::clear() {
   view_->clear();
 }
 
+void ListTypeWidget::setStoredRows(const std::vector<ListTypeView::row_t>& rows) {
+  view_->setStoredRows(rows);
+}
+
 ListTypeView::Mode ListTypeWidget::currentMode() const {
   return view_->currentMode();
 }
@@ -86,6 +90,10 @@ void ListTypeWidget::setCurrentMode(ListTypeView::Mode mode) {
   view_->setCurrentMode(mode);
 }
 
+ListTableModel* ListTypeWidget::tableModel() const {
+  return view_->tableModel();
+}
+
 void ListTypeWidget::valueUpdate(const ListTypeView::row_t& value) {
   value_edit_->clear();
   value_edit_->setText(value);
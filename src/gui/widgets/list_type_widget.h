@@ -41,10 +41,13 @@ class ListTypeWidget : public BaseWidget {
 
   void insertRow(const ListTypeView::row_t& value);
   void clear();
+  void setStoredRows(const std::vector<ListTypeView::row_t>& rows);
 
   ListTypeView::Mode currentMode() const;
   void setCurrentMode(ListTypeView::Mode mode);
 
+  ListTableModel* tableModel() const;
+
  Q_SIGNALS:
   void dataChangedSignal();
 
@@ -57,8 +57,8 @@ void LogTabWidget::addLogMessage(const QString& message, common::logging::LOG_LE
   log_->addLogMessage(message, level);
 }
 
-void LogTabWidget::addCommand(core::FastoObjectCommandIPtr command) {
-  commands_->addCommand(command);
+void LogTabWidget::addCommands(const proxy::command_log_entries_t& entries) {
+  commands_->addCommands(entries);
 }
 
 void LogTabWidget::changeEvent(QEvent* e) {
@@ -22,6 +22,8 @@
 
 #include <fastonosql/core/global.h>
 
+#include "proxy/command/command_log_ring.h"
+
 namespace fastonosql {
 namespace gui {
 class CommandsWidget;
@@ -38,7 +40,7 @@ class LogTabWidget : public QTabWidget {
 
  public Q_SLOTS:
   void addLogMessage(const QString& message, common::logging::LOG_LEVEL level);
-  void addCommand(core::FastoObjectCommandIPtr command);
+  void addCommands(const proxy::command_log_entries_t& entries);
 
  protected:
   void changeEvent(QEvent* ev) override;
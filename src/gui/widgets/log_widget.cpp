@@ -18,48 +18,140 @@
 
 #include "gui/widgets/log_widget.h"
 
+#include <algorithm>
+#include <string>
+
 #include <QAction>
+#include <QActionGroup>
+#include <QApplication>
+#include <QClipboard>
 #include <QHBoxLayout>
+#include <QListView>
 #include <QMenu>
 #include <QScrollBar>
-#include <QTextEdit>
-#include <QTime>
 
+#include <common/file_system/file_system.h>
+#include <common/logger.h>
 #include <common/macros.h>
+#include <common/qt/convert2string.h>
+
+#include "proxy/settings_manager.h"
+
+#include "gui/models/log_messages_model.h"
 
 #include "translations/global.h"
 
+#define LOG_SPILL_FILE_NAME "messages.log"
+
+namespace {
+const QString trCopySelected = QObject::tr("Copy");
+const QString trLevel = QObject::tr("Level");
+const QString trSpillToDisk = QObject::tr("Save evicted messages to history directory");
+const QString trLevels[] = {QObject::tr("Emergency"), QObject::tr("Alert"),  QObject::tr("Critical"),
+                            QObject::tr("Error"),     QObject::tr("Warning"), QObject::tr("Notice"),
+                            QObject::tr("Info"),      QObject::tr("Debug")};
+}  // namespace
+
 namespace fastonosql {
 namespace gui {
 
-LogWidget::LogWidget(QWidget* parent) : base_class(parent), log_text_edit_(new QTextEdit) {
-  log_text_edit_->setReadOnly(true);
-  log_text_edit_->setContextMenuPolicy(Qt::CustomContextMenu);
-  VERIFY(connect(log_text_edit_, &QTextEdit::customContextMenuRequested, this, &LogWidget::showContextMenu));
+LogWidget::LogWidget(QWidget* parent)
+    : base_class(parent),
+      log_view_(new QListView),
+      model_(new LogMessagesModel(max_messages, this)),
+      filter_model_(new LogLevelFilterModel(this)) {
+  filter_model_->setSourceModel(model_);
+  log_view_->setModel(filter_model_);
+  log_view_->setUniformItemSizes(true);
+  log_view_->setSelectionMode(QAbstractItemView::ExtendedSelection);
+  log_view_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  log_view_->setContextMenuPolicy(Qt::CustomContextMenu);
+  VERIFY(connect(log_view_, &QListView::customContextMenuRequested, this, &LogWidget::showContextMenu));
 
   QHBoxLayout* main_layout = new QHBoxLayout;
   main_layout->setContentsMargins(0, 0, 0, 0);
-  main_layout->addWidget(log_text_edit_);
+  main_layout->addWidget(log_view_);
   setLayout(main_layout);
 }
 
 void LogWidget::addLogMessage(const QString& message, common::logging::LOG_LEVEL level) {
-  QTime time = QTime::currentTime();
-  log_text_edit_->setTextColor(level == common::logging::LOG_LEVEL_CRIT ? QColor(Qt::red) : QColor(Qt::black));
-  log_text_edit_->append(time.toString("hh:mm:ss.zzz: %1").arg(message));
-  QScrollBar* sb = log_text_edit_->verticalScrollBar();
-  sb->setValue(sb->maximum());
+  // follow the tail only if user did not scroll up
+  QScrollBar* sb = log_view_->verticalScrollBar();
+  const bool at_bottom = sb->value() == sb->maximum();
+  model_->addMessage(message, level);
+  if (at_bottom) {
+    log_view_->scrollToBottom();
+  }
 }
 
 void LogWidget::showContextMenu(const QPoint& pt) {
-  QMenu* menu = log_text_edit_->createStandardContextMenu();
-  QAction* clear = new QAction(translations::trClearAll, menu);
-  VERIFY(connect(clear, &QAction::triggered, log_text_edit_, &QTextEdit::clear));
-  menu->addAction(clear);
-  clear->setEnabled(!log_text_edit_->toPlainText().isEmpty());
-
-  menu->exec(log_text_edit_->mapToGlobal(pt));
-  delete menu;
+  QMenu menu;
+  QAction* copy = new QAction(trCopySelected, &menu);
+  VERIFY(connect(copy, &QAction::triggered, this, &LogWidget::copySelected));
+  copy->setEnabled(log_view_->selectionModel()->hasSelection());
+  menu.addAction(copy);
+
+  QAction* clear = new QAction(translations::trClearAll, &menu);
+  VERIFY(connect(clear, &QAction::triggered, this, &LogWidget::clearAll));
+  clear->setEnabled(model_->rowCount() != 0);
+  menu.addAction(clear);
+  menu.addSeparator();
+
+  QMenu* level_menu = menu.addMenu(trLevel);
+  QActionGroup* levels = new QActionGroup(level_menu);
+  for (int i = common::logging::LOG_LEVEL_EMERG; i <= common::logging::LOG_LEVEL_DEBUG; ++i) {
+    const common::logging::LOG_LEVEL level = static_cast<common::logging::LOG_LEVEL>(i);
+    QAction* level_action = new QAction(trLevels[i], levels);
+    level_action->setCheckable(true);
+    level_action->setChecked(filter_model_->maxLevel() == level);
+    level_action->setData(i);
+    VERIFY(connect(level_action, &QAction::triggered, this, &LogWidget::changeLevel));
+    level_menu->addAction(level_action);
+  }
+
+  QAction* spill = new QAction(trSpillToDisk, &menu);
+  spill->setCheckable(true);
+  spill->setChecked(model_->isSpillEnabled());
+  VERIFY(connect(spill, &QAction::toggled, this, &LogWidget::toggleSpill));
+  menu.addAction(spill);
+
+  menu.exec(log_view_->mapToGlobal(pt));
+}
+
+void LogWidget::copySelected() {
+  QModelIndexList selected = log_view_->selectionModel()->selectedRows();
+  std::sort(selected.begin(), selected.end());
+  QStringList lines;
+  for (const QModelIndex& index : selected) {
+    lines << index.data(Qt::DisplayRole).toString();
+  }
+  QApplication::clipboard()->setText(lines.join('\n'));
+}
+
+void LogWidget::changeLevel() {
+  QAction* action = qobject_cast<QAction*>(sender());
+  if (!action) {
+    return;
+  }
+
+  filter_model_->setMaxLevel(static_cast<common::logging::LOG_LEVEL>(action->data().toInt()));
+}
+
+void LogWidget::clearAll() {
+  model_->clear();
+}
+
+void LogWidget::toggleSpill(bool checked) {
+  if (!checked) {
+    model_->setSpillFile(std::string());
+    return;
+  }
+
+  const std::string dir = common::ConvertToString(proxy::SettingsManager::GetInstance()->GetLoggingDirectory());
+  const std::string path = common::file_system::make_path(dir, LOG_SPILL_FILE_NAME);
+  if (!model_->setSpillFile(path)) {
+    WARNING_LOG() << "Can't open log spill file: " << path;
+  }
 }
 
 }  // namespace gui
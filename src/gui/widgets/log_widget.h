@@ -22,11 +22,14 @@
 
 #include "gui/widgets/base_widget.h"
 
-class QTextEdit;
+class QListView;
 
 namespace fastonosql {
 namespace gui {
 
+class LogLevelFilterModel;
+class LogMessagesModel;
+
 class LogWidget : public BaseWidget {
   Q_OBJECT
 
@@ -34,18 +37,25 @@ class LogWidget : public BaseWidget {
   typedef BaseWidget base_class;
   template <typename T, typename... Args>
   friend T* createWidget(Args&&... args);
+  enum { max_messages = 10000 };
 
  public Q_SLOTS:
   void addLogMessage(const QString& message, common::logging::LOG_LEVEL level);
 
  private Q_SLOTS:
   void showContextMenu(const QPoint& pt);
+  void copySelected();
+  void changeLevel();
+  void clearAll();
+  void toggleSpill(bool checked);
 
  protected:
   explicit LogWidget(QWidget* parent = Q_NULLPTR);
 
  private:
-  QTextEdit* const log_text_edit_;
+  QListView* const log_view_;
+  LogMessagesModel* const model_;
+  LogLevelFilterModel* const filter_model_;
 };
 
 }  // namespace gui
@@ -81,6 +81,10 @@ OutputWidget::OutputWidget(proxy::IServerSPtr server, QWidget* parent) : base_cl
                  Qt::DirectConnection));
   VERIFY(connect(server_.get(), &proxy::IServer::ExecuteFinished, this, &OutputWidget::finishExecuteCommand,
                  Qt::DirectConnection));
+  VERIFY(connect(server_.get(), &proxy::IServer::SaveValueChangesStarted, this, &OutputWidget::startSaveValueChanges,
+                 Qt::DirectConnection));
+  VERIFY(connect(server_.get(), &proxy::IServer::SaveValueChangesFinished, this,
+                 &OutputWidget::finishSaveValueChanges, Qt::DirectConnection));
 
   VERIFY(connect(server_.get(), &proxy::IServer::KeyAdded, this, &OutputWidget::addKey, Qt::DirectConnection));
   VERIFY(connect(server_.get(), &proxy::IServer::KeyLoaded, this, &OutputWidget::updateKey, Qt::DirectConnection));
@@ -113,6 +117,8 @@ OutputWidget::OutputWidget(proxy::IServerSPtr server, QWidget* parent) : base_cl
   key_editor_->setEnableKeyEdit(false);
   VERIFY(connect(key_editor_, &SaveKeyEditWidget::keyReadyToSave, this, &OutputWidget::createKeyFromEditor,
                  Qt::DirectConnection));
+  VERIFY(connect(key_editor_, &SaveKeyEditWidget::changesReadyToSave, this, &OutputWidget::saveChangesFromEditor,
+                 Qt::DirectConnection));
 
   QHBoxLayout* top_layout = new QHBoxLayout;
   tree_button_ = new IconButton(GuiFactory::GetInstance().treeIcon(), kIconSize);
@@ -200,6 +206,18 @@ void OutputWidget::finishExecuteCommand(const proxy::events_info::ExecuteInfoRes
   }
 }
 
+void OutputWidget::startSaveValueChanges(const proxy::events_info::SaveValueChangesRequest& req) {
+  if (req.initiator() == key_editor_) {
+    key_editor_->startSaveKey();
+  }
+}
+
+void OutputWidget::finishSaveValueChanges(const proxy::events_info::SaveValueChangesResponse& res) {
+  if (res.initiator() == key_editor_) {
+    key_editor_->finishSaveKey();
+  }
+}
+
 void OutputWidget::addChild(core::FastoObjectIPtr child) {
   DCHECK(child->GetParent());
 
@@ -280,6 +298,23 @@ void OutputWidget::createKeyFromEditor(const core::NDbKValue& dbv) {
   createKeyImpl(dbv, key_editor_);
 }
 
+void OutputWidget::saveChangesFromEditor(const core::NDbKValue& dbv,
+                                         const proxy::ValueChangesCommands& commands) {
+  const bool delta_saves = server_->GetType() == core::REDIS || server_->GetType() == core::KEYDB;
+  if (!delta_saves) {
+    createKeyImpl(dbv, key_editor_);
+    return;
+  }
+
+  if (commands.IsEmpty()) {
+    return;
+  }
+
+  // only edited rows are sent, loaded key is updated with whole edited value after save
+  proxy::events_info::SaveValueChangesRequest req(key_editor_, server_->GetCurrentDatabaseInfo(), dbv, commands);
+  server_->SaveValueChanges(req);
+}
+
 void OutputWidget::setTreeView() {
   tree_view_->setVisible(true);
   table_view_->setVisible(false);
@@ -18,7 +18,10 @@
 
 #pragma once
 
+#include <vector>
+
 #include <fastonosql/core/database/idatabase_info.h>
+#include <fastonosql/core/db_key.h>
 #include <fastonosql/core/global.h>
 
 #include "gui/widgets/base_widget.h"
@@ -44,6 +47,8 @@ namespace events_info {
 class EventInfoBase;
 struct ExecuteInfoRequest;
 struct ExecuteInfoResponse;
+struct SaveValueChangesRequest;
+struct SaveValueChangesResponse;
 struct CommandRootCompleatedInfo;
 struct CommandRootCreatedInfo;
 }  // namespace events_info
@@ -66,10 +71,14 @@ class OutputWidget : public BaseWidget {
  private Q_SLOTS:
   void createKey(const core::NDbKValue& dbv);
   void createKeyFromEditor(const core::NDbKValue& dbv);
+  void saveChangesFromEditor(const core::NDbKValue& dbv, const proxy::ValueChangesCommands& commands);
 
   void startExecuteCommand(const proxy::events_info::ExecuteInfoRequest& req);
   void finishExecuteCommand(const proxy::events_info::ExecuteInfoResponse& res);
 
+  void startSaveValueChanges(const proxy::events_info::SaveValueChangesRequest& req);
+  void finishSaveValueChanges(const proxy::events_info::SaveValueChangesResponse& res);
+
   void rootCreate(const proxy::events_info::CommandRootCreatedInfo& res);
   void rootCompleate(const proxy::events_info::CommandRootCompleatedInfo& res);
 
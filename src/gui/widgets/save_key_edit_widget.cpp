@@ -18,6 +18,8 @@
 
 #include "gui/widgets/save_key_edit_widget.h"
 
+#include <vector>
+
 #include <QPushButton>
 #include <QSplitter>
 #include <QVBoxLayout>
@@ -82,6 +84,12 @@ void SaveKeyEditWidget::keySave() {
     return;
   }
 
+  proxy::ValueChangesCommands commands;
+  if (editor_->getChangesCommands(&commands)) {
+    emit changesReadyToSave(dbv, commands);
+    return;
+  }
+
   emit keyReadyToSave(dbv);
 }
 
@@ -27,6 +27,8 @@
 
 #include "gui/widgets/base_widget.h"
 
+#include "proxy/types.h"
+
 class QPushButton;
 
 namespace common {
@@ -58,6 +60,7 @@ class SaveKeyEditWidget : public BaseWidget {
 
  Q_SIGNALS:
   void keyReadyToSave(const core::NDbKValue& dbv);
+  void changesReadyToSave(const core::NDbKValue& dbv, const proxy::ValueChangesCommands& commands);
 
  private Q_SLOTS:
   void keySave();
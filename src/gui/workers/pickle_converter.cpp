@@ -0,0 +1,219 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/workers/pickle_converter.h"
+
+#include <string>
+
+#include <QCoreApplication>
+#include <QProcess>
+#include <QReadWriteLock>
+#include <QThread>
+
+#include <common/file_system/file_system.h>
+#include <common/file_system/string_path_utils.h>
+#include <common/qt/convert2string.h>
+
+#include "proxy/settings_manager.h"
+
+#define CONVERT_PICKLE_SCRIPT_NAME "convert_pickle.py"
+#define CONVERT_PICKLE_SERVER_ARGUMENT "--server"
+
+namespace fastonosql {
+namespace gui {
+namespace {
+// converter thread is alive while lock is held for read, quitting takes it for write
+QReadWriteLock g_converter_lock;
+bool g_converter_stopped = false;
+
+void AppendSize(QByteArray* frame, quint32 size) {
+  frame->append(static_cast<char>((size >> 24) & 0xFF));
+  frame->append(static_cast<char>((size >> 16) & 0xFF));
+  frame->append(static_cast<char>((size >> 8) & 0xFF));
+  frame->append(static_cast<char>(size & 0xFF));
+}
+
+quint32 GetSize(const QByteArray& header) {
+  const unsigned char* ptr = reinterpret_cast<const unsigned char*>(header.constData()) + 1;
+  return (static_cast<quint32>(ptr[0]) << 24) | (static_cast<quint32>(ptr[1]) << 16) |
+         (static_cast<quint32>(ptr[2]) << 8) | static_cast<quint32>(ptr[3]);
+}
+}  // namespace
+
+PickleConverter* PickleConverter::GetInstance() {
+  static PickleConverter* const converter = create();  // thread safe initialization, ConvertSync is called from workers
+  return converter;
+}
+
+PickleConverter* PickleConverter::create() {
+  QThread* th = new QThread;
+  PickleConverter* converter = new PickleConverter;
+  converter->moveToThread(th);
+  VERIFY(connect(th, &QThread::finished, converter, &PickleConverter::deleteLater));
+  VERIFY(connect(th, &QThread::finished, th, &QThread::deleteLater));
+  VERIFY(connect(qApp, &QCoreApplication::aboutToQuit, &PickleConverter::shutdown));
+  th->start();
+  return converter;
+}
+
+void PickleConverter::shutdown() {
+  // waits for running conversions, later ones fail instead of calling into finished thread
+  QWriteLocker lock(&g_converter_lock);
+  g_converter_stopped = true;
+  GetInstance()->thread()->quit();
+}
+
+PickleConverter::Result PickleConverter::ConvertSync(bool encode, const QByteArray& data) {
+  PickleConverter* converter = GetInstance();
+  Result result = {false, QByteArray()};
+  QReadLocker lock(&g_converter_lock);
+  if (g_converter_stopped) {
+    return result;
+  }
+
+  if (QThread::currentThread() == converter->thread()) {
+    DNOTREACHED();
+    return result;
+  }
+
+  QMetaObject::invokeMethod(converter, "convertSync", Qt::BlockingQueuedConnection, Q_RETURN_ARG(Result, result),
+                            Q_ARG(bool, encode), Q_ARG(QByteArray, data));
+  return result;
+}
+
+PickleConverter::PickleConverter() : QObject(), process_(nullptr), program_(), script_path_() {
+  qRegisterMetaType<Result>("Result");
+}
+
+PickleConverter::~PickleConverter() {
+  stop();
+}
+
+PickleConverter::Result PickleConverter::convertSync(bool encode, const QByteArray& data) {
+  Result result = {false, QByteArray()};
+  if (data.isEmpty()) {
+    return result;
+  }
+
+  // second attempt goes to fresh interpreter, conversion errors aren't retried
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    if (!ensureStarted()) {
+      return result;
+    }
+
+    const ExchangeStatus status = exchange(encode ? 'e' : 'd', data, &result);
+    if (status != kExchangeBroken) {
+      return result;
+    }
+    stop();
+  }
+
+  return result;
+}
+
+bool PickleConverter::ensureStarted() {
+  const QString python_path = proxy::SettingsManager::GetInstance()->GetPythonPath();
+  const std::string converters_path = proxy::SettingsManager::GetInstance()->GetConvertersPath();
+  const std::string script_path_str = common::file_system::make_path(converters_path, CONVERT_PICKLE_SCRIPT_NAME);
+  QString script_path;
+  common::ConvertFromString(script_path_str, &script_path);
+  if (process_ && process_->state() == QProcess::Running && python_path == program_ && script_path == script_path_) {
+    return true;
+  }
+
+  stop();
+  if (python_path.isEmpty() || !common::file_system::is_file_exist(common::ConvertToString(python_path)) ||
+      !common::file_system::is_file_exist(script_path_str)) {
+    return false;
+  }
+
+  process_ = new QProcess(this);
+  process_->setProcessChannelMode(QProcess::ForwardedErrorChannel);  // unread stderr pipe would block interpreter
+  process_->setReadChannel(QProcess::StandardOutput);
+  process_->start(python_path, QStringList() << script_path << CONVERT_PICKLE_SERVER_ARGUMENT);
+  if (!process_->waitForStarted(start_timeout_msec)) {
+    stop();
+    return false;
+  }
+
+  program_ = python_path;
+  script_path_ = script_path;
+  return true;
+}
+
+void PickleConverter::stop() {
+  if (!process_) {
+    return;
+  }
+
+  process_->closeWriteChannel();  // eof finishes serve loop
+  if (!process_->waitForFinished(start_timeout_msec)) {
+    process_->kill();
+    process_->waitForFinished(start_timeout_msec);
+  }
+  delete process_;
+  process_ = nullptr;
+  program_.clear();
+  script_path_.clear();
+}
+
+PickleConverter::ExchangeStatus PickleConverter::exchange(char op, const QByteArray& data, Result* result) {
+  QByteArray frame;
+  frame.reserve(data.size() + header_size);
+  frame.append(op);
+  AppendSize(&frame, static_cast<quint32>(data.size()));
+  frame.append(data);
+  if (process_->write(frame) != frame.size()) {
+    return kExchangeBroken;
+  }
+
+  while (process_->bytesToWrite() > 0) {
+    if (!process_->waitForBytesWritten(reply_timeout_msec)) {
+      return kExchangeBroken;
+    }
+  }
+
+  QByteArray header;
+  if (!readExactly(header_size, &header)) {
+    return kExchangeBroken;
+  }
+
+  QByteArray reply;
+  if (!readExactly(GetSize(header), &reply)) {
+    return kExchangeBroken;
+  }
+
+  // status 1 is exception in script, e.g. value isn't pickled
+  result->is_ok = header[0] == 0;
+  result->data = result->is_ok ? reply : QByteArray();
+  return result->is_ok ? kExchangeOk : kExchangeFailed;
+}
+
+bool PickleConverter::readExactly(qint64 size, QByteArray* out) {
+  while (process_->bytesAvailable() < size) {
+    if (!process_->waitForReadyRead(reply_timeout_msec)) {
+      return false;
+    }
+  }
+
+  *out = process_->read(size);
+  return true;
+}
+
+}  // namespace gui
+}  // namespace fastonosql
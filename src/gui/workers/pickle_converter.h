@@ -0,0 +1,74 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QByteArray>
+#include <QObject>
+
+class QProcess;
+
+namespace fastonosql {
+namespace gui {
+
+// long lived "convert_pickle.py --server" in own thread instead of interpreter per value, framing:
+// request op ('e' encode, 'd' decode) + u32 big endian size + data, reply status (0 ok) + u32 size + data;
+// interpreter is restarted when it dies, stops answering or python settings change
+class PickleConverter : public QObject {
+  Q_OBJECT
+
+ public:
+  enum { start_timeout_msec = 3000, reply_timeout_msec = 10000, header_size = 5 };
+
+  struct Result {
+    bool is_ok;
+    QByteArray data;
+  };
+
+  static PickleConverter* GetInstance();  // created on first call, lives until application quits
+
+  // blocks caller thread until reply, calls from several threads are serialized; see ViewConverter for async use,
+  // fails once application is quitting
+  static Result ConvertSync(bool encode, const QByteArray& data);
+
+  ~PickleConverter() override;
+
+ private Q_SLOTS:
+  Result convertSync(bool encode, const QByteArray& data);
+
+ private:
+  enum ExchangeStatus { kExchangeOk, kExchangeFailed, kExchangeBroken };
+
+  PickleConverter();
+  static PickleConverter* create();
+  static void shutdown();
+
+  bool ensureStarted();
+  void stop();
+  ExchangeStatus exchange(char op, const QByteArray& data, Result* result);
+  bool readExactly(qint64 size, QByteArray* out);
+
+  QProcess* process_;
+  QString program_;
+  QString script_path_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
+
+Q_DECLARE_METATYPE(fastonosql::gui::PickleConverter::Result)
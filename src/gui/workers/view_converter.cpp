@@ -0,0 +1,93 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gui/workers/view_converter.h"
+
+#include <QRunnable>
+#include <QThreadPool>
+
+namespace fastonosql {
+namespace gui {
+
+class ViewConverter::Task : public QRunnable {
+ public:
+  Task(ViewConverter* owner, quint64 id, convert_func_t convert, int view_method, const convert_in_t& in)
+      : owner_(owner), id_(id), convert_(convert), view_method_(view_method), in_(in) {}
+
+  void run() override {
+    // switched again while waiting in queue
+    if (!owner_->IsActive(id_)) {
+      return;
+    }
+
+    convert_out_t out;
+    const bool is_ok = convert_(view_method_, in_, &out);
+    owner_->Finish(id_, is_ok, out);
+  }
+
+ private:
+  ViewConverter* const owner_;
+  const quint64 id_;
+  const convert_func_t convert_;
+  const int view_method_;
+  const convert_in_t in_;
+};
+
+ViewConverter* ViewConverter::GetInstance() {
+  static ViewConverter* converter = new ViewConverter;  // tasks may outlive any viewer, so never deleted
+  return converter;
+}
+
+ViewConverter::ViewConverter() : QObject(), mutex_(), active_(), last_id_(0) {}
+
+quint64 ViewConverter::ConvertAsync(convert_func_t convert, int view_method, const convert_in_t& in) {
+  quint64 id = 0;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    id = ++last_id_;
+    active_.insert(id);
+  }
+
+  QThreadPool::globalInstance()->start(new Task(this, id, convert, view_method, in));
+  return id;
+}
+
+void ViewConverter::Cancel(quint64 id) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  active_.erase(id);
+}
+
+bool ViewConverter::IsActive(quint64 id) const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return active_.find(id) != active_.end();
+}
+
+void ViewConverter::Finish(quint64 id, bool is_ok, const convert_out_t& out) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (active_.erase(id) == 0) {
+      return;
+    }
+  }
+
+  // queued to receivers in gui thread
+  emit converted(id, is_ok, QByteArray(reinterpret_cast<const char*>(out.data()), static_cast<int>(out.size())));
+}
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,62 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <mutex>
+#include <set>
+
+#include <QByteArray>
+#include <QObject>
+
+#include "gui/text_converter.h"
+
+namespace fastonosql {
+namespace gui {
+
+// runs FastoViewer value conversions in global thread pool, results come with converted signal;
+// converters can't be interrupted, so cancel skips not started task or drops result of running one
+class ViewConverter : public QObject {
+  Q_OBJECT
+
+ public:
+  typedef bool (*convert_func_t)(int view_method, const convert_in_t& in, convert_out_t* out);
+
+  static ViewConverter* GetInstance();  // must be created in gui thread
+
+  quint64 ConvertAsync(convert_func_t convert, int view_method, const convert_in_t& in);
+  void Cancel(quint64 id);
+
+ Q_SIGNALS:
+  void converted(quint64 id, bool is_ok, const QByteArray& data);
+
+ private:
+  ViewConverter();
+
+  class Task;
+
+  bool IsActive(quint64 id) const;
+  void Finish(quint64 id, bool is_ok, const convert_out_t& out);
+
+  mutable std::mutex mutex_;
+  std::set<quint64> active_;  // queued or running, not cancelled
+  quint64 last_id_;
+};
+
+}  // namespace gui
+}  // namespace fastonosql
@@ -0,0 +1,57 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/atomic_value_histogram.h"
+
+namespace fastonosql {
+namespace proxy {
+
+AtomicValueHistogram::AtomicValueHistogram()
+    : buckets_(new std::atomic<uint64_t>[ValueHistogram::GetBucketsCount()]), count_(0) {
+  Reset();
+}
+
+void AtomicValueHistogram::Record(uint64_t value) {
+  buckets_[ValueHistogram::GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+ValueHistogram AtomicValueHistogram::GetSnapshot() const {
+  ValueHistogram result;
+  for (size_t i = 0; i < ValueHistogram::GetBucketsCount(); ++i) {
+    const uint64_t count = buckets_[i].load(std::memory_order_relaxed);
+    if (count) {
+      result.Record(ValueHistogram::GetBucketUpperBound(i), count);
+    }
+  }
+  return result;
+}
+
+uint64_t AtomicValueHistogram::GetCount() const {
+  return count_.load(std::memory_order_relaxed);
+}
+
+void AtomicValueHistogram::Reset() {
+  for (size_t i = 0; i < ValueHistogram::GetBucketsCount(); ++i) {
+    buckets_[i].store(0, std::memory_order_relaxed);
+  }
+  count_.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,48 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+
+#include "proxy/value_histogram.h"
+
+namespace fastonosql {
+namespace proxy {
+
+// ValueHistogram buckets as relaxed atomics: one thread records, any thread takes snapshots without locks,
+// snapshot keeps bucket precision, values inside bucket are reported as its upper bound
+class AtomicValueHistogram {
+ public:
+  AtomicValueHistogram();
+
+  void Record(uint64_t value);
+  ValueHistogram GetSnapshot() const;
+  uint64_t GetCount() const;
+  void Reset();
+
+ private:
+  std::unique_ptr<std::atomic<uint64_t>[]> buckets_;
+  std::atomic<uint64_t> count_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
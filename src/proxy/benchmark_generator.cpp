@@ -0,0 +1,145 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/benchmark_generator.h"
+
+#include <ctype.h>
+#include <stdlib.h>
+
+#include <algorithm>
+
+namespace fastonosql {
+namespace proxy {
+
+namespace {
+std::string TrimSpaces(const std::string& line) {
+  const size_t begin = line.find_first_not_of(" \t\r");
+  if (begin == std::string::npos) {
+    return std::string();
+  }
+
+  const size_t end = line.find_last_not_of(" \t\r");
+  return line.substr(begin, end - begin + 1);
+}
+}  // namespace
+
+common::Error ParseBenchmarkMix(const std::string& text, benchmark_mix_t* mix) {
+  if (!mix) {
+    return common::make_error_inval();
+  }
+
+  benchmark_mix_t lmix;
+  size_t line_start = 0;
+  while (line_start <= text.size()) {
+    size_t line_end = text.find('\n', line_start);
+    if (line_end == std::string::npos) {
+      line_end = text.size();
+    }
+
+    std::string line = TrimSpaces(text.substr(line_start, line_end - line_start));
+    line_start = line_end + 1;
+    if (line.empty()) {
+      continue;
+    }
+
+    BenchmarkCommand command = {line, 1};
+    const size_t space = line.find(' ');
+    if (space != std::string::npos && std::all_of(line.begin(), line.begin() + space, ::isdigit)) {
+      command.weight = static_cast<uint32_t>(strtoul(line.c_str(), nullptr, 10));
+      command.pattern = TrimSpaces(line.substr(space));
+    }
+
+    if (command.pattern.empty()) {
+      return common::make_error("Invalid benchmark command: " + line);
+    }
+    if (command.weight == 0) {
+      continue;
+    }
+    lmix.push_back(command);
+  }
+
+  if (lmix.empty()) {
+    return common::make_error("Benchmark commands mix is empty.");
+  }
+
+  *mix = lmix;
+  return common::Error();
+}
+
+BenchmarkGenerator::BenchmarkGenerator(const benchmark_mix_t& mix,
+                                       size_t keyspace_size,
+                                       size_t value_size,
+                                       uint32_t seed)
+    : commands_(),
+      cumulative_weights_(),
+      keyspace_size_(std::max<size_t>(keyspace_size, 1)),
+      data_(value_size, 'x'),
+      random_(seed) {
+  uint64_t total_weight = 0;
+  for (const BenchmarkCommand& command : mix) {
+    parts_t parts;
+    size_t pos = 0;
+    while (pos < command.pattern.size()) {
+      const size_t rand_pos = command.pattern.find(BENCHMARK_RANDOM_INT_PLACEHOLDER, pos);
+      const size_t data_pos = command.pattern.find(BENCHMARK_DATA_PLACEHOLDER, pos);
+      const size_t next = std::min(rand_pos, data_pos);
+      if (next != pos) {
+        parts.push_back({kLiteral, command.pattern.substr(pos, next == std::string::npos ? next : next - pos)});
+      }
+      if (next == std::string::npos) {
+        break;
+      }
+
+      if (next == rand_pos) {
+        parts.push_back({kRandomInt, std::string()});
+        pos = next + sizeof(BENCHMARK_RANDOM_INT_PLACEHOLDER) - 1;
+      } else {
+        parts.push_back({kData, std::string()});
+        pos = next + sizeof(BENCHMARK_DATA_PLACEHOLDER) - 1;
+      }
+    }
+
+    total_weight += command.weight;
+    commands_.push_back(parts);
+    cumulative_weights_.push_back(total_weight);
+  }
+}
+
+core::command_buffer_t BenchmarkGenerator::Next() {
+  if (commands_.empty()) {
+    return core::command_buffer_t();
+  }
+
+  const uint64_t weight = random_() % cumulative_weights_.back();
+  const size_t index =
+      std::upper_bound(cumulative_weights_.begin(), cumulative_weights_.end(), weight) - cumulative_weights_.begin();
+  core::command_buffer_writer_t wr;
+  for (const Part& part : commands_[index]) {
+    if (part.type == kLiteral) {
+      wr << part.literal;
+    } else if (part.type == kRandomInt) {
+      wr << std::to_string(random_() % keyspace_size_);
+    } else {
+      wr << data_;
+    }
+  }
+  return wr.str();
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
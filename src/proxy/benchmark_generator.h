@@ -0,0 +1,73 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <common/error.h>
+
+#include <fastonosql/core/types.h>
+
+#define BENCHMARK_RANDOM_INT_PLACEHOLDER "__rand_int__"
+#define BENCHMARK_DATA_PLACEHOLDER "__data__"
+
+namespace fastonosql {
+namespace proxy {
+
+struct BenchmarkCommand {
+  std::string pattern;
+  uint32_t weight;
+};
+
+typedef std::vector<BenchmarkCommand> benchmark_mix_t;
+
+// one command per line with optional leading weight, like redis-benchmark placeholders:
+// 80 GET key:__rand_int__
+// 20 SET key:__rand_int__ __data__
+common::Error ParseBenchmarkMix(const std::string& text, benchmark_mix_t* mix) WARN_UNUSED_RESULT;
+
+// produces weighted random commands of mix, __rand_int__ is replaced by key index
+// in [0, keyspace_size), __data__ by value of value_size bytes
+class BenchmarkGenerator {
+ public:
+  BenchmarkGenerator(const benchmark_mix_t& mix, size_t keyspace_size, size_t value_size, uint32_t seed);
+
+  core::command_buffer_t Next();
+
+ private:
+  enum PartType { kLiteral, kRandomInt, kData };
+  struct Part {
+    PartType type;
+    std::string literal;
+  };
+  typedef std::vector<Part> parts_t;
+
+  std::vector<parts_t> commands_;
+  std::vector<uint64_t> cumulative_weights_;
+  const size_t keyspace_size_;
+  const std::string data_;
+  std::mt19937_64 random_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,117 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/cluster_key_slot.h"
+
+#include <stdlib.h>
+
+#include <sstream>
+
+namespace fastonosql {
+namespace proxy {
+namespace {
+uint16_t Crc16(const char* buf, size_t len) {
+  uint16_t crc = 0;  // xmodem: poly 0x1021, init 0
+  for (size_t i = 0; i < len; ++i) {
+    crc ^= static_cast<uint16_t>(static_cast<unsigned char>(buf[i]) << 8);
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = crc & 0x8000 ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+    }
+  }
+  return crc;
+}
+
+bool ParseSlot(const std::string& text, uint16_t* slot) {
+  char* end = nullptr;
+  const unsigned long val = strtoul(text.c_str(), &end, 10);
+  if (text.empty() || *end != '\0' || val >= cluster_slots_count) {
+    return false;
+  }
+
+  *slot = static_cast<uint16_t>(val);
+  return true;
+}
+}  // namespace
+
+uint16_t GetClusterKeySlot(const std::string& key) {
+  const size_t open = key.find('{');
+  if (open != std::string::npos) {
+    const size_t close = key.find('}', open + 1);
+    if (close != std::string::npos && close != open + 1) {
+      return Crc16(key.data() + open + 1, close - open - 1) & (cluster_slots_count - 1);
+    }
+  }
+
+  return Crc16(key.data(), key.size()) & (cluster_slots_count - 1);
+}
+
+bool IsClusterSlotInRanges(uint16_t slot, const cluster_slot_ranges_t& ranges) {
+  for (const auto& range : ranges) {
+    if (slot >= range.first && slot <= range.second) {
+      return true;
+    }
+  }
+  return false;
+}
+
+common::Error ParseClusterNodesOwnSlots(const std::string& nodes, cluster_slot_ranges_t* ranges) {
+  if (!ranges) {
+    return common::make_error_inval();
+  }
+
+  // <id> <ip:port@cport> <flags> <master> <ping-sent> <pong-recv> <config-epoch> <link-state> <slot> <slot>...
+  std::istringstream lines(nodes);
+  std::string line;
+  while (std::getline(lines, line)) {
+    std::istringstream fields(line);
+    std::string id, host, flags, master, ping, pong, epoch, state;
+    if (!(fields >> id >> host >> flags >> master >> ping >> pong >> epoch >> state)) {
+      continue;
+    }
+    if (flags.find("myself") == std::string::npos) {
+      continue;
+    }
+
+    cluster_slot_ranges_t result;
+    std::string slot;
+    while (fields >> slot) {
+      if (slot[0] == '[') {
+        continue;
+      }
+
+      const size_t dash = slot.find('-');
+      cluster_slot_range_t range;
+      const bool parsed = dash == std::string::npos
+                              ? ParseSlot(slot, &range.first) && ParseSlot(slot, &range.second)
+                              : ParseSlot(slot.substr(0, dash), &range.first) &&
+                                    ParseSlot(slot.substr(dash + 1), &range.second);
+      if (!parsed || range.first > range.second) {
+        return common::make_error("Invalid slot range: " + slot);
+      }
+      result.push_back(range);
+    }
+
+    *ranges = result;
+    return common::Error();
+  }
+
+  return common::make_error("Cluster nodes reply hasn't myself node.");
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
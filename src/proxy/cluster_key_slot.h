@@ -0,0 +1,45 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <common/error.h>
+
+namespace fastonosql {
+namespace proxy {
+
+enum { cluster_slots_count = 16384 };
+
+typedef std::pair<uint16_t, uint16_t> cluster_slot_range_t;  // first, last inclusive
+typedef std::vector<cluster_slot_range_t> cluster_slot_ranges_t;
+
+// crc16 of key or of its {hash tag} modulo 16384, same as redis cluster
+uint16_t GetClusterKeySlot(const std::string& key);
+bool IsClusterSlotInRanges(uint16_t slot, const cluster_slot_ranges_t& ranges);
+
+// slots of "myself" line of CLUSTER NODES reply, importing/migrating entries are skipped
+common::Error ParseClusterNodesOwnSlots(const std::string& nodes, cluster_slot_ranges_t* ranges) WARN_UNUSED_RESULT;
+
+}  // namespace proxy
+}  // namespace fastonosql
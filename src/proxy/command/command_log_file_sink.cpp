@@ -0,0 +1,182 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/command/command_log_file_sink.h"
+
+#include <common/convert2string.h>
+#include <common/file_system/file.h>
+#include <common/file_system/file_system.h>
+#include <common/logger.h>
+
+#include <fastonosql/core/connection_types.h>
+
+namespace {
+
+std::string EscapeJson(const std::string& str) {
+  static const char hex[] = "0123456789abcdef";
+  std::string result;
+  result.reserve(str.size() + 2);
+  for (unsigned char c : str) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += c;
+    } else if (c == '\n') {
+      result += "\\n";
+    } else if (c == '\r') {
+      result += "\\r";
+    } else if (c == '\t') {
+      result += "\\t";
+    } else if (c < 0x20) {
+      result += "\\u00";
+      result += hex[c >> 4];
+      result += hex[c & 0xF];
+    } else {
+      result += c;
+    }
+  }
+  return result;
+}
+
+template <typename T>
+void AppendLittleEndian(T value, std::string* out) {
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    *out += static_cast<char>((value >> (i * 8)) & 0xFF);
+  }
+}
+
+}  // namespace
+
+namespace fastonosql {
+namespace proxy {
+
+CommandLogFileSink::CommandLogFileSink(const std::string& path, CommandLogFileFormat format)
+    : path_(path), format_(format), mutex_(), cond_(), pending_(), stop_(false), thread_() {}
+
+CommandLogFileSink::~CommandLogFileSink() {
+  Stop();
+}
+
+common::Error CommandLogFileSink::Start() {
+  if (thread_.joinable()) {
+    return common::make_error_inval();
+  }
+
+  if (format_ == kCommandLogFileNone || path_.empty()) {
+    return common::make_error_inval();
+  }
+
+  stop_ = false;
+  thread_ = std::thread(&CommandLogFileSink::Routine, this);
+  return common::Error();
+}
+
+void CommandLogFileSink::Stop() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cond_.notify_one();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void CommandLogFileSink::Write(command_log_entries_t* entries) {
+  if (!entries || entries->empty()) {
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (pending_.size() >= max_pending_entries) {
+      entries->clear();
+      return;
+    }
+
+    if (pending_.empty()) {
+      pending_.swap(*entries);
+    } else {
+      pending_.insert(pending_.end(), entries->begin(), entries->end());
+      entries->clear();
+    }
+  }
+  cond_.notify_one();
+}
+
+std::string CommandLogFileSink::GetPath() const {
+  return path_;
+}
+
+CommandLogFileFormat CommandLogFileSink::GetFormat() const {
+  return format_;
+}
+
+void CommandLogFileSink::Routine() {
+  common::file_system::ANSIFile file;
+  common::ErrnoError err = file.Open(common::file_system::ascii_string_path(path_), "ab");
+  if (err) {
+    WARNING_LOG() << "Can't open commands log file: " << path_;
+  }
+
+  command_log_entries_t batch;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cond_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+      if (pending_.empty() && stop_) {
+        break;
+      }
+      batch.swap(pending_);
+    }
+
+    if (!err) {
+      std::string data;
+      for (const auto& entry : batch) {
+        data += Serialize(entry);
+      }
+      file.Write(data);
+    }
+    batch.clear();
+  }
+
+  if (!err) {
+    file.Close();
+  }
+}
+
+std::string CommandLogFileSink::Serialize(const CommandLogEntry& entry) const {
+  const std::string input = common::ConvertToString(entry.input);
+  const bool inner = entry.logging_type == core::C_INNER;
+  std::string result;
+  if (format_ == kCommandLogFileBinary) {
+    AppendLittleEndian<uint64_t>(entry.timestamp, &result);
+    AppendLittleEndian<uint8_t>(entry.connection_type, &result);
+    AppendLittleEndian<uint8_t>(entry.logging_type, &result);
+    AppendLittleEndian<uint32_t>(input.size(), &result);
+    result += input;
+    return result;
+  }
+
+  result = "{\"time\":" + common::ConvertToString(entry.timestamp) + ",\"type\":\"" +
+           core::ConnectionTypeToString(entry.connection_type) + "\",\"inner\":" + (inner ? "true" : "false") +
+           ",\"command\":\"" + EscapeJson(input) + "\"}\n";
+  return result;
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
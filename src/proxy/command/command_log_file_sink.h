@@ -0,0 +1,65 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <common/error.h>
+
+#include "proxy/command/command_log_ring.h"
+#include "proxy/types.h"
+
+namespace fastonosql {
+namespace proxy {
+
+// appends command log records from own thread, caller only hands over batches
+class CommandLogFileSink {
+ public:
+  enum { max_pending_entries = 65536 };
+
+  CommandLogFileSink(const std::string& path, CommandLogFileFormat format);
+  ~CommandLogFileSink();
+
+  common::Error Start();
+  void Stop();
+
+  void Write(command_log_entries_t* entries);  // takes entries, drops batch if writer lags behind
+
+  std::string GetPath() const;
+  CommandLogFileFormat GetFormat() const;
+
+ private:
+  void Routine();
+  std::string Serialize(const CommandLogEntry& entry) const;
+
+  const std::string path_;
+  const CommandLogFileFormat format_;
+
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  command_log_entries_t pending_;
+  bool stop_;
+  std::thread thread_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,71 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <common/types.h>
+
+#include <fastonosql/core/connection_types.h>
+#include <fastonosql/core/global.h>
+
+namespace fastonosql {
+namespace proxy {
+
+// only fields log shows, reply tree of command isn't kept alive by queued entries
+struct CommandLogEntry {
+  CommandLogEntry();
+  CommandLogEntry(core::FastoObjectCommandIPtr command, common::time64_t timestamp);
+
+  core::command_buffer_t input;
+  core::ConnectionType connection_type;
+  core::CmdLoggingType logging_type;
+  common::time64_t timestamp;  // utc msec
+};
+
+typedef std::vector<CommandLogEntry> command_log_entries_t;
+
+// bounded lock free queue (per cell sequence numbers), drivers push from own threads, gui thread pops
+class CommandLogRing {
+ public:
+  explicit CommandLogRing(size_t capacity);  // rounded up to power of two
+
+  bool Push(const CommandLogEntry& entry);  // false if full
+  bool Pop(CommandLogEntry* entry);  // false if empty
+
+  size_t GetCapacity() const;
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    CommandLogEntry entry;
+  };
+
+  const size_t mask_;
+  std::unique_ptr<Cell[]> cells_;
+  std::atomic<size_t> enqueue_pos_;
+  std::atomic<size_t> dequeue_pos_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
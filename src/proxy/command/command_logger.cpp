@@ -18,17 +18,138 @@
 
 #include "proxy/command/command_logger.h"
 
+#include <QCoreApplication>
 #include <QMetaType>
+#include <QTimerEvent>
+
+#include <common/logger.h>
+#include <common/time.h>
 
 namespace fastonosql {
 namespace proxy {
 
-CommandLogger::CommandLogger() {
+CommandLogger::CommandLogger()
+    : ring_(ring_capacity),
+      user_sampling_(1),
+      inner_sampling_(1),
+      user_seen_(0),
+      inner_seen_(0),
+      dropped_(0),
+      file_sink_(),
+      flush_timer_id_(0) {
   qRegisterMetaType<core::FastoObjectCommandIPtr>("core::FastoObjectCommandIPtr");
+  qRegisterMetaType<command_log_entries_t>("proxy::command_log_entries_t");
+  flush_timer_id_ = startTimer(flush_interval_msec);
+  QCoreApplication* app = QCoreApplication::instance();
+  if (app) {  // singleton outlives application, no signals from static destruction
+    VERIFY(connect(app, &QCoreApplication::aboutToQuit, this, &CommandLogger::Shutdown));
+  }
 }
 
+CommandLogger::~CommandLogger() {}
+
 void CommandLogger::Print(core::FastoObjectCommandIPtr command) {
-  emit Printed(command);
+  if (!command) {
+    return;
+  }
+
+  const bool inner = command->GetCommandLoggingType() == core::C_INNER;
+  const uint32_t every = inner ? inner_sampling_.load(std::memory_order_relaxed)
+                               : user_sampling_.load(std::memory_order_relaxed);
+  if (every == 0) {
+    return;
+  }
+
+  std::atomic<uint64_t>& seen = inner ? inner_seen_ : user_seen_;
+  if (seen.fetch_add(1, std::memory_order_relaxed) % every != 0) {
+    return;
+  }
+
+  if (!ring_.Push(CommandLogEntry(command, common::time::current_utc_mstime()))) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void CommandLogger::SetSampling(core::CmdLoggingType type, uint32_t every) {
+  if (type == core::C_INNER) {
+    inner_sampling_.store(every, std::memory_order_relaxed);
+  } else {
+    user_sampling_.store(every, std::memory_order_relaxed);
+  }
+}
+
+uint32_t CommandLogger::GetSampling(core::CmdLoggingType type) const {
+  if (type == core::C_INNER) {
+    return inner_sampling_.load(std::memory_order_relaxed);
+  }
+  return user_sampling_.load(std::memory_order_relaxed);
+}
+
+void CommandLogger::SetFileSink(const std::string& path, CommandLogFileFormat format) {
+  if (file_sink_ && file_sink_->GetPath() == path && file_sink_->GetFormat() == format) {
+    return;
+  }
+
+  Flush();
+  file_sink_.reset();
+  if (format == kCommandLogFileNone) {
+    return;
+  }
+
+  std::unique_ptr<CommandLogFileSink> sink(new CommandLogFileSink(path, format));
+  common::Error err = sink->Start();
+  if (err) {
+    WARNING_LOG() << "Can't start commands log file sink: " << path;
+    return;
+  }
+  file_sink_ = std::move(sink);
+}
+
+void CommandLogger::timerEvent(QTimerEvent* event) {
+  if (flush_timer_id_ != 0 && flush_timer_id_ == event->timerId()) {
+    Flush();
+  }
+  QObject::timerEvent(event);
+}
+
+void CommandLogger::Shutdown() {
+  if (flush_timer_id_ != 0) {
+    killTimer(flush_timer_id_);
+    flush_timer_id_ = 0;
+  }
+
+  // pending entries are dropped, nobody shows them anymore
+  CommandLogEntry entry;
+  while (ring_.Pop(&entry)) {
+  }
+  file_sink_.reset();
+}
+
+void CommandLogger::Flush() {
+  // drains until empty, at most one ring of entries per flush so busy drivers can't hold gui thread
+  size_t drained = 0;
+  while (drained < ring_capacity) {
+    command_log_entries_t entries;
+    CommandLogEntry entry;
+    while (entries.size() < max_batch_size && ring_.Pop(&entry)) {
+      entries.push_back(entry);
+    }
+
+    if (entries.empty()) {
+      break;
+    }
+
+    drained += entries.size();
+    emit Printed(entries);
+    if (file_sink_) {
+      file_sink_->Write(&entries);
+    }
+  }
+
+  const uint64_t dropped = dropped_.exchange(0, std::memory_order_relaxed);
+  if (dropped) {
+    WARNING_LOG() << "Commands log overflow, dropped: " << dropped;
+  }
 }
 
 void LOG_COMMAND(core::FastoObjectCommandIPtr command) {
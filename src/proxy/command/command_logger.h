@@ -18,27 +18,62 @@
 
 #pragma once
 
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
 #include <QObject>
 
 #include <common/patterns/singleton_pattern.h>
 
 #include <fastonosql/core/global.h>
 
+#include "proxy/command/command_log_file_sink.h"
+#include "proxy/command/command_log_ring.h"
+
 namespace fastonosql {
 namespace proxy {
 
+// drivers only push into ring, gui thread drains it by timer and emits batches
 class CommandLogger : public QObject, public common::patterns::LazySingleton<CommandLogger> {
   friend class common::patterns::LazySingleton<CommandLogger>;
   Q_OBJECT
 
  public:
-  void Print(core::FastoObjectCommandIPtr command);
+  enum { ring_capacity = 8192, flush_interval_msec = 100, max_batch_size = 1024 };  // batches per flush until empty
+
+  void Print(core::FastoObjectCommandIPtr command);  // from any thread, lock free
+
+  void SetSampling(core::CmdLoggingType type, uint32_t every);  // 0 - off, 1 - all, N - every N-th command
+  uint32_t GetSampling(core::CmdLoggingType type) const;
+
+  void SetFileSink(const std::string& path, CommandLogFileFormat format);  // kCommandLogFileNone closes sink
 
  Q_SIGNALS:
-  void Printed(core::FastoObjectCommandIPtr mess);
+  void Printed(const proxy::command_log_entries_t& entries);
+
+ protected:
+  void timerEvent(QTimerEvent* event) override;
+
+ private Q_SLOTS:
+  void Shutdown();
 
  private:
   CommandLogger();
+  ~CommandLogger();
+
+  void Flush();
+
+  CommandLogRing ring_;
+  std::atomic<uint32_t> user_sampling_;
+  std::atomic<uint32_t> inner_sampling_;
+  std::atomic<uint64_t> user_seen_;
+  std::atomic<uint64_t> inner_seen_;
+  std::atomic<uint64_t> dropped_;
+  std::unique_ptr<CommandLogFileSink> file_sink_;
+  int flush_timer_id_;
 };
 
 void LOG_COMMAND(core::FastoObjectCommandIPtr command);
@@ -0,0 +1,364 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/command_file_reader.h"
+
+#include <ctype.h>
+
+#include <json-c/json_tokener.h>
+
+namespace fastonosql {
+namespace proxy {
+namespace {
+bool IsHexDigit(char c) {
+  return isxdigit(static_cast<unsigned char>(c)) != 0;
+}
+
+char HexDigitToInt(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  return static_cast<char>(tolower(static_cast<unsigned char>(c)) - 'a' + 10);
+}
+
+bool IsNeedQuotes(const std::string& arg) {
+  if (arg.empty()) {
+    return true;
+  }
+
+  for (char c : arg) {
+    if (!isgraph(static_cast<unsigned char>(c)) || c == '"' || c == '\'' || c == '\\') {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace
+
+core::command_buffer_t MakeCommandLine(const std::vector<std::string>& argv) {
+  static const char hex[] = "0123456789abcdef";
+  std::string line;
+  for (size_t i = 0; i < argv.size(); ++i) {
+    if (i != 0) {
+      line += ' ';
+    }
+
+    const std::string& arg = argv[i];
+    if (!IsNeedQuotes(arg)) {
+      line += arg;
+      continue;
+    }
+
+    line += '"';
+    for (char c : arg) {
+      const unsigned char uc = static_cast<unsigned char>(c);
+      if (c == '"' || c == '\\') {
+        line += '\\';
+        line += c;
+      } else if (c == '\n') {
+        line += "\\n";
+      } else if (c == '\r') {
+        line += "\\r";
+      } else if (c == '\t') {
+        line += "\\t";
+      } else if (isprint(uc)) {
+        line += c;
+      } else {
+        line += "\\x";
+        line += hex[uc >> 4];
+        line += hex[uc & 0x0F];
+      }
+    }
+    line += '"';
+  }
+  return core::command_buffer_t(line.begin(), line.end());
+}
+
+common::Error SplitCommandLine(const std::string& line, std::vector<std::string>* argv) {
+  if (!argv) {
+    return common::make_error_inval();
+  }
+
+  std::vector<std::string> result;
+  size_t pos = 0;
+  while (true) {
+    while (pos < line.size() && isspace(static_cast<unsigned char>(line[pos]))) {
+      pos++;
+    }
+    if (pos == line.size()) {
+      break;
+    }
+
+    std::string arg;
+    const char quote = line[pos] == '"' || line[pos] == '\'' ? line[pos] : 0;
+    if (!quote) {
+      while (pos < line.size() && !isspace(static_cast<unsigned char>(line[pos]))) {
+        arg += line[pos++];
+      }
+      result.push_back(arg);
+      continue;
+    }
+
+    pos++;
+    bool closed = false;
+    while (pos < line.size()) {
+      const char c = line[pos];
+      if (c == quote) {
+        closed = true;
+        pos++;
+        break;
+      }
+
+      if (c == '\\' && pos + 1 < line.size()) {
+        const char next = line[pos + 1];
+        if (quote == '\'') {
+          arg += next == '\'' ? next : c;
+          pos += next == '\'' ? 2 : 1;
+          continue;
+        }
+
+        if (next == 'x' && pos + 3 < line.size() && IsHexDigit(line[pos + 2]) && IsHexDigit(line[pos + 3])) {
+          arg += static_cast<char>(HexDigitToInt(line[pos + 2]) * 16 + HexDigitToInt(line[pos + 3]));
+          pos += 4;
+          continue;
+        }
+
+        arg += next == 'n' ? '\n' : next == 'r' ? '\r' : next == 't' ? '\t' : next;
+        pos += 2;
+        continue;
+      }
+
+      arg += c;
+      pos++;
+    }
+
+    // closing quote must be followed by space, "a"b is invalid like in redis-cli
+    if (!closed || (pos < line.size() && !isspace(static_cast<unsigned char>(line[pos])))) {
+      return common::make_error("Unbalanced quotes.");
+    }
+    result.push_back(arg);
+  }
+
+  *argv = result;
+  return common::Error();
+}
+
+common::Error SplitCsvRecord(const std::string& line, std::vector<std::string>* argv) {
+  if (!argv) {
+    return common::make_error_inval();
+  }
+
+  std::vector<std::string> result;
+  size_t pos = 0;
+  while (true) {
+    std::string field;
+    if (pos < line.size() && line[pos] == '"') {
+      pos++;
+      bool closed = false;
+      while (pos < line.size()) {
+        if (line[pos] != '"') {
+          field += line[pos++];
+          continue;
+        }
+
+        if (pos + 1 < line.size() && line[pos + 1] == '"') {
+          field += '"';
+          pos += 2;
+          continue;
+        }
+
+        closed = true;
+        pos++;
+        break;
+      }
+
+      if (!closed || (pos < line.size() && line[pos] != ',')) {
+        return common::make_error("Invalid quoted field.");
+      }
+    } else {
+      const size_t end = line.find(',', pos);
+      const size_t field_end = end == std::string::npos ? line.size() : end;
+      field = line.substr(pos, field_end - pos);
+      pos = field_end;
+    }
+
+    result.push_back(field);
+    if (pos == line.size()) {
+      break;
+    }
+    pos++;  // ,
+  }
+
+  *argv = result;
+  return common::Error();
+}
+
+common::Error SplitJsonRecord(const std::string& line, std::vector<std::string>* argv) {
+  if (!argv) {
+    return common::make_error_inval();
+  }
+
+  json_object* obj = json_tokener_parse(line.c_str());
+  if (!obj) {
+    return common::make_error("Invalid json.");
+  }
+
+  if (!json_object_is_type(obj, json_type_array)) {
+    json_object_put(obj);
+    return common::make_error("Record should be json array of arguments.");
+  }
+
+  std::vector<std::string> result;
+  const size_t len = json_object_array_length(obj);
+  for (size_t i = 0; i < len; ++i) {
+    json_object* item = json_object_array_get_idx(obj, i);
+    const json_type type = json_object_get_type(item);
+    if (type == json_type_string) {
+      result.push_back(std::string(json_object_get_string(item), json_object_get_string_len(item)));
+    } else if (type == json_type_int || type == json_type_double || type == json_type_boolean) {
+      result.push_back(json_object_get_string(item));
+    } else {
+      json_object_put(obj);
+      return common::make_error("Arguments should be strings, numbers or booleans.");
+    }
+  }
+
+  json_object_put(obj);
+  *argv = result;
+  return common::Error();
+}
+
+CommandFileReader::CommandFileReader(const std::string& path, CommandFileFormat format)
+    : path_(path),
+      format_(format),
+      file_(),
+      buffer_(),
+      buffer_pos_(0),
+      buffer_offset_(0),
+      size_(0),
+      line_(0),
+      eof_(false) {}
+
+common::Error CommandFileReader::Open(uint64_t offset) {
+  file_.open(path_, std::ios::in | std::ios::binary);
+  if (!file_.is_open()) {
+    return common::make_error("Can't open file: " + path_);
+  }
+
+  file_.seekg(0, std::ios::end);
+  size_ = static_cast<uint64_t>(file_.tellg());
+  if (offset > size_) {
+    return common::make_error("Offset is out of file size.");
+  }
+
+  file_.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+  buffer_.clear();
+  buffer_pos_ = 0;
+  buffer_offset_ = offset;
+  line_ = 0;
+  eof_ = offset == size_;
+  return common::Error();
+}
+
+bool CommandFileReader::Next(CommandFileRecord* record) {
+  if (!record) {
+    return false;
+  }
+
+  while (true) {
+    const size_t end = buffer_.find(END_COMMAND_CHAR, buffer_pos_);
+    if (end == std::string::npos && !eof_) {
+      if (!ReadChunk()) {
+        eof_ = true;
+      }
+      continue;
+    }
+
+    if (buffer_pos_ == buffer_.size()) {
+      return false;
+    }
+
+    const size_t line_end = end == std::string::npos ? buffer_.size() : end;
+    const core::command_buffer_t line(buffer_.begin() + buffer_pos_, buffer_.begin() + line_end);
+    buffer_pos_ = end == std::string::npos ? line_end : line_end + 1;
+    line_++;
+    const core::command_buffer_t stable = StableCommand(line);
+    if (!stable.empty()) {
+      *record = CommandFileRecord();
+      record->line = line_;
+      MakeRecord(std::string(stable.begin(), stable.end()), record);
+      return true;
+    }
+  }
+}
+
+uint64_t CommandFileReader::GetOffset() const {
+  return buffer_offset_ + buffer_pos_;
+}
+
+uint64_t CommandFileReader::GetSize() const {
+  return size_;
+}
+
+bool CommandFileReader::ReadChunk() {
+  // drop consumed part, unfinished line stays at the beginning
+  buffer_.erase(0, buffer_pos_);
+  buffer_offset_ += buffer_pos_;
+  buffer_pos_ = 0;
+
+  const size_t old_size = buffer_.size();
+  buffer_.resize(old_size + chunk_size);
+  file_.read(&buffer_[old_size], chunk_size);
+  const std::streamsize readed = file_.gcount();
+  buffer_.resize(old_size + static_cast<size_t>(readed > 0 ? readed : 0));
+  return readed > 0;
+}
+
+void CommandFileReader::MakeRecord(const std::string& line, CommandFileRecord* record) const {
+  std::vector<std::string> argv;
+  if (format_ == kCommandFileCommands) {
+    // command goes to translator as is, arguments are needed only for key
+    record->command = core::command_buffer_t(line.begin(), line.end());
+    common::Error err = SplitCommandLine(line, &argv);
+    if (!err && !argv.empty()) {
+      record->name = argv[0];
+    }
+    if (!err && argv.size() > 1) {
+      record->key = argv[1];
+    }
+    return;
+  }
+
+  common::Error err = format_ == kCommandFileCsv ? SplitCsvRecord(line, &argv) : SplitJsonRecord(line, &argv);
+  if (!err && argv.empty()) {
+    err = common::make_error("Empty record.");
+  }
+  if (err) {
+    record->error = err;
+    return;
+  }
+
+  record->command = MakeCommandLine(argv);
+  record->name = argv[0];
+  if (argv.size() > 1) {
+    record->key = argv[1];
+  }
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,79 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <common/error.h>
+
+#include <fastonosql/core/types.h>
+
+#include "proxy/types.h"
+
+namespace fastonosql {
+namespace proxy {
+
+struct CommandFileRecord {
+  core::command_buffer_t command;
+  std::string name;     // first word, as written in file
+  std::string key;      // first argument, empty if command hasn't arguments
+  uint64_t line;        // counted from 1 at open offset
+  common::Error error;  // malformed record, command is empty
+};
+
+// redis-cli like quoting: "SET" "a b" -> SET "a b", so record survives line based parsing of translator
+core::command_buffer_t MakeCommandLine(const std::vector<std::string>& argv);
+common::Error SplitCommandLine(const std::string& line, std::vector<std::string>* argv);
+common::Error SplitCsvRecord(const std::string& line, std::vector<std::string>* argv);  // quoted fields in one line
+common::Error SplitJsonRecord(const std::string& line, std::vector<std::string>* argv);  // ["SET", "key", 1]
+
+// reads commands script by chunks, one record per line, so file size is not limited by memory
+class CommandFileReader {
+ public:
+  enum { chunk_size = 64 * 1024 };
+
+  CommandFileReader(const std::string& path, CommandFileFormat format);
+
+  common::Error Open(uint64_t offset);  // offset must point to line start, e.g. value of GetOffset
+  bool Next(CommandFileRecord* record);  // skips empty lines, false at end of file
+
+  uint64_t GetOffset() const;  // first byte after last returned command
+  uint64_t GetSize() const;
+
+ private:
+  bool ReadChunk();
+  void MakeRecord(const std::string& line, CommandFileRecord* record) const;
+
+  const std::string path_;
+  const CommandFileFormat format_;
+  std::ifstream file_;
+  std::string buffer_;
+  size_t buffer_pos_;
+  uint64_t buffer_offset_;  // file offset of buffer_[0]
+  uint64_t size_;
+  uint64_t line_;
+  bool eof_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
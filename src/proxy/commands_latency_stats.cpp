@@ -0,0 +1,106 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/commands_latency_stats.h"
+
+#include <ctype.h>
+#include <string.h>
+
+namespace fastonosql {
+namespace proxy {
+
+namespace {
+size_t HashName(const std::string& name) {
+  // FNV-1a 32
+  uint32_t hash = 2166136261U;
+  for (unsigned char c : name) {
+    hash ^= c;
+    hash *= 16777619U;
+  }
+  return hash;
+}
+}  // namespace
+
+CommandsLatencyStats::Slot::Slot() : used(false), name(), latency() {}
+
+CommandsLatencyStats::CommandsLatencyStats() : slots_(new Slot[max_commands]) {}
+
+void CommandsLatencyStats::Record(const std::string& command, uint64_t usec) {
+  const std::string name = command.substr(0, max_command_name - 1);
+  const size_t start = HashName(name) % max_commands;
+  for (size_t i = 0; i < max_commands; ++i) {
+    Slot& slot = slots_[(start + i) % max_commands];
+    if (slot.used.load(std::memory_order_acquire)) {
+      if (name == slot.name) {
+        slot.latency.Record(usec);
+        return;
+      }
+      continue;
+    }
+
+    // publish name before readers can see slot
+    strncpy(slot.name, name.c_str(), max_command_name - 1);
+    slot.name[max_command_name - 1] = 0;
+    slot.latency.Record(usec);
+    slot.used.store(true, std::memory_order_release);
+    return;
+  }
+  // table is full, new command names aren't tracked
+}
+
+CommandsLatencyStats::snapshot_t CommandsLatencyStats::GetSnapshot() const {
+  snapshot_t result;
+  for (size_t i = 0; i < max_commands; ++i) {
+    const Slot& slot = slots_[i];
+    if (!slot.used.load(std::memory_order_acquire) || slot.latency.GetCount() == 0) {
+      continue;
+    }
+
+    result.push_back(std::make_pair(std::string(slot.name), slot.latency.GetSnapshot()));
+  }
+  return result;
+}
+
+void CommandsLatencyStats::Reset() {
+  // names stay, so writer never sees half cleared slot
+  for (size_t i = 0; i < max_commands; ++i) {
+    slots_[i].latency.Reset();
+  }
+}
+
+std::string CommandsLatencyStats::GetCommandName(const char* input, size_t size) {
+  size_t begin = 0;
+  while (begin < size && input[begin] == ' ') {
+    begin++;
+  }
+
+  size_t end = begin;
+  while (end < size && input[end] != ' ') {
+    end++;
+  }
+
+  std::string result;
+  result.reserve(end - begin);
+  for (size_t i = begin; i < end; ++i) {
+    result.push_back(static_cast<char>(toupper(static_cast<unsigned char>(input[i]))));
+  }
+  return result;
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
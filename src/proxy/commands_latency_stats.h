@@ -0,0 +1,63 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "proxy/atomic_value_histogram.h"
+
+namespace fastonosql {
+namespace proxy {
+
+// latency histogram per command name, fixed open addressing table so
+// driver thread records and gui thread reads without locks
+class CommandsLatencyStats {
+ public:
+  enum { max_commands = 256, max_command_name = 32 };
+  typedef std::pair<std::string, ValueHistogram> command_latency_t;
+  typedef std::vector<command_latency_t> snapshot_t;
+
+  CommandsLatencyStats();
+
+  void Record(const std::string& command, uint64_t usec);  // only from one thread
+  snapshot_t GetSnapshot() const;
+  void Reset();
+
+  static std::string GetCommandName(const char* input, size_t size);  // upper case first word, input isn't copied
+
+ private:
+  struct Slot {
+    Slot();
+
+    std::atomic<bool> used;
+    char name[max_command_name];
+    AtomicValueHistogram latency;
+  };
+
+  std::unique_ptr<Slot[]> slots_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -125,7 +125,7 @@ namespace proxy {
 const char IConnectionSettings::default_ns_separator[] = ":";
 
 IConnectionSettings::IConnectionSettings(const connection_path_t& connection_path, core::ConnectionType type)
-    : connection_path_(connection_path), type_(type), msinterval_(0) {}
+    : connection_path_(connection_path), type_(type), msinterval_(0), value_tracking_(true) {}
 
 void IConnectionSettings::SetPath(const connection_path_t& path) {
   connection_path_ = path;
@@ -151,6 +151,14 @@ void IConnectionSettings::SetLoggingMsTimeInterval(int mstime) {
   msinterval_ = mstime;
 }
 
+bool IConnectionSettings::IsValueTrackingEnabled() const {
+  return value_tracking_;
+}
+
+void IConnectionSettings::SetValueTrackingEnabled(bool enabled) {
+  value_tracking_ = enabled;
+}
+
 IConnectionSettingsBase::IConnectionSettingsBase(const connection_path_t& connection_path,
                                                  const std::string& log_directory,
                                                  core::ConnectionType type)
@@ -42,6 +42,9 @@ class IConnectionSettings : public common::ClonableBase<IConnectionSettings> {
   int GetLoggingMsTimeInterval() const;
   void SetLoggingMsTimeInterval(int mstime);
 
+  bool IsValueTrackingEnabled() const;
+  void SetValueTrackingEnabled(bool enabled);
+
   IConnectionSettings* Clone() const override = 0;
 
  protected:
@@ -51,6 +54,7 @@ class IConnectionSettings : public common::ClonableBase<IConnectionSettings> {
 
  private:
   int msinterval_;
+  bool value_tracking_;  // not saved, temporary connections don't read values for cache
 };
 
 class IConnectionSettingsBase : public IConnectionSettings {
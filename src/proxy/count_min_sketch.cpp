@@ -0,0 +1,80 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/count_min_sketch.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace fastonosql {
+namespace proxy {
+
+namespace {
+uint64_t HashItem(const std::string& item) {
+  // FNV-1a 64
+  uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : item) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+}  // namespace
+
+CountMinSketch::CountMinSketch(size_t width, size_t depth)
+    : width_(std::max<size_t>(width, 1)), depth_(std::max<size_t>(depth, 1)), table_(width_ * depth_, 0), total_(0) {}
+
+CountMinSketch::count_t CountMinSketch::Add(const std::string& item, count_t count) {
+  const uint64_t hash = HashItem(item);
+  count_t estimate = std::numeric_limits<count_t>::max();
+  for (size_t row = 0; row < depth_; ++row) {
+    count_t& cell = table_[row * width_ + GetIndex(hash, row)];
+    cell += count;
+    estimate = std::min(estimate, cell);
+  }
+  total_ += count;
+  return estimate;
+}
+
+CountMinSketch::count_t CountMinSketch::Estimate(const std::string& item) const {
+  const uint64_t hash = HashItem(item);
+  count_t estimate = std::numeric_limits<count_t>::max();
+  for (size_t row = 0; row < depth_; ++row) {
+    estimate = std::min(estimate, table_[row * width_ + GetIndex(hash, row)]);
+  }
+  return estimate;
+}
+
+CountMinSketch::count_t CountMinSketch::GetTotal() const {
+  return total_;
+}
+
+void CountMinSketch::Reset() {
+  std::fill(table_.begin(), table_.end(), 0);
+  total_ = 0;
+}
+
+size_t CountMinSketch::GetIndex(uint64_t hash, size_t row) const {
+  // double hashing: h1 + row * h2 gives depth independent enough rows from one hash
+  const uint64_t h1 = hash & 0xFFFFFFFF;
+  const uint64_t h2 = (hash >> 32) | 1;
+  return static_cast<size_t>((h1 + row * h2) % width_);
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,54 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace fastonosql {
+namespace proxy {
+
+// approximate frequency counter with fixed memory (width * depth counters),
+// estimates never undercount, overcount is bounded by total / width with high probability
+class CountMinSketch {
+ public:
+  typedef uint64_t count_t;
+  enum { default_width = 2048, default_depth = 4 };
+
+  explicit CountMinSketch(size_t width = default_width, size_t depth = default_depth);
+
+  count_t Add(const std::string& item, count_t count = 1);  // returns new estimate of item
+  count_t Estimate(const std::string& item) const;
+  count_t GetTotal() const;
+  void Reset();
+
+ private:
+  size_t GetIndex(uint64_t hash, size_t row) const;
+
+  size_t width_;
+  size_t depth_;
+  std::vector<count_t> table_;
+  count_t total_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
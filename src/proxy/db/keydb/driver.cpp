@@ -37,8 +37,55 @@
 #include "proxy/db/keydb/command.h"
 #include "proxy/db/keydb/connection_settings.h"
 #include "proxy/db_client.h"
+#include "proxy/driver/key_events_root_locker.h"
+#include "proxy/driver/keyspace_root_locker.h"
+#include "proxy/driver/monitor_root_locker.h"
+#include "proxy/driver/value_tracking_root_locker.h"
+#include "proxy/value_codec_sniffer.h"
 
 #define REDIS_TYPE_COMMAND "TYPE"
+#define REDIS_SCAN_TYPE_ARGUMENT "TYPE"
+#define REDIS_MEMORY_USAGE_COMMAND "MEMORY USAGE"
+#define REDIS_STRLEN_COMMAND "STRLEN"
+#define REDIS_GETRANGE_COMMAND "GETRANGE"
+#define REDIS_LLEN_COMMAND "LLEN"
+#define REDIS_SCARD_COMMAND "SCARD"
+#define REDIS_ZCARD_COMMAND "ZCARD"
+#define REDIS_HLEN_COMMAND "HLEN"
+#define REDIS_LRANGE_COMMAND "LRANGE"
+#define REDIS_SSCAN_COMMAND "SSCAN"
+#define REDIS_ZSCAN_COMMAND "ZSCAN"
+#define REDIS_HSCAN_COMMAND "HSCAN"
+#define REDIS_SCAN_COUNT_ARGUMENT "COUNT"
+#define REDIS_XLEN_COMMAND "XLEN"
+#define REDIS_XRANGE_COMMAND "XRANGE"
+#define REDIS_XREVRANGE_COMMAND "XREVRANGE"
+#define REDIS_XINFO_STREAM_COMMAND "XINFO STREAM"
+#define REDIS_XINFO_GROUPS_COMMAND "XINFO GROUPS"
+#define REDIS_MONITOR_COMMAND "MONITOR"
+#define REDIS_SUBSCRIBE_COMMAND "SUBSCRIBE"
+#define REDIS_PSUBSCRIBE_COMMAND "PSUBSCRIBE"
+#define REDIS_PUBLISH_COMMAND "PUBLISH"
+#define REDIS_GET_NOTIFY_KEYSPACE_EVENTS_COMMAND "CONFIG GET notify-keyspace-events"
+#define REDIS_KEYSPACE_EVENTS_FLAG 'K'
+#define REDIS_KEYEVENT_EVENTS_FLAG 'E'
+#define REDIS_KEYSPACE_EVENTS_CLASSES "Aglshzxetmdn$"
+#define REDIS_KEYSPACE_CHANNEL_PREFIX "__keyspace@"
+#define REDIS_KEYEVENT_CHANNEL_PREFIX "__keyevent@"
+#define REDIS_KEYSPACE_CHANNEL_SEPARATOR "__:"
+#define REDIS_WATCH_WAKEUP_CHANNEL_PREFIX PROJECT_NAME_LOWERCASE "-watch-stop:"
+#define REDIS_SYNC_WAKEUP_CHANNEL_PREFIX PROJECT_NAME_LOWERCASE "-sync-stop:"
+#define REDIS_DIGEST_VALUE_COMMAND "DEBUG DIGEST-VALUE"
+#define REDIS_CLIENT_ID_COMMAND "CLIENT ID"
+#define REDIS_CLIENT_TRACKING_ON_COMMAND "CLIENT TRACKING on REDIRECT"
+#define REDIS_CLIENT_TRACKING_OPTIN_ARG "OPTIN"
+#define REDIS_CLIENT_CACHING_YES_COMMAND "CLIENT CACHING yes"
+#define REDIS_CLIENT_TRACKING_OFF_COMMAND "CLIENT TRACKING off"
+#define REDIS_TRACKING_INVALIDATE_CHANNEL "__redis__:invalidate"
+#define REDIS_TRACKING_WAKEUP_CHANNEL_PREFIX PROJECT_NAME_LOWERCASE "-tracking-stop:"
+#define REDIS_OBJECT_FREQ_COMMAND "OBJECT FREQ"
+#define REDIS_GET_MAXMEMORY_POLICY_COMMAND "CONFIG GET maxmemory-policy"
+#define REDIS_LFU_POLICY_MARKER "lfu"
 #define REDIS_SHUTDOWN_COMMAND "SHUTDOWN"
 #define REDIS_BACKUP_COMMAND "SAVE"
 #define REDIS_SET_PASSWORD_COMMAND "CONFIG SET requirepass"
@@ -48,6 +95,7 @@
 #define REDIS_PUBSUB_NUMSUB_COMMAND "PUBSUB NUMSUB"
 #define REDIS_CLIENT_LIST_COMMAND "CLIENT LIST"
 #define REDIS_GET_COMMANDS "COMMAND"
+#define REDIS_CLUSTER_NODES_COMMAND "CLUSTER NODES"
 
 #if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
 #include <fastonosql/core/imodule_connection_client.h>
@@ -69,10 +117,147 @@ command_buffer_t GetKeysOldPattern(const pattern_t& pattern) {
   wr << "KEYS " << pattern;
   return wr.str();
 }
+
+command_buffer_t GetKeysTypedPattern(cursor_t cursor_in,
+                                     const pattern_t& pattern,
+                                     keys_limit_t count_keys,
+                                     const std::string& key_type) {
+  command_buffer_writer_t wr;
+  wr << GetKeysPattern(cursor_in, pattern, count_keys) << " " REDIS_SCAN_TYPE_ARGUMENT " " << key_type;
+  return wr.str();
+}
 }  // namespace
 }  // namespace core
 namespace proxy {
 namespace keydb {
+namespace {
+const char* GetElementsCountCommand(common::Value::Type type) {
+  if (type == common::Value::TYPE_STRING) {
+    return REDIS_STRLEN_COMMAND;
+  } else if (type == common::Value::TYPE_ARRAY) {
+    return REDIS_LLEN_COMMAND;
+  } else if (type == common::Value::TYPE_SET) {
+    return REDIS_SCARD_COMMAND;
+  } else if (type == common::Value::TYPE_ZSET) {
+    return REDIS_ZCARD_COMMAND;
+  } else if (type == common::Value::TYPE_HASH) {
+    return REDIS_HLEN_COMMAND;
+  } else if (type == core::StreamValue::TYPE_STREAM) {
+    return REDIS_XLEN_COMMAND;
+  }
+
+  return nullptr;  // module types
+}
+
+const char* GetElementsScanCommand(common::Value::Type type) {
+  if (type == common::Value::TYPE_SET) {
+    return REDIS_SSCAN_COMMAND;
+  } else if (type == common::Value::TYPE_ZSET) {
+    return REDIS_ZSCAN_COMMAND;
+  } else if (type == common::Value::TYPE_HASH) {
+    return REDIS_HSCAN_COMMAND;
+  }
+
+  return nullptr;
+}
+
+void SkipLogCommand(core::FastoObjectCommandIPtr command) {
+  UNUSED(command);
+}
+
+bool GetReplyInteger(core::FastoObjectCommandIPtr cmd, long long* result) {
+  core::FastoObject::childs_t childrens = cmd->GetChildrens();
+  if (childrens.size() != 1) {
+    return false;
+  }
+
+  auto value = childrens[0]->GetValue();
+  return value && value->GetAsLongLongInteger(result);
+}
+
+bool GetReplyString(core::FastoObjectCommandIPtr cmd, std::string* result) {
+  core::FastoObject::childs_t childrens = cmd->GetChildrens();
+  if (childrens.size() != 1) {
+    return false;
+  }
+
+  auto value = childrens[0]->GetValue();
+  common::Value::string_t str;
+  if (!value || !value->GetAsString(&str)) {
+    return false;
+  }
+
+  *result = std::string(str.begin(), str.end());
+  return true;
+}
+
+bool GetReplyListString(core::FastoObjectCommandIPtr cmd, size_t index, std::string* result) {
+  core::FastoObject::childs_t childrens = cmd->GetChildrens();
+  if (childrens.size() != 1) {
+    return false;
+  }
+
+  auto value = childrens[0]->GetValue();
+  common::ArrayValue* ar = nullptr;
+  common::Value::string_t str;
+  if (!value || !value->GetAsList(&ar) || !ar->GetString(index, &str)) {
+    return false;
+  }
+
+  *result = std::string(str.begin(), str.end());
+  return true;
+}
+
+// XINFO replies are flat field, value arrays
+common::Value* FindInfoField(common::ArrayValue* ar, const std::string& field) {
+  for (size_t i = 0; i + 1 < ar->GetSize(); i += 2) {
+    common::Value::string_t name;
+    if (ar->GetString(i, &name) && std::string(name.begin(), name.end()) == field) {
+      return *(ar->begin() + i + 1);
+    }
+  }
+  return nullptr;
+}
+
+uint64_t GetInfoInteger(common::ArrayValue* ar, const std::string& field) {
+  common::Value* value = FindInfoField(ar, field);
+  long long result = 0;
+  if (!value || !value->GetAsLongLongInteger(&result) || result < 0) {
+    return 0;
+  }
+  return result;
+}
+
+// entry of XRANGE reply: id, [field, value, ...]
+bool GetStreamEntry(common::Value* value, core::StreamValue::Stream* stream) {
+  common::ArrayValue* entry = nullptr;
+  common::ArrayValue* fields = nullptr;
+  if (!value || !value->GetAsList(&entry) || entry->GetSize() != 2 || !entry->GetString(0, &stream->sid) ||
+      !entry->GetList(1, &fields)) {
+    return false;
+  }
+
+  stream->entries.clear();
+  for (size_t i = 0; i + 1 < fields->GetSize(); i += 2) {
+    core::StreamValue::Entry ent;
+    if (!fields->GetString(i, &ent.name) || !fields->GetString(i + 1, &ent.value)) {
+      return false;
+    }
+    stream->entries.push_back(ent);
+  }
+  return true;
+}
+
+// listener thread terminated in blocking read leaves its connection open
+common::Error ConnectListener(core::keydb::DBConnection* connection, const core::keydb::RConfig& rconf) {
+  if (connection->IsConnected()) {
+    common::Error err = connection->Disconnect();
+    UNUSED(err);
+  }
+  return connection->Connect(rconf);
+}
+}  // namespace
+
 #if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
 namespace {
 const struct RedisRegisterTypes {
@@ -96,12 +281,26 @@ Driver::Driver(IConnectionSettingsBaseSPtr settings)
 #if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
       proxy_(nullptr),
 #endif
-      impl_(nullptr) {
+      impl_(nullptr),
+      watch_impl_(nullptr),
+      watch_channel_(),
+      watch_wakeup_channel_(),
+      sync_impl_(nullptr),
+      sync_wakeup_channel_(),
+      track_impl_(nullptr),
+      track_client_id_(0),
+      track_caching_(false) {
 #if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
   proxy_ = new ProxyModuleClient(this);
   impl_ = new core::keydb::DBConnection(this, proxy_);
+  watch_impl_ = new core::keydb::DBConnection(nullptr, nullptr);
+  sync_impl_ = new core::keydb::DBConnection(nullptr, nullptr);
+  track_impl_ = new core::keydb::DBConnection(nullptr, nullptr);
 #else
   impl_ = new core::keydb::DBConnection(this);
+  watch_impl_ = new core::keydb::DBConnection(nullptr);
+  sync_impl_ = new core::keydb::DBConnection(nullptr);
+  track_impl_ = new core::keydb::DBConnection(nullptr);
 #endif
   COMPILE_ASSERT(core::keydb::DBConnection::GetConnectionType() == core::KEYDB,
                  "DBConnection must be the same type as Driver!");
@@ -109,6 +308,9 @@ Driver::Driver(IConnectionSettingsBaseSPtr settings)
 }
 
 Driver::~Driver() {
+  delete track_impl_;
+  delete sync_impl_;
+  delete watch_impl_;
   delete impl_;
 #if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
   delete proxy_;
@@ -172,9 +374,534 @@ common::Error Driver::SyncDisconnect() {
 }
 
 common::Error Driver::ExecuteImpl(const core::command_buffer_t& command, core::FastoObject* out) {
+  // tracking is opt-in, only keys of value loads are tracked, their results are the ones cached
+  core::command_buffer_t key;
+  if (track_caching_ && impl_->GetTranslator()->IsLoadKeyCommand(command, &key)) {
+    core::FastoObjectCommandIPtr cmd =
+        CreateCommandFast(GEN_CMD_STRING(REDIS_CLIENT_CACHING_YES_COMMAND), core::C_INNER);
+    common::Error err = impl_->Execute(cmd->GetInputCommand(), cmd.get());
+    if (err) {
+      return err;
+    }
+  }
+
   return impl_->Execute(command, out);
 }
 
+common::Error Driver::ExecuteBatchSilent(const std::vector<core::FastoObjectCommandIPtr>& cmds) {
+  return impl_->ExecuteAsPipeline(cmds, &SkipLogCommand);
+}
+
+common::Error Driver::GetClusterOwnSlots(cluster_slot_ranges_t* slots) {
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(GEN_CMD_STRING(REDIS_CLUSTER_NODES_COMMAND), core::C_INNER);
+  common::Error err = Execute(cmd);
+  if (err) {
+    return err;
+  }
+
+  std::string nodes;
+  if (!GetReplyString(cmd, &nodes)) {
+    return common::make_error("Invalid " REDIS_CLUSTER_NODES_COMMAND " command output");
+  }
+
+  return ParseClusterNodesOwnSlots(nodes, slots);
+}
+
+common::Error Driver::GetValueSize(const core::NKey& key, uint64_t* size) {
+  core::command_buffer_writer_t wr;
+  wr << REDIS_STRLEN_COMMAND " " << key.GetKey().GetForCommandLine();
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(wr.str(), core::C_INNER);
+  common::Error err = Execute(cmd);
+  if (err) {
+    return err;
+  }
+
+  long long len = 0;
+  if (!GetReplyInteger(cmd, &len) || len < 0) {
+    return common::make_error("Invalid " REDIS_STRLEN_COMMAND " command output");
+  }
+
+  *size = len;
+  return common::Error();
+}
+
+common::Error Driver::GetValueRange(const core::NKey& key, uint64_t offset, size_t size, std::string* out) {
+  if (!size) {
+    out->clear();
+    return common::Error();
+  }
+
+  core::command_buffer_writer_t wr;
+  wr << REDIS_GETRANGE_COMMAND " " << key.GetKey().GetForCommandLine() << " " << offset << " "
+     << offset + size - 1;
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(wr.str(), core::C_INNER);
+  common::Error err = Execute(cmd);
+  if (err) {
+    return err;
+  }
+
+  if (!GetReplyString(cmd, out)) {
+    return common::make_error("Invalid " REDIS_GETRANGE_COMMAND " command output");
+  }
+  return common::Error();
+}
+
+common::Error Driver::GetValueLength(const core::NKey& key, common::Value::Type type, uint64_t* length) {
+  const char* count_command = GetElementsCountCommand(type);
+  if (!count_command) {
+    return common::make_error("Paged reads are not supported for this value type");
+  }
+
+  core::command_buffer_writer_t wr;
+  wr << count_command << " " << key.GetKey().GetForCommandLine();
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(wr.str(), core::C_INNER);
+  common::Error err = Execute(cmd);
+  if (err) {
+    return err;
+  }
+
+  long long len = 0;
+  if (!GetReplyInteger(cmd, &len) || len < 0) {
+    return common::make_error("Invalid elements count command output");
+  }
+
+  *length = len;
+  return common::Error();
+}
+
+common::Error Driver::GetValuePage(const core::NKey& key,
+                                   common::Value::Type type,
+                                   core::cursor_t cursor,
+                                   size_t count,
+                                   core::cursor_t* cursor_out,
+                                   std::vector<common::Value::string_t>* items) {
+  // lists have no scan command, pages are index windows: cursor is index of first element
+  const bool is_list = type == common::Value::TYPE_ARRAY;
+  core::command_buffer_writer_t wr;
+  if (is_list) {
+    wr << REDIS_LRANGE_COMMAND " " << key.GetKey().GetForCommandLine() << " " << cursor << " "
+       << cursor + count - 1;
+  } else {
+    const char* scan_command = GetElementsScanCommand(type);
+    if (!scan_command) {
+      return common::make_error("Paged reads are not supported for this value type");
+    }
+    wr << scan_command << " " << key.GetKey().GetForCommandLine() << " " << cursor
+       << " " REDIS_SCAN_COUNT_ARGUMENT " " << count;
+  }
+
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(wr.str(), core::C_INNER);
+  common::Error err = Execute(cmd);
+  if (err) {
+    return err;
+  }
+
+  core::FastoObject::childs_t rchildrens = cmd->GetChildrens();
+  if (rchildrens.size() != 1) {
+    return common::make_error("Invalid value page command output");
+  }
+
+  common::ArrayValue* ar = nullptr;
+  if (is_list) {
+    if (!rchildrens[0]->GetValue()->GetAsList(&ar)) {
+      return common::make_error("Invalid " REDIS_LRANGE_COMMAND " command output");
+    }
+    *cursor_out = ar->GetSize() == count ? cursor + count : 0;
+  } else {
+    common::ArrayValue* arm = nullptr;
+    if (!rchildrens[0]->GetValue()->GetAsList(&arm) || arm->GetSize() != 2 || !arm->GetUInteger(0, cursor_out) ||
+        !arm->GetList(1, &ar)) {
+      return common::make_error("Invalid value page command output");
+    }
+  }
+
+  items->clear();
+  items->reserve(ar->GetSize());
+  for (size_t i = 0; i < ar->GetSize(); ++i) {
+    common::Value::string_t item;
+    if (!ar->GetString(i, &item)) {  // pairs must stay aligned
+      return common::make_error("Invalid value page command output");
+    }
+    items->push_back(item);
+  }
+  return common::Error();
+}
+
+common::Error Driver::GetStreamRange(const core::NKey& key,
+                                     const core::StreamValue::stream_id& start,
+                                     const core::StreamValue::stream_id& end,
+                                     size_t count,
+                                     bool reverse,
+                                     std::vector<core::StreamValue::Stream>* streams) {
+  core::command_buffer_writer_t wr;
+  if (reverse) {
+    wr << REDIS_XREVRANGE_COMMAND " " << key.GetKey().GetForCommandLine() << " " << end << " " << start;
+  } else {
+    wr << REDIS_XRANGE_COMMAND " " << key.GetKey().GetForCommandLine() << " " << start << " " << end;
+  }
+  wr << " " REDIS_SCAN_COUNT_ARGUMENT " " << count;
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(wr.str(), core::C_INNER);
+  common::Error err = Execute(cmd);
+  if (err) {
+    return err;
+  }
+
+  core::FastoObject::childs_t rchildrens = cmd->GetChildrens();
+  common::ArrayValue* ar = nullptr;
+  if (rchildrens.size() != 1 || !rchildrens[0]->GetValue()->GetAsList(&ar)) {
+    return common::make_error("Invalid " REDIS_XRANGE_COMMAND " command output");
+  }
+
+  streams->clear();
+  streams->reserve(ar->GetSize());
+  for (auto it = ar->begin(); it != ar->end(); ++it) {
+    core::StreamValue::Stream stream;
+    if (!GetStreamEntry(*it, &stream)) {
+      return common::make_error("Invalid " REDIS_XRANGE_COMMAND " command output");
+    }
+    streams->push_back(stream);
+  }
+  return common::Error();
+}
+
+common::Error Driver::GetStreamInfo(const core::NKey& key, StreamInfo* info) {
+  core::command_buffer_writer_t wr;
+  wr << REDIS_XINFO_STREAM_COMMAND " " << key.GetKey().GetForCommandLine();
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(wr.str(), core::C_INNER);
+  common::Error err = Execute(cmd);
+  if (err) {
+    return err;
+  }
+
+  core::FastoObject::childs_t rchildrens = cmd->GetChildrens();
+  common::ArrayValue* ar = nullptr;
+  if (rchildrens.size() != 1 || !rchildrens[0]->GetValue()->GetAsList(&ar)) {
+    return common::make_error("Invalid " REDIS_XINFO_STREAM_COMMAND " command output");
+  }
+
+  StreamInfo result;
+  result.length = GetInfoInteger(ar, "length");
+  core::StreamValue::Stream entry;
+  if (GetStreamEntry(FindInfoField(ar, "first-entry"), &entry)) {  // nil for empty stream
+    result.first_id = entry.sid;
+  }
+  if (GetStreamEntry(FindInfoField(ar, "last-entry"), &entry)) {
+    result.last_id = entry.sid;
+  }
+
+  core::command_buffer_writer_t wr_groups;
+  wr_groups << REDIS_XINFO_GROUPS_COMMAND " " << key.GetKey().GetForCommandLine();
+  cmd = CreateCommandFast(wr_groups.str(), core::C_INNER);
+  err = Execute(cmd);
+  if (err) {
+    return err;
+  }
+
+  rchildrens = cmd->GetChildrens();
+  if (rchildrens.size() != 1 || !rchildrens[0]->GetValue()->GetAsList(&ar)) {
+    return common::make_error("Invalid " REDIS_XINFO_GROUPS_COMMAND " command output");
+  }
+
+  for (auto it = ar->begin(); it != ar->end(); ++it) {
+    common::ArrayValue* group = nullptr;
+    if (!(*it)->GetAsList(&group)) {
+      return common::make_error("Invalid " REDIS_XINFO_GROUPS_COMMAND " command output");
+    }
+
+    StreamGroupInfo group_info;
+    common::Value::string_t name;
+    common::Value* name_value = FindInfoField(group, "name");
+    if (name_value && name_value->GetAsString(&name)) {
+      group_info.name = std::string(name.begin(), name.end());
+    }
+    group_info.consumers = GetInfoInteger(group, "consumers");
+    group_info.pending = GetInfoInteger(group, "pending");
+    common::Value* last_delivered = FindInfoField(group, "last-delivered-id");
+    if (last_delivered) {
+      last_delivered->GetAsString(&group_info.last_delivered_id);
+    }
+    long long lag = 0;
+    common::Value* lag_value = FindInfoField(group, "lag");  // since 7.0, nil if it can't be computed
+    if (lag_value && lag_value->GetAsLongLongInteger(&lag)) {
+      group_info.lag = lag;
+    }
+    result.groups.push_back(group_info);
+  }
+
+  *info = result;
+  return common::Error();
+}
+
+common::Error Driver::GetNotifyKeyspaceEvents(std::string* flags) {
+  core::FastoObjectCommandIPtr config_cmd =
+      CreateCommandFast(GEN_CMD_STRING(REDIS_GET_NOTIFY_KEYSPACE_EVENTS_COMMAND), core::C_INNER);
+  common::Error err = Execute(config_cmd);
+  if (err) {
+    return err;
+  }
+
+  if (!GetReplyListString(config_cmd, 1, flags)) {
+    return common::make_error("Invalid " REDIS_GET_NOTIFY_KEYSPACE_EVENTS_COMMAND " command output");
+  }
+
+  return common::Error();
+}
+
+common::Error Driver::GetClientId(long long* id) {
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(GEN_CMD_STRING(REDIS_CLIENT_ID_COMMAND), core::C_INNER);
+  common::Error err = Execute(cmd);  // since 5.0
+  if (err) {
+    return err;
+  }
+
+  if (!GetReplyInteger(cmd, id)) {
+    return common::make_error("Invalid " REDIS_CLIENT_ID_COMMAND " command output");
+  }
+
+  return common::Error();
+}
+
+void Driver::PublishWakeUp(const core::command_buffer_t& channel) {
+  core::command_buffer_writer_t wr;
+  wr << REDIS_PUBLISH_COMMAND " " << channel << " \"\"";
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(wr.str(), core::C_INNER);
+  common::Error err = Execute(cmd);
+  if (!err) {
+    return;
+  }
+
+  // driver connection is interrupted or broken, listener is joined without timeout, so it is woken up anyway
+  auto redis_settings = GetSpecificSettings<ConnectionSettings>();
+  core::keydb::RConfig rconf(redis_settings->GetInfo(), redis_settings->GetSSHInfo());
+#if defined(PRO_VERSION) || defined(ENTERPRISE_VERSION)
+  core::keydb::DBConnection connection(nullptr, nullptr);
+#else
+  core::keydb::DBConnection connection(nullptr);
+#endif
+  err = connection.Connect(rconf);
+  if (err) {  // server is unreachable, reads of listener connection fail as well
+    return;
+  }
+
+  core::FastoObjectCommandIPtr wakeup_cmd = CreateCommandFast(wr.str(), core::C_INNER);
+  err = connection.Execute(wakeup_cmd->GetInputCommand(), wakeup_cmd.get());
+  UNUSED(err);
+  err = connection.Disconnect();
+  UNUSED(err);
+}
+
+bool Driver::PrepareKeyWatchEvents(const core::NDbKValue& key) {
+  std::string flags;
+  common::Error err = GetNotifyKeyspaceEvents(&flags);
+  if (err) {  // CONFIG can be renamed or denied by ACL
+    return false;
+  }
+
+  // keyspace channels are published only with K flag and at least one class of events
+  if (flags.find(REDIS_KEYSPACE_EVENTS_FLAG) == std::string::npos ||
+      flags.find_first_of(REDIS_KEYSPACE_EVENTS_CLASSES) == std::string::npos) {
+    return false;
+  }
+
+  // listener is woken up on channel of its own, id of driver connection keeps it apart from other clients
+  long long client_id = 0;
+  err = GetClientId(&client_id);
+  if (err) {
+    return false;
+  }
+
+  // current db is read here, watch thread uses only own connection
+  core::command_buffer_writer_t wr;
+  wr << REDIS_KEYSPACE_CHANNEL_PREFIX << impl_->GetCurrentDBName() << REDIS_KEYSPACE_CHANNEL_SEPARATOR
+     << key.GetKey().GetKey().GetData();
+  watch_channel_ = wr.str();
+  core::command_buffer_writer_t wr_wakeup;
+  wr_wakeup << REDIS_WATCH_WAKEUP_CHANNEL_PREFIX << client_id;
+  watch_wakeup_channel_ = wr_wakeup.str();
+  watch_impl_->SetInterrupted(false);
+  return true;
+}
+
+common::Error Driver::WatchKeyEvents(const core::NDbKValue& key) {
+  // subscribed connection can't run other commands, value is reloaded through driver connection
+  auto redis_settings = GetSpecificSettings<ConnectionSettings>();
+  core::keydb::RConfig rconf(redis_settings->GetInfo(), redis_settings->GetSSHInfo());
+  common::Error err = ConnectListener(watch_impl_, rconf);
+  if (err) {
+    return err;
+  }
+
+  core::command_buffer_writer_t wr;
+  wr << REDIS_SUBSCRIBE_COMMAND " " << core::nkey_t(watch_channel_).GetForCommandLine() << " "
+     << watch_wakeup_channel_;
+
+  // runs on key watch thread, only own connection is used here
+  KeyspaceRootLocker lock(this, key, common::ConvertToString(watch_channel_), wr.str());
+  core::FastoObjectCommandIPtr cmd = CreateCommand(lock.Root().get(), wr.str(), core::C_INNER);
+  err = watch_impl_->Execute(cmd->GetInputCommand(), cmd.get());
+  if (watch_impl_->IsInterrupted()) {
+    err = common::Error();
+  }
+
+  common::Error disconnect_err = watch_impl_->Disconnect();
+  UNUSED(disconnect_err);
+  return err;
+}
+
+void Driver::InterruptKeyWatchEvents() {
+  watch_impl_->SetInterrupted(true);
+
+  // interrupt is checked only between replies, wake up listener on channel nobody else uses
+  PublishWakeUp(watch_wakeup_channel_);
+}
+
+common::Error Driver::CheckKeyEvents() {
+  std::string flags;
+  common::Error err = GetNotifyKeyspaceEvents(&flags);
+  if (err) {
+    return err;
+  }
+
+  if (flags.find(REDIS_KEYEVENT_EVENTS_FLAG) == std::string::npos ||
+      flags.find_first_of(REDIS_KEYSPACE_EVENTS_CLASSES) == std::string::npos) {
+    return common::make_error("Keyevent notifications are disabled, notify-keyspace-events needs E flag and classes "
+                              "of events (for example \"Eg$lshzxe\").");
+  }
+
+  // listener is woken up on channel of its own, id of driver connection keeps it apart from other clients
+  long long client_id = 0;
+  err = GetClientId(&client_id);
+  if (err) {
+    return err;
+  }
+
+  core::command_buffer_writer_t wr;
+  wr << REDIS_SYNC_WAKEUP_CHANNEL_PREFIX << client_id;
+  sync_wakeup_channel_ = wr.str();
+  return common::Error();
+}
+
+common::Error Driver::ListenKeyEvents(const core::db_name_t& db) {
+  sync_impl_->SetInterrupted(false);
+  auto redis_settings = GetSpecificSettings<ConnectionSettings>();
+  core::keydb::RConfig rconf(redis_settings->GetInfo(), redis_settings->GetSSHInfo());
+  common::Error err = ConnectListener(sync_impl_, rconf);
+  if (err) {
+    return err;
+  }
+
+  core::command_buffer_writer_t wr_prefix;
+  wr_prefix << REDIS_KEYEVENT_CHANNEL_PREFIX << db << REDIS_KEYSPACE_CHANNEL_SEPARATOR;
+  const core::command_buffer_t prefix = wr_prefix.str();
+  core::command_buffer_writer_t wr;
+  wr << REDIS_PSUBSCRIBE_COMMAND " " << prefix << "* " << sync_wakeup_channel_;  // pattern without wildcards
+
+  // runs on keyspace sync thread, only own connection is used here
+  KeyEventsRootLocker lock(this, common::ConvertToString(prefix), wr.str());
+  core::FastoObjectCommandIPtr cmd = CreateCommand(lock.Root().get(), wr.str(), core::C_INNER);
+  err = sync_impl_->Execute(cmd->GetInputCommand(), cmd.get());
+  if (sync_impl_->IsInterrupted()) {
+    err = common::Error();
+  }
+
+  common::Error disconnect_err = sync_impl_->Disconnect();
+  UNUSED(disconnect_err);
+  return err;
+}
+
+void Driver::InterruptKeyEvents(const core::db_name_t& db) {
+  UNUSED(db);
+  sync_impl_->SetInterrupted(true);
+
+  // interrupt is checked only between replies, wake up listener on channel nobody else uses,
+  // it matches no keyevent prefix and is ignored
+  PublishWakeUp(sync_wakeup_channel_);
+}
+
+common::Error Driver::EnableValueTracking() {
+  track_impl_->SetInterrupted(false);
+  auto redis_settings = GetSpecificSettings<ConnectionSettings>();
+  core::keydb::RConfig rconf(redis_settings->GetInfo(), redis_settings->GetSSHInfo());
+  common::Error err = ConnectListener(track_impl_, rconf);
+  if (err) {
+    return err;
+  }
+
+  // RESP2 connection gets invalidations of keys it read as pub/sub messages of redirect connection
+  core::FastoObjectCommandIPtr id_cmd = CreateCommandFast(GEN_CMD_STRING(REDIS_CLIENT_ID_COMMAND), core::C_INNER);
+  err = track_impl_->Execute(id_cmd->GetInputCommand(), id_cmd.get());
+  long long client_id = 0;
+  if (!err && !GetReplyInteger(id_cmd, &client_id)) {
+    err = common::make_error("Invalid " REDIS_CLIENT_ID_COMMAND " command output");
+  }
+
+  if (!err) {
+    core::command_buffer_writer_t wr;
+    wr << REDIS_CLIENT_TRACKING_ON_COMMAND " " << client_id << " " REDIS_CLIENT_TRACKING_OPTIN_ARG;
+    core::FastoObjectCommandIPtr cmd = CreateCommandFast(wr.str(), core::C_INNER);
+    err = Execute(cmd);  // since 6.0
+  }
+
+  if (err) {
+    common::Error disconnect_err = track_impl_->Disconnect();
+    UNUSED(disconnect_err);
+    return err;
+  }
+
+  track_client_id_ = client_id;
+  track_caching_ = true;
+  return common::Error();
+}
+
+common::Error Driver::ListenValueInvalidations() {
+  core::command_buffer_writer_t wr;
+  wr << REDIS_SUBSCRIBE_COMMAND " " REDIS_TRACKING_INVALIDATE_CHANNEL " " REDIS_TRACKING_WAKEUP_CHANNEL_PREFIX
+     << track_client_id_;
+
+  // runs on value tracking thread, only own connection is used here
+  ValueTrackingRootLocker lock(this, REDIS_TRACKING_INVALIDATE_CHANNEL, wr.str());
+  core::FastoObjectCommandIPtr cmd = CreateCommand(lock.Root().get(), wr.str(), core::C_INNER);
+  common::Error err = track_impl_->Execute(cmd->GetInputCommand(), cmd.get());
+  if (track_impl_->IsInterrupted()) {
+    err = common::Error();
+  }
+
+  common::Error disconnect_err = track_impl_->Disconnect();
+  UNUSED(disconnect_err);
+  return err;
+}
+
+void Driver::InterruptValueInvalidations() {
+  track_impl_->SetInterrupted(true);
+  track_caching_ = false;
+
+  // stop redirecting before listener goes away, then wake it up on channel nobody else uses
+  core::FastoObjectCommandIPtr off_cmd =
+      CreateCommandFast(GEN_CMD_STRING(REDIS_CLIENT_TRACKING_OFF_COMMAND), core::C_INNER);
+  common::Error err = Execute(off_cmd);
+  UNUSED(err);
+
+  core::command_buffer_writer_t wr;
+  wr << REDIS_TRACKING_WAKEUP_CHANNEL_PREFIX << track_client_id_;
+  PublishWakeUp(wr.str());
+}
+
+common::Error Driver::GetValueDigest(const core::NKey& key, std::string* digest) {
+  core::command_buffer_writer_t wr;
+  wr << REDIS_DIGEST_VALUE_COMMAND " " << key.GetKey().GetForCommandLine();
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(wr.str(), core::C_INNER);
+  common::Error err = Execute(cmd);  // since 6.0, can be disabled by enable-debug-command
+  if (err) {
+    return err;
+  }
+
+  if (!GetReplyListString(cmd, 0, digest) && !GetReplyString(cmd, digest)) {
+    return common::make_error("Invalid " REDIS_DIGEST_VALUE_COMMAND " command output");
+  }
+
+  return common::Error();
+}
+
 common::Error Driver::DBkcountImpl(core::keys_limit_t* size) {
   return impl_->DBKeysCount(size);
 }
@@ -365,8 +1092,12 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
 
   uint32_t version = serv->GetVersion();
   new_behavior = version >= PROJECT_VERSION_GENERATE(2, 8, 0);
+  // SCAN ... TYPE available since 6.0, older servers filtered by TYPE replies below
+  const bool type_pushdown = !res.key_type.empty() && version >= PROJECT_VERSION_GENERATE(6, 0, 0);
   core::keys_limit_t keys_count = res.keys_count;
-  if (new_behavior) {
+  if (type_pushdown) {
+    pattern_result = core::GetKeysTypedPattern(res.cursor_in, res.pattern, keys_count, res.key_type);
+  } else if (new_behavior) {
     pattern_result = core::GetKeysPattern(res.cursor_in, res.pattern, keys_count);
   } else {
     pattern_result = core::GetKeysOldPattern(res.pattern);
@@ -450,6 +1181,7 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
           goto done;
         }
 
+        std::vector<bool> type_matched(res.keys.size(), true);
         for (size_t i = 0; i < res.keys.size(); ++i) {
           core::FastoObjectIPtr cmdType = cmds[i * 2];
           core::FastoObject::childs_t tchildrens = cmdType->GetChildrens();
@@ -457,6 +1189,9 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
             DCHECK_EQ(tchildrens.size(), 1);
             if (tchildrens.size() == 1) {
               common::Value::string_t type_redis_str = tchildrens[0]->ToString();
+              if (!res.key_type.empty() && !type_pushdown) {
+                type_matched[i] = common::ConvertToString(type_redis_str) == res.key_type;
+              }
               common::Value::Type ctype;
               core::redis_compatible::ConvertFromString(type_redis_str, &ctype);
               core::NValue empty_val(core::CreateEmptyValueFromType(ctype));
@@ -480,6 +1215,16 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
           }
         }
 
+        if (!res.key_type.empty() && !type_pushdown) {
+          events::LoadDatabaseContentResponseEvent::value_type::keys_container_t typed_keys;
+          for (size_t i = 0; i < res.keys.size(); ++i) {
+            if (type_matched[i]) {
+              typed_keys.push_back(res.keys[i]);
+            }
+          }
+          res.keys = typed_keys;
+        }
+
         err = DBkcountImpl(&res.db_keys_count);
         DCHECK(!err);
       }
@@ -491,6 +1236,289 @@ done:
   NotifyProgress(sender, 100);
 }
 
+void Driver::HandleLoadKeysStatisticsEvent(events::LoadKeysStatisticsRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::LoadKeysStatisticsResponseEvent::value_type res(ev->value());
+  const auto serv = GetCurrentServerInfoIfConnected();
+  if (!serv) {
+    res.setErrorInfo(common::make_error("Not connected"));
+    NotifyProgress(sender, 75);
+    Reply(sender, new events::LoadKeysStatisticsResponseEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  const uint32_t version = serv->GetVersion();
+  if (version < PROJECT_VERSION_GENERATE(2, 8, 0)) {
+    res.setErrorInfo(common::make_error("Keys statistics requires SCAN command (server version 2.8+)"));
+    NotifyProgress(sender, 75);
+    Reply(sender, new events::LoadKeysStatisticsResponseEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  const bool memory_usage = version >= PROJECT_VERSION_GENERATE(4, 0, 0);
+  core::FastoObjectCommandIPtr cmd =
+      CreateCommandFast(core::GetKeysPattern(res.cursor_in, res.pattern, res.keys_count), core::C_INNER);
+  NotifyProgress(sender, 25);
+  common::Error err = Execute(cmd);
+  if (err) {
+    res.setErrorInfo(err);
+    goto done;
+  }
+
+  {
+    core::FastoObject::childs_t rchildrens = cmd->GetChildrens();
+    if (rchildrens.size() != 1) {
+      goto done;
+    }
+
+    common::ArrayValue* arm = nullptr;
+    if (!rchildrens[0]->GetValue()->GetAsList(&arm) || arm->GetSize() != 2) {
+      goto done;
+    }
+
+    common::ArrayValue* ar = nullptr;
+    if (!arm->GetUInteger(0, &res.cursor_out) || !arm->GetList(1, &ar)) {
+      goto done;
+    }
+
+    // first round: TYPE, TTL and MEMORY USAGE of every key
+    const size_t step = memory_usage ? 3 : 2;
+    std::vector<core::FastoObjectCommandIPtr> cmds;
+    cmds.reserve(ar->GetSize() * step);
+    for (size_t i = 0; i < ar->GetSize(); ++i) {
+      common::Value::string_t key;
+      if (!ar->GetString(i, &key)) {
+        continue;
+      }
+
+      const core::nkey_t key_str(key);
+      core::command_buffer_writer_t wr_type;
+      wr_type << REDIS_TYPE_COMMAND " " << key_str.GetForCommandLine();
+      cmds.push_back(CreateCommandFast(wr_type.str(), core::C_INNER));
+
+      core::command_buffer_writer_t wr_ttl;
+      wr_ttl << DB_GET_TTL_COMMAND " " << key_str.GetForCommandLine();
+      cmds.push_back(CreateCommandFast(wr_ttl.str(), core::C_INNER));
+
+      if (memory_usage) {
+        core::command_buffer_writer_t wr_mem;
+        wr_mem << REDIS_MEMORY_USAGE_COMMAND " " << key_str.GetForCommandLine();
+        cmds.push_back(CreateCommandFast(wr_mem.str(), core::C_INNER));
+      }
+      res.keys.push_back(NDbKeyStat(core::NKey(key_str), common::Value::TYPE_NULL, 0, 0));
+    }
+
+    err = impl_->ExecuteAsPipeline(cmds, &LOG_COMMAND);
+    if (err) {
+      res.setErrorInfo(err);
+      goto done;
+    }
+    NotifyProgress(sender, 50);
+
+    // second round: elements count, command depends on type, and first bytes of strings for codec sniffing
+    std::vector<core::FastoObjectCommandIPtr> count_cmds;
+    std::vector<size_t> count_indexes;
+    std::vector<core::FastoObjectCommandIPtr> sniff_cmds;
+    std::vector<size_t> sniff_indexes;
+    for (size_t i = 0; i < res.keys.size(); ++i) {
+      NDbKeyStat& stat = res.keys[i];
+      core::FastoObject::childs_t tchildrens = cmds[i * step]->GetChildrens();
+      if (tchildrens.size() == 1) {
+        common::Value::Type ctype;
+        core::redis_compatible::ConvertFromString(tchildrens[0]->ToString(), &ctype);
+        stat.SetType(ctype);
+      }
+
+      long long ttl = 0;
+      if (GetReplyInteger(cmds[i * step + 1], &ttl)) {
+        core::NKey key = stat.GetKey();
+        key.SetTTL(ttl);
+        stat.SetKey(key);
+      }
+
+      long long bytes = 0;
+      if (memory_usage && GetReplyInteger(cmds[i * step + 2], &bytes)) {
+        stat.SetMemoryUsage(bytes);
+      }
+
+      const char* count_command = GetElementsCountCommand(stat.GetType());
+      if (count_command) {
+        core::command_buffer_writer_t wr_count;
+        wr_count << count_command << " " << stat.GetKey().GetKey().GetForCommandLine();
+        count_cmds.push_back(CreateCommandFast(wr_count.str(), core::C_INNER));
+        count_indexes.push_back(i);
+      }
+
+      if (stat.GetType() == common::Value::TYPE_STRING) {
+        core::command_buffer_writer_t wr_sniff;
+        wr_sniff << REDIS_GETRANGE_COMMAND " " << stat.GetKey().GetKey().GetForCommandLine() << " 0 "
+                 << value_codec_sniff_size - 1;
+        sniff_cmds.push_back(CreateCommandFast(wr_sniff.str(), core::C_INNER));
+        sniff_indexes.push_back(i);
+      }
+    }
+
+    if (!count_cmds.empty()) {
+      err = impl_->ExecuteAsPipeline(count_cmds, &LOG_COMMAND);
+      if (err) {
+        res.setErrorInfo(err);
+        goto done;
+      }
+    }
+
+    for (size_t i = 0; i < count_cmds.size(); ++i) {
+      long long count = 0;
+      if (GetReplyInteger(count_cmds[i], &count)) {
+        res.keys[count_indexes[i]].SetElementsCount(count);
+      }
+    }
+
+    if (!sniff_cmds.empty()) {
+      err = impl_->ExecuteAsPipeline(sniff_cmds, &LOG_COMMAND);
+      if (err) {
+        res.setErrorInfo(err);
+        goto done;
+      }
+    }
+
+    for (size_t i = 0; i < sniff_cmds.size(); ++i) {
+      std::string prefix;
+      if (GetReplyString(sniff_cmds[i], &prefix)) {
+        res.keys[sniff_indexes[i]].SetValueCodec(SniffValueCodec(prefix.data(), prefix.size()));
+      }
+    }
+
+    err = DBkcountImpl(&res.db_keys_count);
+    DCHECK(!err);
+  }
+done:
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::LoadKeysStatisticsResponseEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void Driver::HandleSampleHotKeysEvent(events::SampleHotKeysRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::SampleHotKeysResponseEvent::value_type res(ev->value());
+  const auto serv = GetCurrentServerInfoIfConnected();
+  if (!serv) {
+    res.setErrorInfo(common::make_error("Not connected"));
+    NotifyProgress(sender, 75);
+    Reply(sender, new events::SampleHotKeysResponseEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  HotKeysSampler sampler(res.top_k, res.sample_rate, GetNsSeparator(), 1);
+  const uint32_t version = serv->GetVersion();
+  common::Error err;
+  if (res.mode == kHotKeysAuto) {
+    // LFU policy keeps access frequency per key, reading it is much cheaper than MONITOR
+    res.used_mode = kHotKeysMonitor;
+    if (version >= PROJECT_VERSION_GENERATE(4, 0, 0)) {
+      core::FastoObjectCommandIPtr policy_cmd =
+          CreateCommandFast(GEN_CMD_STRING(REDIS_GET_MAXMEMORY_POLICY_COMMAND), core::C_INNER);
+      err = Execute(policy_cmd);
+      if (!err) {
+        core::FastoObject::childs_t childrens = policy_cmd->GetChildrens();
+        common::ArrayValue* policy_array = nullptr;
+        common::Value::string_t policy;
+        if (childrens.size() == 1 && childrens[0]->GetValue()->GetAsList(&policy_array) &&
+            policy_array->GetString(1, &policy) &&
+            common::ConvertToString(policy).find(REDIS_LFU_POLICY_MARKER) != std::string::npos) {
+          res.used_mode = kHotKeysObjectFreq;
+        }
+      }
+    }
+  }
+  NotifyProgress(sender, 25);
+
+  if (res.used_mode == kHotKeysObjectFreq) {
+    if (version < PROJECT_VERSION_GENERATE(4, 0, 0)) {
+      res.setErrorInfo(common::make_error("OBJECT FREQ requires server version 4.0+"));
+      goto done;
+    }
+
+    core::FastoObjectCommandIPtr cmd =
+        CreateCommandFast(core::GetKeysPattern(res.cursor_in, ALL_KEYS_PATTERNS, res.keys_count), core::C_INNER);
+    err = Execute(cmd);
+    if (err) {
+      res.setErrorInfo(err);
+      goto done;
+    }
+
+    core::FastoObject::childs_t rchildrens = cmd->GetChildrens();
+    if (rchildrens.size() != 1) {
+      goto done;
+    }
+
+    common::ArrayValue* arm = nullptr;
+    if (!rchildrens[0]->GetValue()->GetAsList(&arm) || arm->GetSize() != 2) {
+      goto done;
+    }
+
+    common::ArrayValue* ar = nullptr;
+    if (!arm->GetUInteger(0, &res.cursor_out) || !arm->GetList(1, &ar)) {
+      goto done;
+    }
+
+    std::vector<core::FastoObjectCommandIPtr> cmds;
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < ar->GetSize(); ++i) {
+      common::Value::string_t key;
+      if (!ar->GetString(i, &key)) {
+        continue;
+      }
+
+      const core::nkey_t key_str(key);
+      core::command_buffer_writer_t wr;
+      wr << REDIS_OBJECT_FREQ_COMMAND " " << key_str.GetForCommandLine();
+      cmds.push_back(CreateCommandFast(wr.str(), core::C_INNER));
+      keys.push_back(common::ConvertToString(key));
+    }
+
+    err = impl_->ExecuteAsPipeline(cmds, &LOG_COMMAND);
+    if (err) {
+      res.setErrorInfo(err);
+      goto done;
+    }
+
+    for (size_t i = 0; i < cmds.size(); ++i) {
+      long long freq = 0;
+      if (GetReplyInteger(cmds[i], &freq) && freq > 0) {
+        sampler.AddKeyFrequency(keys[i], freq);
+      }
+    }
+
+    err = DBkcountImpl(&res.db_keys_count);
+    DCHECK(!err);
+  } else {
+    // window is closed by interrupting MONITOR from locker, partial result of user interrupt is valid too
+    MonitorRootLocker lock(this, &sampler, GEN_CMD_STRING(REDIS_MONITOR_COMMAND), res.duration_msec);
+    core::FastoObjectCommandIPtr cmd =
+        CreateCommand(lock.Root().get(), GEN_CMD_STRING(REDIS_MONITOR_COMMAND), core::C_INNER);
+    err = Execute(cmd);
+    if (err && !IsInterrupted()) {
+      res.setErrorInfo(err);
+    }
+    res.elapsed_msec = lock.GetElapsedTime();
+  }
+
+done:
+  res.seen_count = sampler.GetSeenCount();
+  res.sampled_count = sampler.GetSampledCount();
+  res.commands = sampler.GetTopCommands();
+  res.keys = sampler.GetTopKeys();
+  res.namespaces = sampler.GetTopNamespaces();
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::SampleHotKeysResponseEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
 void Driver::HandleDiscoveryInfoEvent(events::DiscoveryInfoRequestEvent* ev) {
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
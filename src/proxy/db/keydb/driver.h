@@ -76,6 +76,43 @@ class Driver : public IDriverRemote {
   common::Error SyncDisconnect() override WARN_UNUSED_RESULT;
 
   common::Error ExecuteImpl(const core::command_buffer_t& command, core::FastoObject* out) override WARN_UNUSED_RESULT;
+  common::Error ExecuteBatchSilent(const std::vector<core::FastoObjectCommandIPtr>& cmds) override WARN_UNUSED_RESULT;
+  common::Error GetClusterOwnSlots(cluster_slot_ranges_t* slots) override WARN_UNUSED_RESULT;
+  common::Error GetValueSize(const core::NKey& key, uint64_t* size) override WARN_UNUSED_RESULT;
+  common::Error GetValueRange(const core::NKey& key,
+                              uint64_t offset,
+                              size_t size,
+                              std::string* out) override WARN_UNUSED_RESULT;
+  common::Error GetValueLength(const core::NKey& key,
+                               common::Value::Type type,
+                               uint64_t* length) override WARN_UNUSED_RESULT;
+  common::Error GetValuePage(const core::NKey& key,
+                             common::Value::Type type,
+                             core::cursor_t cursor,
+                             size_t count,
+                             core::cursor_t* cursor_out,
+                             std::vector<common::Value::string_t>* items) override WARN_UNUSED_RESULT;
+  common::Error GetStreamRange(const core::NKey& key,
+                               const core::StreamValue::stream_id& start,
+                               const core::StreamValue::stream_id& end,
+                               size_t count,
+                               bool reverse,
+                               std::vector<core::StreamValue::Stream>* streams) override WARN_UNUSED_RESULT;
+  common::Error GetStreamInfo(const core::NKey& key, StreamInfo* info) override WARN_UNUSED_RESULT;
+  bool PrepareKeyWatchEvents(const core::NDbKValue& key) override;
+  common::Error WatchKeyEvents(const core::NDbKValue& key) override WARN_UNUSED_RESULT;
+  void InterruptKeyWatchEvents() override;
+  common::Error GetValueDigest(const core::NKey& key, std::string* digest) override WARN_UNUSED_RESULT;
+  common::Error CheckKeyEvents() override WARN_UNUSED_RESULT;
+  common::Error ListenKeyEvents(const core::db_name_t& db) override WARN_UNUSED_RESULT;
+  void InterruptKeyEvents(const core::db_name_t& db) override;
+  common::Error EnableValueTracking() override WARN_UNUSED_RESULT;
+  common::Error ListenValueInvalidations() override WARN_UNUSED_RESULT;
+  void InterruptValueInvalidations() override;
+  common::Error GetNotifyKeyspaceEvents(std::string* flags) WARN_UNUSED_RESULT;
+  common::Error GetClientId(long long* id) WARN_UNUSED_RESULT;  // of driver connection
+  // falls back to temporary connection, so blocked listener is woken up even if driver connection is not usable
+  void PublishWakeUp(const core::command_buffer_t& channel);
   common::Error DBkcountImpl(core::keys_limit_t* size) override WARN_UNUSED_RESULT;
 
   common::Error GetCurrentServerInfo(core::IServerInfo** info) override;
@@ -94,6 +131,8 @@ class Driver : public IDriverRemote {
   void HandleRestoreEvent(events::RestoreRequestEvent* ev) override;
 
   void HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEvent* ev) override;
+  void HandleLoadKeysStatisticsEvent(events::LoadKeysStatisticsRequestEvent* ev) override;
+  void HandleSampleHotKeysEvent(events::SampleHotKeysRequestEvent* ev) override;
 
   core::IServerInfoSPtr MakeServerInfoFromString(const std::string& val) override;
 
@@ -101,6 +140,14 @@ class Driver : public IDriverRemote {
   core::IModuleConnectionClient* proxy_;
 #endif
   core::keydb::DBConnection* impl_;
+  core::keydb::DBConnection* watch_impl_;  // pub/sub connection of key watch thread
+  core::command_buffer_t watch_channel_;         // raw keyspace channel of watched key
+  core::command_buffer_t watch_wakeup_channel_;  // private channel waking key watch thread up on stop
+  core::keydb::DBConnection* sync_impl_;   // pub/sub connection of keyspace sync thread
+  core::command_buffer_t sync_wakeup_channel_;
+  core::keydb::DBConnection* track_impl_;  // redirect connection of client tracking invalidations
+  long long track_client_id_;
+  bool track_caching_;  // value loads are opted in to tracking, used only on driver thread
 };
 
 }  // namespace keydb
@@ -136,6 +136,13 @@ void Driver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEv
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
   events::LoadDatabaseContentResponseEvent::value_type res(ev->value());
+  if (!res.key_type.empty()) {  // unfiltered keys would be shown under type filter
+    res.setErrorInfo(common::make_error("Database doesn't support key type filter."));
+    Reply(sender, new events::LoadDatabaseContentResponseEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
   const core::command_buffer_t pattern_result = core::GetKeysPattern(res.cursor_in, res.pattern, res.keys_count);
   core::FastoObjectCommandIPtr cmd = CreateCommandFast(pattern_result, core::C_INNER);
   NotifyProgress(sender, 50);
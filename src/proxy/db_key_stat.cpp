@@ -0,0 +1,78 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/db_key_stat.h"
+
+namespace fastonosql {
+namespace proxy {
+
+NDbKeyStat::NDbKeyStat()
+    : key_(), type_(common::Value::TYPE_NULL), memory_usage_(0), elements_count_(0), codec_(kValueCodecRaw) {}
+
+NDbKeyStat::NDbKeyStat(const core::NKey& key,
+                       common::Value::Type type,
+                       size_t memory_usage,
+                       size_t elements_count)
+    : key_(key),
+      type_(type),
+      memory_usage_(memory_usage),
+      elements_count_(elements_count),
+      codec_(kValueCodecRaw) {}
+
+core::NKey NDbKeyStat::GetKey() const {
+  return key_;
+}
+
+void NDbKeyStat::SetKey(const core::NKey& key) {
+  key_ = key;
+}
+
+common::Value::Type NDbKeyStat::GetType() const {
+  return type_;
+}
+
+void NDbKeyStat::SetType(common::Value::Type type) {
+  type_ = type;
+}
+
+size_t NDbKeyStat::GetMemoryUsage() const {
+  return memory_usage_;
+}
+
+void NDbKeyStat::SetMemoryUsage(size_t memory_usage) {
+  memory_usage_ = memory_usage;
+}
+
+size_t NDbKeyStat::GetElementsCount() const {
+  return elements_count_;
+}
+
+void NDbKeyStat::SetElementsCount(size_t elements_count) {
+  elements_count_ = elements_count;
+}
+
+ValueCodec NDbKeyStat::GetValueCodec() const {
+  return codec_;
+}
+
+void NDbKeyStat::SetValueCodec(ValueCodec codec) {
+  codec_ = codec;
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
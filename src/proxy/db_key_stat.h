@@ -0,0 +1,60 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <common/value.h>
+
+#include <fastonosql/core/db_key.h>
+
+#include "proxy/types.h"
+
+namespace fastonosql {
+namespace proxy {
+
+// MEMORY USAGE, TYPE, TTL, elements count and sniffed codec of one key
+class NDbKeyStat {
+ public:
+  NDbKeyStat();
+  NDbKeyStat(const core::NKey& key, common::Value::Type type, size_t memory_usage, size_t elements_count);
+
+  core::NKey GetKey() const;
+  void SetKey(const core::NKey& key);
+
+  common::Value::Type GetType() const;
+  void SetType(common::Value::Type type);
+
+  size_t GetMemoryUsage() const;  // bytes, 0 if server can't report it
+  void SetMemoryUsage(size_t memory_usage);
+
+  size_t GetElementsCount() const;  // string length for strings
+  void SetElementsCount(size_t elements_count);
+
+  ValueCodec GetValueCodec() const;  // raw for not string values
+  void SetValueCodec(ValueCodec codec);
+
+ private:
+  core::NKey key_;
+  common::Value::Type type_;
+  size_t memory_usage_;
+  size_t elements_count_;
+  ValueCodec codec_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
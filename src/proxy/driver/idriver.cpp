@@ -18,6 +18,10 @@
 
 #include "proxy/driver/idriver.h"
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -32,13 +36,24 @@
 #include <common/threads/platform_thread.h>
 #include <common/time.h>
 
+#include <fastonosql/core/value.h>
+
+#include "proxy/benchmark_generator.h"
+#include "proxy/command_file_reader.h"
 #include "proxy/command/command_logger.h"
 #include "proxy/driver/first_child_update_root_locker.h"
+#include "proxy/driver/key_watch_worker.h"
+#include "proxy/driver/keyspace_sync_worker.h"
+#include "proxy/driver/value_tracking_worker.h"
 
 namespace {
 
 const char kStampMagicNumber = 0x1E;
 const char kEndLine = '\n';
+const common::time64_t kWatchSleepSliceMsec = 100;  // polling watch stays responsive to stop
+const common::time64_t kKeyEventsWindowMsec = 500;
+const size_t kKeyEventsWindowLimit = 50;  // more events per window are applied in one batch
+const size_t kKeyEventsBatchLimit = 1000;
 std::string CreateStamp(common::time64_t time) {
   return kStampMagicNumber + common::ConvertToString(time) + kEndLine;
 }
@@ -83,6 +98,9 @@ const struct RegisterTypes {
     qRegisterMetaType<core::ttl_t>("core::ttl_t");
     qRegisterMetaType<core::nkey_t>("core::nkey_t");
     qRegisterMetaType<core::ServerInfoSnapShoot>("core::ServerInfoSnapShoot");
+    qRegisterMetaType<keyspace_changes_t>("keyspace_changes_t");
+    qRegisterMetaType<invalidated_keys_t>("invalidated_keys_t");
+    qRegisterMetaType<common::Error>("common::Error");
   }
 } reg_type;
 
@@ -105,15 +123,72 @@ void ReplyNotImplementedYet(IDriver* sender, event_request_type* ev, const char*
   NotifyProgressImpl(sender, esender, 100);
 }
 
+common::Error MakeFileLinesError(uint64_t first_line, uint64_t last_line, common::Error err) {
+  const std::string lines = first_line == last_line ? "line " + common::ConvertToString(first_line)
+                                                    : "lines " + common::ConvertToString(first_line) + "-" +
+                                                          common::ConvertToString(last_line);
+  return common::make_error(lines + ": " + err->GetDescription());
+}
+
+// state of these stays on one connection, commands after them may run on other shard
+bool IsConnectionStateCommand(const std::string& name) {
+  static const char* const kStateCommands[] = {"SELECT", "MULTI", "EXEC", "DISCARD", "WATCH", "UNWATCH"};
+  for (const char* state_command : kStateCommands) {
+    if (name.size() == strlen(state_command) &&
+        std::equal(name.begin(), name.end(), state_command,
+                   [](char left, char right) { return std::toupper(left) == std::toupper(right); })) {
+      return true;
+    }
+  }
+  return false;
+}
+
+common::ValueSPtr GetReplyValue(core::FastoObjectCommandIPtr cmd) {
+  core::FastoObject::childs_t childrens = cmd->GetChildrens();
+  if (childrens.size() != 1) {
+    return common::ValueSPtr();
+  }
+
+  return childrens[0]->GetValue();
+}
+
+void AddExecuteFileError(events_info::ExecuteFileResponse* res, common::Error err) {
+  if (res->errors.size() < events_info::ExecuteFileResponse::max_errors) {
+    res->errors.push_back(err->GetDescription());
+  }
+}
+
 }  // namespace
 
 IDriver::IDriver(IConnectionSettingsBaseSPtr settings)
-    : settings_(settings), thread_(nullptr), timer_info_id_(0), log_file_(nullptr), server_info_() {
+    : settings_(settings),
+      thread_(nullptr),
+      key_watch_thread_(nullptr),
+      key_watch_sender_(nullptr),
+      key_watch_res_(nullptr),
+      key_watch_err_(),
+      key_watch_stopped_(false),
+      key_watch_reload_pending_(false),
+      key_watch_digest_(),
+      key_watch_digest_supported_(false),
+      keyspace_sync_thread_(nullptr),
+      keyspace_sync_db_(),
+      keyspace_sync_timer_id_(0),
+      keyspace_sync_mutex_(),
+      keyspace_sync_batcher_(kKeyEventsWindowMsec, kKeyEventsWindowLimit, kKeyEventsBatchLimit),
+      value_tracking_thread_(nullptr),
+      invalidations_count_(0),
+      command_invalidations_count_(0),
+      timer_info_id_(0),
+      log_file_(nullptr),
+      server_info_(),
+      commands_latency_() {
   thread_ = new QThread(this);
   moveToThread(thread_);
 
   VERIFY(connect(thread_, &QThread::started, this, &IDriver::Init));
   VERIFY(connect(thread_, &QThread::finished, this, &IDriver::Clear));
+  VERIFY(connect(this, &IDriver::WatchedKeyChanged, this, &IDriver::ReloadWatchedKeyIfChanged, Qt::QueuedConnection));
 }
 
 IDriver::~IDriver() {
@@ -130,10 +205,130 @@ common::Error IDriver::Execute(core::FastoObjectCommandIPtr cmd) {
   }
 
   LOG_COMMAND(cmd);
-  common::Error err = ExecuteImpl(cmd->GetInputCommand(), cmd.get());
+  command_invalidations_count_ = invalidations_count_;
+  const core::command_buffer_t& input = cmd->GetInputCommand();
+  const auto start = std::chrono::steady_clock::now();
+  common::Error err = ExecuteImpl(input, cmd.get());
+  const auto usec = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+  commands_latency_.Record(CommandsLatencyStats::GetCommandName(input.data(), input.size()), usec.count());
   return err;
 }
 
+common::Error IDriver::ExecuteBatchSilent(const std::vector<core::FastoObjectCommandIPtr>& cmds) {
+  command_invalidations_count_ = invalidations_count_;
+  for (const auto& cmd : cmds) {
+    common::Error err = ExecuteImpl(cmd->GetInputCommand(), cmd.get());
+    if (err) {
+      return err;
+    }
+  }
+
+  return common::Error();
+}
+
+common::Error IDriver::GetClusterOwnSlots(cluster_slot_ranges_t* slots) {
+  UNUSED(slots);
+  return common::make_error("Database doesn't support cluster slots.");
+}
+
+common::Error IDriver::GetValueSize(const core::NKey& key, uint64_t* size) {
+  UNUSED(key);
+  UNUSED(size);
+  return common::make_error("Database doesn't support range reads of values.");
+}
+
+common::Error IDriver::GetValueRange(const core::NKey& key, uint64_t offset, size_t size, std::string* out) {
+  UNUSED(key);
+  UNUSED(offset);
+  UNUSED(size);
+  UNUSED(out);
+  return common::make_error("Database doesn't support range reads of values.");
+}
+
+common::Error IDriver::GetValueLength(const core::NKey& key, common::Value::Type type, uint64_t* length) {
+  UNUSED(key);
+  UNUSED(type);
+  UNUSED(length);
+  return common::make_error("Database doesn't support paged reads of values.");
+}
+
+common::Error IDriver::GetValuePage(const core::NKey& key,
+                                    common::Value::Type type,
+                                    core::cursor_t cursor,
+                                    size_t count,
+                                    core::cursor_t* cursor_out,
+                                    std::vector<common::Value::string_t>* items) {
+  UNUSED(key);
+  UNUSED(type);
+  UNUSED(cursor);
+  UNUSED(count);
+  UNUSED(cursor_out);
+  UNUSED(items);
+  return common::make_error("Database doesn't support paged reads of values.");
+}
+
+common::Error IDriver::GetStreamRange(const core::NKey& key,
+                                      const core::StreamValue::stream_id& start,
+                                      const core::StreamValue::stream_id& end,
+                                      size_t count,
+                                      bool reverse,
+                                      std::vector<core::StreamValue::Stream>* streams) {
+  UNUSED(key);
+  UNUSED(start);
+  UNUSED(end);
+  UNUSED(count);
+  UNUSED(reverse);
+  UNUSED(streams);
+  return common::make_error("Database doesn't support streams.");
+}
+
+common::Error IDriver::GetStreamInfo(const core::NKey& key, StreamInfo* info) {
+  UNUSED(key);
+  UNUSED(info);
+  return common::make_error("Database doesn't support streams.");
+}
+
+bool IDriver::PrepareKeyWatchEvents(const core::NDbKValue& key) {
+  UNUSED(key);
+  return false;
+}
+
+common::Error IDriver::WatchKeyEvents(const core::NDbKValue& key) {
+  UNUSED(key);
+  return common::make_error("Database doesn't support keyspace notifications.");
+}
+
+void IDriver::InterruptKeyWatchEvents() {}
+
+common::Error IDriver::GetValueDigest(const core::NKey& key, std::string* digest) {
+  UNUSED(key);
+  UNUSED(digest);
+  return common::make_error("Database doesn't support digests of values.");
+}
+
+common::Error IDriver::CheckKeyEvents() {
+  return common::make_error("Database doesn't support keyspace notifications.");
+}
+
+common::Error IDriver::ListenKeyEvents(const core::db_name_t& db) {
+  UNUSED(db);
+  return common::make_error("Database doesn't support keyspace notifications.");
+}
+
+void IDriver::InterruptKeyEvents(const core::db_name_t& db) {
+  UNUSED(db);
+}
+
+common::Error IDriver::EnableValueTracking() {
+  return common::make_error("Database doesn't support client tracking.");
+}
+
+common::Error IDriver::ListenValueInvalidations() {
+  return common::make_error("Database doesn't support client tracking.");
+}
+
+void IDriver::InterruptValueInvalidations() {}
+
 void IDriver::Reply(QObject* reciver, QEvent* ev) {
   qApp->postEvent(reciver, ev);
 }
@@ -142,6 +337,10 @@ void IDriver::PrepareSettings() {
   settings_->PrepareInGuiIfNeeded();
 }
 
+IConnectionSettingsBaseSPtr IDriver::GetSettings() const {
+  return settings_;
+}
+
 core::ConnectionType IDriver::GetType() const {
   return settings_->GetType();
 }
@@ -189,6 +388,9 @@ void IDriver::Clear() {
     killTimer(timer_info_id_);
     timer_info_id_ = 0;
   }
+  StopKeyWatch();
+  StopKeyspaceSync();
+  StopValueTracking();
   common::Error err = SyncDisconnect();
   if (err) {
     DNOTREACHED();
@@ -196,6 +398,69 @@ void IDriver::Clear() {
   ClearImpl();
 }
 
+CommandsLatencyStats::snapshot_t IDriver::GetCommandsLatency() const {
+  return commands_latency_.GetSnapshot();
+}
+
+void IDriver::ResetCommandsLatency() {
+  commands_latency_.Reset();
+}
+
+void IDriver::RunKeyWatch(const core::NDbKValue& key, bool notifications, common::time64_t msec_interval) {
+  if (notifications) {
+    key_watch_err_ = WatchKeyEvents(key);
+  } else {
+    PollKey(key, msec_interval);
+  }
+}
+
+void IDriver::NotifyWatchedKeyChanged(const core::NDbKValue& key, bool check_digest) {
+  if (key_watch_stopped_ || key_watch_reload_pending_.exchange(true)) {
+    return;
+  }
+
+  emit WatchedKeyChanged(key, check_digest);
+}
+
+common::Error IDriver::ReloadWatchedKey(const core::NDbKValue& key) {
+  core::translator_t tran = GetTranslator();
+  core::command_buffer_t cmd_str;
+  common::Error err = tran->LoadKeyCommand(key.GetKey(), key.GetType(), &cmd_str);
+  if (err) {
+    return err;
+  }
+
+  // loaded value reaches views through OnLoadedKey
+  core::FastoObjectCommandIPtr cmd = CreateCommandFast(cmd_str, core::C_INNER);
+  return Execute(cmd);
+}
+
+void IDriver::RunKeyspaceSync(const core::db_name_t& db) {
+  common::Error err = ListenKeyEvents(db);
+  FlushKeyEvents(true);
+  emit KeyspaceSyncStopped(err);
+}
+
+void IDriver::AddKeyEvent(const std::string& event, const common::Value::string_t& key) {
+  {
+    std::unique_lock<std::mutex> lock(keyspace_sync_mutex_);
+    keyspace_sync_batcher_.AddEvent(event, key, common::time::current_utc_mstime());
+  }
+  invalidations_count_++;
+  FlushKeyEvents(false);
+}
+
+void IDriver::NotifyValuesInvalidated(const invalidated_keys_t& keys) {
+  invalidations_count_++;
+  emit ValuesInvalidated(keys);
+}
+
+void IDriver::RunValueTracking() {
+  common::Error err = ListenValueInvalidations();
+  UNUSED(err);  // cached values just fall back to expiry by age
+  emit ValueTrackingChanged(false);
+}
+
 core::IServerInfoSPtr IDriver::GetCurrentServerInfoIfConnected() const {
   if (IsConnected()) {
     return server_info_;
@@ -231,26 +496,62 @@ void IDriver::customEvent(QEvent* event) {
     HandleClearServerHistoryEvent(ev);  //
   } else if (type == static_cast<QEvent::Type>(events::ServerPropertyInfoRequestEvent::EventType)) {
     events::ServerPropertyInfoRequestEvent* ev = static_cast<events::ServerPropertyInfoRequestEvent*>(event);
-    HandleLoadServerPropertyEvent(ev);  // ni
+    HandleLoadServerPropertyEvent(ev);
   } else if (type == static_cast<QEvent::Type>(events::ChangeServerPropertyInfoRequestEvent::EventType)) {
     events::ChangeServerPropertyInfoRequestEvent* ev =
         static_cast<events::ChangeServerPropertyInfoRequestEvent*>(event);
-    HandleServerPropertyChangeEvent(ev);  // ni
+    HandleServerPropertyChangeEvent(ev);
   } else if (type == static_cast<QEvent::Type>(events::LoadServerChannelsRequestEvent::EventType)) {
     events::LoadServerChannelsRequestEvent* ev = static_cast<events::LoadServerChannelsRequestEvent*>(event);
-    HandleLoadServerChannelsRequestEvent(ev);  // ni
+    HandleLoadServerChannelsRequestEvent(ev);
   } else if (type == static_cast<QEvent::Type>(events::LoadServerClientsRequestEvent::EventType)) {
     events::LoadServerClientsRequestEvent* ev = static_cast<events::LoadServerClientsRequestEvent*>(event);
-    HandleLoadServerClientsRequestEvent(ev);  // ni
+    HandleLoadServerClientsRequestEvent(ev);
   } else if (type == static_cast<QEvent::Type>(events::BackupRequestEvent::EventType)) {
     events::BackupRequestEvent* ev = static_cast<events::BackupRequestEvent*>(event);
-    HandleBackupEvent(ev);  // ni
+    HandleBackupEvent(ev);
   } else if (type == static_cast<QEvent::Type>(events::RestoreRequestEvent::EventType)) {
     events::RestoreRequestEvent* ev = static_cast<events::RestoreRequestEvent*>(event);
-    HandleRestoreEvent(ev);  // ni
+    HandleRestoreEvent(ev);
   } else if (type == static_cast<QEvent::Type>(events::LoadDatabaseContentRequestEvent::EventType)) {
     events::LoadDatabaseContentRequestEvent* ev = static_cast<events::LoadDatabaseContentRequestEvent*>(event);
     HandleLoadDatabaseContentEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadKeysStatisticsRequestEvent::EventType)) {
+    events::LoadKeysStatisticsRequestEvent* ev = static_cast<events::LoadKeysStatisticsRequestEvent*>(event);
+    HandleLoadKeysStatisticsEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::SampleHotKeysRequestEvent::EventType)) {
+    events::SampleHotKeysRequestEvent* ev = static_cast<events::SampleHotKeysRequestEvent*>(event);
+    HandleSampleHotKeysEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::BenchmarkRequestEvent::EventType)) {
+    events::BenchmarkRequestEvent* ev = static_cast<events::BenchmarkRequestEvent*>(event);
+    HandleBenchmarkEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::ExecuteFileRequestEvent::EventType)) {
+    events::ExecuteFileRequestEvent* ev = static_cast<events::ExecuteFileRequestEvent*>(event);
+    HandleExecuteFileEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadValueRangeRequestEvent::EventType)) {
+    events::LoadValueRangeRequestEvent* ev = static_cast<events::LoadValueRangeRequestEvent*>(event);
+    HandleLoadValueRangeEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::SaveValueToFileRequestEvent::EventType)) {
+    events::SaveValueToFileRequestEvent* ev = static_cast<events::SaveValueToFileRequestEvent*>(event);
+    HandleSaveValueToFileEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadValuePageRequestEvent::EventType)) {
+    events::LoadValuePageRequestEvent* ev = static_cast<events::LoadValuePageRequestEvent*>(event);
+    HandleLoadValuePageEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::SaveValueChangesRequestEvent::EventType)) {
+    events::SaveValueChangesRequestEvent* ev = static_cast<events::SaveValueChangesRequestEvent*>(event);
+    HandleSaveValueChangesEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadStreamPageRequestEvent::EventType)) {
+    events::LoadStreamPageRequestEvent* ev = static_cast<events::LoadStreamPageRequestEvent*>(event);
+    HandleLoadStreamPageEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadStreamInfoRequestEvent::EventType)) {
+    events::LoadStreamInfoRequestEvent* ev = static_cast<events::LoadStreamInfoRequestEvent*>(event);
+    HandleLoadStreamInfoEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::WatchKeyRequestEvent::EventType)) {
+    events::WatchKeyRequestEvent* ev = static_cast<events::WatchKeyRequestEvent*>(event);
+    HandleWatchKeyEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::KeyspaceSyncRequestEvent::EventType)) {
+    events::KeyspaceSyncRequestEvent* ev = static_cast<events::KeyspaceSyncRequestEvent*>(event);
+    HandleKeyspaceSyncEvent(ev);
   } else if (type == static_cast<QEvent::Type>(events::DiscoveryInfoRequestEvent::EventType)) {
     events::DiscoveryInfoRequestEvent* ev = static_cast<events::DiscoveryInfoRequestEvent*>(event);
     HandleDiscoveryInfoEvent(ev);  //
@@ -260,6 +561,13 @@ void IDriver::customEvent(QEvent* event) {
 }
 
 void IDriver::timerEvent(QTimerEvent* event) {
+  if (keyspace_sync_timer_id_ == event->timerId()) {
+    // changes held by rate limit aren't left waiting for next event after burst
+    FlushKeyEvents(false);
+    QObject::timerEvent(event);
+    return;
+  }
+
   if (timer_info_id_ == event->timerId() && settings_->IsHistoryEnabled() && IsConnected()) {
     std::string path = settings_->GetLoggingPath();
     if (!log_file_) {
@@ -310,6 +618,8 @@ void IDriver::HandleConnectEvent(events::ConnectRequestEvent* ev) {
   common::Error err = SyncConnect();
   if (err) {
     res.setErrorInfo(err);
+  } else {
+    StartValueTracking();
   }
   NotifyProgress(sender, 75);
   Reply(sender, new events::ConnectResponseEvent(this, res));
@@ -322,6 +632,9 @@ void IDriver::HandleDisconnectEvent(events::DisconnectRequestEvent* ev) {
   events::DisconnectResponseEvent::value_type res(ev->value());
   NotifyProgress(sender, 50);
 
+  StopKeyWatch();
+  StopKeyspaceSync();
+  StopValueTracking();
   common::Error err = SyncDisconnect();
   if (err) {
     res.setErrorInfo(err);
@@ -396,6 +709,13 @@ void IDriver::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestE
   QObject* sender = ev->sender();
   NotifyProgress(sender, 0);
   events::LoadDatabaseContentResponseEvent::value_type res(ev->value());
+  if (!res.key_type.empty()) {  // unfiltered keys would be shown under type filter
+    res.setErrorInfo(common::make_error("Database doesn't support key type filter."));
+    Reply(sender, new events::LoadDatabaseContentResponseEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
   const core::command_buffer_t pattern_result = core::GetKeysPattern(res.cursor_in, res.pattern, res.keys_count);
   core::FastoObjectCommandIPtr cmd = CreateCommandFast(pattern_result, core::C_INNER);
   NotifyProgress(sender, 50);
@@ -460,6 +780,603 @@ void IDriver::HandleServerPropertyChangeEvent(events::ChangeServerPropertyInfoRe
       this, ev, "change server property");
 }
 
+void IDriver::HandleLoadKeysStatisticsEvent(events::LoadKeysStatisticsRequestEvent* ev) {
+  ReplyNotImplementedYet<events::LoadKeysStatisticsRequestEvent, events::LoadKeysStatisticsResponseEvent>(
+      this, ev, "load keys statistics");
+}
+
+void IDriver::HandleBenchmarkEvent(events::BenchmarkRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::BenchmarkResponseEvent::value_type res(ev->value());
+  BenchmarkGenerator generator(res.mix, res.keyspace_size, res.value_size, res.seed);
+  const size_t pipeline = std::max<size_t>(res.pipeline, 1);
+  const common::time64_t start_ts = common::time::current_utc_mstime();
+  int progress = 0;
+  for (size_t sent = 0; sent < res.requests_count;) {
+    if (IsInterrupted()) {
+      res.setErrorInfo(common::make_error(common::COMMON_EINTR));
+      break;
+    }
+
+    const size_t batch_size = std::min(pipeline, res.requests_count - sent);
+    std::vector<core::FastoObjectCommandIPtr> cmds;
+    cmds.reserve(batch_size);
+    for (size_t i = 0; i < batch_size; ++i) {
+      cmds.push_back(CreateCommandFast(generator.Next(), core::C_INNER));
+    }
+
+    // every command of batch waits for whole round trip, like redis-benchmark reports pipelined latency
+    const auto batch_start = std::chrono::steady_clock::now();
+    common::Error err = ExecuteBatchSilent(cmds);
+    const auto batch_usec =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - batch_start);
+    if (err) {
+      res.failed += batch_size;
+    } else {
+      res.executed += batch_size;
+      res.latency.Record(batch_usec.count(), batch_size);
+    }
+
+    sent += batch_size;
+    const int cur_progress = static_cast<int>(sent * 99 / res.requests_count);
+    if (cur_progress != progress) {
+      progress = cur_progress;
+      NotifyProgress(sender, progress);
+    }
+  }
+
+  res.elapsed_msec = common::time::current_utc_mstime() - start_ts;
+  Reply(sender, new events::BenchmarkResponseEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void IDriver::HandleExecuteFileEvent(events::ExecuteFileRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::ExecuteFileResponseEvent::value_type res(ev->value());
+  CommandFileReader reader(res.path, res.format);
+  common::Error err = reader.Open(res.offset);
+  cluster_slot_ranges_t own_slots;
+  if (!err && res.own_cluster_slots) {
+    err = GetClusterOwnSlots(&own_slots);
+  }
+  if (err) {
+    res.setErrorInfo(err);
+    Reply(sender, new events::ExecuteFileResponseEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  res.file_size = reader.GetSize();
+  const size_t pipeline = std::max<size_t>(res.pipeline, 1);
+  const size_t shard_count = std::max<size_t>(res.shard_count, 1);
+  const common::time64_t start_ts = common::time::current_utc_mstime();
+  int progress = 0;
+  bool finished = false;
+  while (!finished) {
+    if (IsInterrupted()) {
+      res.setErrorInfo(common::make_error(common::COMMON_EINTR));
+      break;
+    }
+
+    std::vector<core::FastoObjectCommandIPtr> cmds;
+    cmds.reserve(pipeline);
+    uint64_t first_line = 0;
+    uint64_t last_line = 0;
+    CommandFileRecord record;
+    while (cmds.size() < pipeline && !finished) {
+      if (!reader.Next(&record)) {
+        finished = true;
+        break;
+      }
+
+      // keyless commands go to owner of slot 0, crc16 of empty key; sharding by key keeps per key order
+      const uint16_t slot = GetClusterKeySlot(record.key);
+      const bool is_own = res.own_cluster_slots ? IsClusterSlotInRanges(slot, own_slots)
+                                                : slot % shard_count == res.shard_index;
+      if (!is_own) {
+        continue;
+      }
+
+      // sharded run can't keep order of keyless commands and connection state, unlike single connection
+      if (!record.error && shard_count > 1 && (record.key.empty() || IsConnectionStateCommand(record.name))) {
+        record.error = common::make_error("Command without key or with connection state needs one connection.");
+      }
+
+      // malformed records never reach database, so they are skipped even without keep going
+      if (record.error) {
+        res.failed++;
+        AddExecuteFileError(&res, MakeFileLinesError(record.line, record.line, record.error));
+        continue;
+      }
+
+      if (cmds.empty()) {
+        first_line = record.line;
+      }
+      last_line = record.line;
+      cmds.push_back(CreateCommandFast(record.command, core::C_USER));
+    }
+
+    if (!cmds.empty()) {
+      // batch is applied as whole or offset stays before it, so resume may repeat part of failed batch
+      err = ExecuteBatchSilent(cmds);
+      if (err) {
+        err = MakeFileLinesError(first_line, last_line, err);
+        if (!res.keep_going) {
+          res.setErrorInfo(err);
+          break;
+        }
+
+        res.failed += cmds.size();
+        AddExecuteFileError(&res, err);
+      } else {
+        res.executed += cmds.size();
+      }
+    }
+
+    res.offset_out = reader.GetOffset();
+    const int cur_progress = res.file_size ? static_cast<int>(res.offset_out * 99 / res.file_size) : 99;
+    if (cur_progress != progress) {
+      progress = cur_progress;
+      NotifyProgress(sender, progress);
+    }
+  }
+
+  res.elapsed_msec = common::time::current_utc_mstime() - start_ts;
+  Reply(sender, new events::ExecuteFileResponseEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void IDriver::HandleLoadValueRangeEvent(events::LoadValueRangeRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::LoadValueRangeResponseEvent::value_type res(ev->value());
+  common::Error err = GetValueSize(res.key, &res.value_size);
+  NotifyProgress(sender, 50);
+  if (!err && res.size && res.offset < res.value_size) {
+    const size_t size = static_cast<size_t>(std::min<uint64_t>(res.size, res.value_size - res.offset));
+    err = GetValueRange(res.key, res.offset, size, &res.data);
+  }
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::LoadValueRangeResponseEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void IDriver::HandleSaveValueToFileEvent(events::SaveValueToFileRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::SaveValueToFileResponseEvent::value_type res(ev->value());
+  common::Error err = GetValueSize(res.key, &res.value_size);
+  if (err) {
+    res.setErrorInfo(err);
+    Reply(sender, new events::SaveValueToFileResponseEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  common::file_system::ANSIFile file;
+  common::ErrnoError errn = file.Open(common::file_system::ascii_string_path(res.path), "wb");
+  if (errn) {
+    res.setErrorInfo(common::make_error_from_errno(errn));
+    Reply(sender, new events::SaveValueToFileResponseEvent(this, res));
+    NotifyProgress(sender, 100);
+    return;
+  }
+
+  // size is taken once, value changed while saving is reported instead of writing mixed parts silently
+  const size_t chunk_size = std::max<size_t>(res.chunk_size, 1);
+  int progress = 0;
+  while (res.written < res.value_size) {
+    if (IsInterrupted()) {
+      res.setErrorInfo(common::make_error(common::COMMON_EINTR));
+      break;
+    }
+
+    const size_t size = static_cast<size_t>(std::min<uint64_t>(chunk_size, res.value_size - res.written));
+    std::string chunk;
+    err = GetValueRange(res.key, res.written, size, &chunk);
+    if (err) {
+      res.setErrorInfo(err);
+      break;
+    }
+
+    if (chunk.size() != size) {
+      res.setErrorInfo(common::make_error("Value changed while saving"));
+      break;
+    }
+
+    if (!file.Write(chunk)) {
+      res.setErrorInfo(common::make_error("Can't write to file"));
+      break;
+    }
+
+    res.written += chunk.size();
+    const int cur_progress = static_cast<int>(res.written * 99 / res.value_size);
+    if (cur_progress != progress) {
+      progress = cur_progress;
+      NotifyProgress(sender, progress);
+    }
+  }
+  file.Close();
+  if (res.errorInfo()) {
+    // partial file is not a copy of value, stopped or failed save leaves nothing
+    common::file_system::remove_file(res.path);
+  }
+
+  Reply(sender, new events::SaveValueToFileResponseEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void IDriver::HandleLoadValuePageEvent(events::LoadValuePageRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::LoadValuePageResponseEvent::value_type res(ev->value());
+  common::Error err = GetValueLength(res.key, res.type, &res.total);
+  NotifyProgress(sender, 50);
+  if (!err && res.count) {
+    err = GetValuePage(res.key, res.type, res.cursor, res.count, &res.cursor_out, &res.items);
+  }
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::LoadValuePageResponseEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void IDriver::HandleSaveValueChangesEvent(events::SaveValueChangesRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::SaveValueChangesResponseEvent::value_type res(ev->value());
+  common::Error err = SaveValueChanges(res.commands, &res.stale);
+  NotifyProgress(sender, 50);
+  if (err) {
+    // part of changes may be applied, cached value is dropped instead of being replaced by edited one
+    res.setErrorInfo(err);
+    const auto raw_key = res.key.GetKey().GetKey().GetData();
+    NotifyValuesInvalidated(invalidated_keys_t(1, std::string(raw_key.begin(), raw_key.end())));
+  } else if (res.key.GetValue()) {
+    OnLoadedKey(res.key);
+  }
+
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::SaveValueChangesResponseEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+common::Error IDriver::SaveValueChanges(const ValueChangesCommands& commands, bool* stale) {
+  if (!commands.watch.empty()) {
+    common::Error err = Execute(CreateCommandFast(commands.watch, core::C_USER));
+    if (err) {
+      return err;
+    }
+
+    for (const ValueChangesCommands::check_t& check : commands.checks) {
+      core::FastoObjectCommandIPtr cmd = CreateCommandFast(check.first, core::C_USER);
+      err = Execute(cmd);
+      if (!err) {
+        common::ValueSPtr reply = GetReplyValue(cmd);
+        common::Value::string_t stored;
+        if (!reply || !reply->GetAsString(&stored) || stored != check.second) {
+          *stale = true;
+          err = common::make_error("Value changed since it was loaded, reload it.");
+        }
+      }
+
+      if (err) {
+        common::Error unwatch_err = Execute(CreateCommandFast(commands.unwatch, core::C_USER));
+        UNUSED(unwatch_err);  // watch also ends with next transaction on this connection
+        return err;
+      }
+    }
+  }
+
+  core::FastoObjectCommandIPtr exec;
+  for (const core::command_buffer_t& command : commands.transaction) {
+    exec = CreateCommandFast(command, core::C_USER);
+    common::Error err = Execute(exec);
+    if (err) {
+      return err;
+    }
+  }
+
+  if (!exec) {
+    return common::Error();
+  }
+
+  // nil reply of EXEC: watched key was touched, nothing applied; errors of queued commands don't abort others
+  common::ValueSPtr reply = GetReplyValue(exec);
+  if (!reply || reply->GetType() == common::Value::TYPE_NULL) {
+    *stale = true;
+    return common::make_error("Value changed since it was loaded, reload it.");
+  }
+
+  common::ArrayValue* replies = nullptr;
+  if (!reply->GetAsList(&replies)) {
+    return common::Error();
+  }
+
+  std::string failed;
+  for (size_t i = 0; i < replies->GetSize() && i + 1 < commands.transaction.size(); ++i) {
+    common::Value* command_reply = nullptr;
+    if (!replies->Get(i, &command_reply) || command_reply->GetType() != common::Value::TYPE_ERROR) {
+      continue;
+    }
+
+    // transaction starts with MULTI, reply i belongs to command i + 1
+    const core::command_buffer_t& command = commands.transaction[i + 1];
+    const auto description = core::ConvertValue(command_reply, core::NValue::default_delimiter);
+    failed += "\n" + std::string(command.begin(), command.end()) + ": " +
+              std::string(description.begin(), description.end());
+  }
+
+  if (!failed.empty()) {
+    *stale = true;
+    return common::make_error("Some changes failed:" + failed);
+  }
+
+  return common::Error();
+}
+
+void IDriver::HandleLoadStreamPageEvent(events::LoadStreamPageRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::LoadStreamPageResponseEvent::value_type res(ev->value());
+  NotifyProgress(sender, 50);
+  common::Error err = GetStreamRange(res.key, res.start, res.end, res.count, res.reverse, &res.streams);
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::LoadStreamPageResponseEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void IDriver::HandleLoadStreamInfoEvent(events::LoadStreamInfoRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::LoadStreamInfoResponseEvent::value_type res(ev->value());
+  NotifyProgress(sender, 50);
+  common::Error err = GetStreamInfo(res.key, &res.info);
+  if (err) {
+    res.setErrorInfo(err);
+  }
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::LoadStreamInfoResponseEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void IDriver::HandleWatchKeyEvent(events::WatchKeyRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  // one watch at a time, previous one is finished and replied
+  StopKeyWatch();
+  NotifyProgress(sender, 50);
+  if (ev->value().enable) {
+    StartKeyWatch(sender, ev->value());
+  } else {
+    events::WatchKeyResponseEvent::value_type res(ev->value());
+    Reply(sender, new events::WatchKeyResponseEvent(this, res));
+  }
+  NotifyProgress(sender, 100);
+}
+
+void IDriver::ReloadWatchedKeyIfChanged(core::NDbKValue key, bool check_digest) {
+  key_watch_reload_pending_ = false;
+  if (!key_watch_thread_) {  // request of stopped watch
+    return;
+  }
+
+  if (check_digest && key_watch_digest_supported_) {
+    std::string digest;
+    common::Error err = GetValueDigest(key.GetKey(), &digest);
+    if (err) {
+      key_watch_digest_supported_ = false;  // reload on every tick
+    } else if (digest == key_watch_digest_) {
+      return;
+    } else {
+      key_watch_digest_ = digest;
+    }
+  }
+
+  common::Error err = ReloadWatchedKey(key);
+  if (err) {
+    key_watch_res_->setErrorInfo(err);
+    StopKeyWatch();
+    return;
+  }
+
+  key_watch_res_->reloads_count++;
+}
+
+void IDriver::PollKey(const core::NDbKValue& key, common::time64_t msec_interval) {
+  while (!key_watch_stopped_) {
+    const common::time64_t start_ts = common::time::current_utc_mstime();
+    while (!key_watch_stopped_) {
+      const common::time64_t sleep_time = msec_interval - (common::time::current_utc_mstime() - start_ts);
+      if (sleep_time <= 0) {
+        break;
+      }
+      common::threads::PlatformThread::Sleep(std::min(sleep_time, kWatchSleepSliceMsec));
+    }
+
+    NotifyWatchedKeyChanged(key, true);
+  }
+}
+
+void IDriver::StartKeyWatch(QObject* sender, const events_info::WatchKeyRequest& req) {
+  DCHECK(!key_watch_thread_);
+  events_info::WatchKeyResponse* res = new events_info::WatchKeyResponse(req);
+  // notifications are treated as unavailable when server can't tell if they are published
+  res->notifications = PrepareKeyWatchEvents(res->key);
+  key_watch_digest_supported_ = !res->notifications;
+  if (key_watch_digest_supported_) {
+    common::Error err = GetValueDigest(res->key.GetKey(), &key_watch_digest_);
+    key_watch_digest_supported_ = !err;
+  }
+
+  common::Error err = ReloadWatchedKey(res->key);  // state before first change
+  if (err) {
+    res->setErrorInfo(err);
+    Reply(sender, new events::WatchKeyResponseEvent(this, *res));
+    delete res;
+    return;
+  }
+  res->reloads_count++;
+
+  key_watch_sender_ = sender;
+  key_watch_res_ = res;
+  key_watch_err_ = common::Error();
+  key_watch_stopped_ = false;
+  key_watch_reload_pending_ = false;
+  key_watch_thread_ = new QThread;
+  KeyWatchWorker* worker = new KeyWatchWorker(this, res->key, res->notifications, res->msec_interval);
+  worker->moveToThread(key_watch_thread_);
+  VERIFY(connect(key_watch_thread_, &QThread::started, worker, &KeyWatchWorker::Routine));
+  VERIFY(connect(worker, &KeyWatchWorker::Finished, key_watch_thread_, &QThread::quit));
+  VERIFY(connect(key_watch_thread_, &QThread::finished, worker, &KeyWatchWorker::deleteLater));
+  VERIFY(connect(key_watch_thread_, &QThread::finished, this, &IDriver::FinishKeyWatch));
+  key_watch_thread_->start();
+}
+
+void IDriver::FinishKeyWatch() {
+  // watch ended by itself, e.g. connection is lost; finished thread of previous watch is already joined
+  if (key_watch_thread_ && key_watch_thread_->isFinished()) {
+    StopKeyWatch();
+  }
+}
+
+void IDriver::StopKeyWatch() {
+  if (!key_watch_thread_) {
+    return;
+  }
+
+  key_watch_stopped_ = true;
+  if (!key_watch_thread_->isFinished()) {
+    InterruptKeyWatchEvents();
+  }
+  JoinListenerThread(key_watch_thread_);
+  delete key_watch_thread_;
+  key_watch_thread_ = nullptr;
+
+  // stop isn't reported as error
+  if (key_watch_err_ && !key_watch_res_->errorInfo()) {
+    key_watch_res_->setErrorInfo(key_watch_err_);
+  }
+  Reply(key_watch_sender_, new events::WatchKeyResponseEvent(this, *key_watch_res_));
+  delete key_watch_res_;
+  key_watch_res_ = nullptr;
+  key_watch_sender_ = nullptr;
+}
+
+void IDriver::HandleKeyspaceSyncEvent(events::KeyspaceSyncRequestEvent* ev) {
+  QObject* sender = ev->sender();
+  NotifyProgress(sender, 0);
+  events::KeyspaceSyncResponseEvent::value_type res(ev->value());
+  NotifyProgress(sender, 50);
+  StopKeyspaceSync();
+  if (res.enable) {
+    common::Error err = CheckKeyEvents();
+    if (err) {
+      res.setErrorInfo(err);
+    } else {
+      StartKeyspaceSync(res.inf->GetName());
+    }
+  }
+  NotifyProgress(sender, 75);
+  Reply(sender, new events::KeyspaceSyncResponseEvent(this, res));
+  NotifyProgress(sender, 100);
+}
+
+void IDriver::StartKeyspaceSync(const core::db_name_t& db) {
+  DCHECK(!keyspace_sync_thread_);
+  keyspace_sync_db_ = db;
+  keyspace_sync_thread_ = new QThread;
+  KeyspaceSyncWorker* worker = new KeyspaceSyncWorker(this, db);
+  worker->moveToThread(keyspace_sync_thread_);
+  VERIFY(connect(keyspace_sync_thread_, &QThread::started, worker, &KeyspaceSyncWorker::Routine));
+  VERIFY(connect(worker, &KeyspaceSyncWorker::Finished, keyspace_sync_thread_, &QThread::quit));
+  VERIFY(connect(keyspace_sync_thread_, &QThread::finished, worker, &KeyspaceSyncWorker::deleteLater));
+  keyspace_sync_thread_->start();
+  keyspace_sync_timer_id_ = startTimer(kKeyEventsWindowMsec);
+  DCHECK_NE(keyspace_sync_timer_id_, 0);
+}
+
+void IDriver::StopKeyspaceSync() {
+  if (!keyspace_sync_thread_) {
+    return;
+  }
+
+  // listener holds connection owned by driver, so it has to be over before next start or disconnect
+  killTimer(keyspace_sync_timer_id_);
+  keyspace_sync_timer_id_ = 0;
+  InterruptKeyEvents(keyspace_sync_db_);
+  JoinListenerThread(keyspace_sync_thread_);
+  delete keyspace_sync_thread_;
+  keyspace_sync_thread_ = nullptr;
+}
+
+void IDriver::FlushKeyEvents(bool force) {
+  // batches are taken and sent under lock, so they keep order between sync thread and driver thread
+  std::unique_lock<std::mutex> lock(keyspace_sync_mutex_);
+  const common::time64_t now = common::time::current_utc_mstime();
+  if (!force && !keyspace_sync_batcher_.IsFlushTime(now)) {
+    return;
+  }
+
+  const size_t dropped_count = keyspace_sync_batcher_.TakeDroppedCount();
+  const keyspace_changes_t changes = keyspace_sync_batcher_.TakeChanges(now);
+  if (!changes.empty() || dropped_count) {
+    emit KeysChanged(changes, dropped_count);
+  }
+}
+
+void IDriver::JoinListenerThread(QThread* thread) {
+  // listener was interrupted and woken up by message on its private channel, read returns after it
+  thread->wait();
+}
+
+void IDriver::StartValueTracking() {
+  DCHECK(!value_tracking_thread_);
+  if (!settings_->IsValueTrackingEnabled()) {
+    return;
+  }
+
+  common::Error err = EnableValueTracking();
+  if (err) {  // other databases and servers before client tracking, cached values expire by age
+    return;
+  }
+
+  value_tracking_thread_ = new QThread;
+  ValueTrackingWorker* worker = new ValueTrackingWorker(this);
+  worker->moveToThread(value_tracking_thread_);
+  VERIFY(connect(value_tracking_thread_, &QThread::started, worker, &ValueTrackingWorker::Routine));
+  VERIFY(connect(worker, &ValueTrackingWorker::Finished, value_tracking_thread_, &QThread::quit));
+  VERIFY(connect(value_tracking_thread_, &QThread::finished, worker, &ValueTrackingWorker::deleteLater));
+  emit ValueTrackingChanged(true);  // before loop may report its end
+  value_tracking_thread_->start();
+}
+
+void IDriver::StopValueTracking() {
+  if (!value_tracking_thread_) {
+    return;
+  }
+
+  InterruptValueInvalidations();
+  JoinListenerThread(value_tracking_thread_);
+  delete value_tracking_thread_;
+  value_tracking_thread_ = nullptr;
+}
+
+void IDriver::HandleSampleHotKeysEvent(events::SampleHotKeysRequestEvent* ev) {
+  ReplyNotImplementedYet<events::SampleHotKeysRequestEvent, events::SampleHotKeysResponseEvent>(this, ev,
+                                                                                                "sample hot keys");
+}
+
 void IDriver::HandleLoadServerChannelsRequestEvent(events::LoadServerChannelsRequestEvent* ev) {
   ReplyNotImplementedYet<events::LoadServerChannelsRequestEvent, events::LoadServerChannelsResponseEvent>(
       this, ev, "load server channels");
@@ -726,7 +1643,7 @@ void IDriver::OnLoadedKey(const core::NDbKValue& key) {
     return;
   }
 
-  emit KeyLoaded(key);
+  emit KeyLoaded(key, command_invalidations_count_ == invalidations_count_);
 }
 
 void IDriver::OnRenamedKey(const core::NKey& key, const core::nkey_t& new_key) {
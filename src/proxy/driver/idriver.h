@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -26,8 +28,12 @@
 #include <fastonosql/core/cdb_connection_client.h>
 #include <fastonosql/core/icommand_translator.h>
 
+#include "proxy/cluster_key_slot.h"
+#include "proxy/commands_latency_stats.h"
 #include "proxy/connection_settings/iconnection_settings.h"
 #include "proxy/events/events.h"
+#include "proxy/keyspace_changes.h"
+#include "proxy/value_cache.h"
 
 class QThread;
 namespace common {
@@ -52,6 +58,7 @@ class IDriver : public QObject, public core::CDBConnectionClient {
 
   // sync methods
   void PrepareSettings();
+  IConnectionSettingsBaseSPtr GetSettings() const;
   core::ConnectionType GetType() const;
   connection_path_t GetConnectionPath() const;
   std::string GetDelimiter() const;
@@ -73,6 +80,23 @@ class IDriver : public QObject, public core::CDBConnectionClient {
 
   core::IServerInfoSPtr GetCurrentServerInfoIfConnected() const;
 
+  // thread safe, latency in microseconds of commands passed through Execute
+  CommandsLatencyStats::snapshot_t GetCommandsLatency() const;
+  void ResetCommandsLatency();
+
+  // loop of key watch thread, returns when watch is stopped or its connection is lost
+  void RunKeyWatch(const core::NDbKValue& key, bool notifications, common::time64_t msec_interval);
+  // called on key watch thread, driver thread reloads key; requests are merged until it takes one
+  void NotifyWatchedKeyChanged(const core::NDbKValue& key, bool check_digest);
+  // loop of keyspace sync thread, returns when live sync is stopped
+  void RunKeyspaceSync(const core::db_name_t& db);
+  // called on keyspace sync thread for every keyevent notification, changes are passed on in batches
+  void AddKeyEvent(const std::string& event, const common::Value::string_t& key);
+  // called on value tracking thread, values loaded by commands issued before it aren't cacheable
+  void NotifyValuesInvalidated(const invalidated_keys_t& keys);
+  // loop of value tracking thread, returns when tracking is stopped or its connection is lost
+  void RunValueTracking();
+
  Q_SIGNALS:
   void ChildAdded(core::FastoObjectIPtr child);
   void ItemUpdated(core::FastoObject* item, common::ValueSPtr val);
@@ -86,14 +110,21 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   void KeyRemoved(core::NKey key);
   void KeyAdded(core::NDbKValue key);
   void KeyRenamed(core::NKey key, core::nkey_t new_name);
-  void KeyLoaded(core::NDbKValue key);
+  void KeyLoaded(core::NDbKValue key, bool cacheable);  // not cacheable if values were invalidated while loading
   void KeyTTLChanged(core::NKey key, core::ttl_t ttl);
   void KeyTTLLoaded(core::NKey key, core::ttl_t ttl);
+  void KeysChanged(keyspace_changes_t changes, size_t dropped_count);  // made by any client, from sync thread
+  void KeyspaceSyncStopped(common::Error err);
+  void ValuesInvalidated(invalidated_keys_t keys);  // changed by any client, from value tracking thread
+  void ValueTrackingChanged(bool enabled);
   void Disconnected();
+  void WatchedKeyChanged(core::NDbKValue key, bool check_digest);  // from key watch thread
 
  private Q_SLOTS:
   void Init();
   void Clear();
+  void ReloadWatchedKeyIfChanged(core::NDbKValue key, bool check_digest);
+  void FinishKeyWatch();
 
  protected:
   void customEvent(QEvent* event) override;
@@ -111,6 +142,18 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   virtual void HandleExecuteEvent(events::ExecuteRequestEvent* ev);
 
   virtual void HandleLoadDatabaseContentEvent(events::LoadDatabaseContentRequestEvent* ev);
+  virtual void HandleLoadKeysStatisticsEvent(events::LoadKeysStatisticsRequestEvent* ev);
+  virtual void HandleSampleHotKeysEvent(events::SampleHotKeysRequestEvent* ev);
+  virtual void HandleBenchmarkEvent(events::BenchmarkRequestEvent* ev);
+  virtual void HandleExecuteFileEvent(events::ExecuteFileRequestEvent* ev);
+  virtual void HandleLoadValueRangeEvent(events::LoadValueRangeRequestEvent* ev);
+  virtual void HandleSaveValueToFileEvent(events::SaveValueToFileRequestEvent* ev);
+  virtual void HandleLoadValuePageEvent(events::LoadValuePageRequestEvent* ev);
+  virtual void HandleSaveValueChangesEvent(events::SaveValueChangesRequestEvent* ev);
+  virtual void HandleLoadStreamPageEvent(events::LoadStreamPageRequestEvent* ev);
+  virtual void HandleLoadStreamInfoEvent(events::LoadStreamInfoRequestEvent* ev);
+  virtual void HandleWatchKeyEvent(events::WatchKeyRequestEvent* ev);
+  virtual void HandleKeyspaceSyncEvent(events::KeyspaceSyncRequestEvent* ev);
 
   virtual void HandleLoadServerPropertyEvent(events::ServerPropertyInfoRequestEvent* ev);
   virtual void HandleServerPropertyChangeEvent(events::ChangeServerPropertyInfoRequestEvent* ev);
@@ -127,6 +170,51 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   }
 
   common::Error Execute(core::FastoObjectCommandIPtr cmd) WARN_UNUSED_RESULT;
+  // without logging, in one round trip if database supports pipelining
+  virtual common::Error ExecuteBatchSilent(const std::vector<core::FastoObjectCommandIPtr>& cmds) WARN_UNUSED_RESULT;
+  // slots served by connected node, for databases with redis cluster like sharding
+  virtual common::Error GetClusterOwnSlots(cluster_slot_ranges_t* slots) WARN_UNUSED_RESULT;
+  // string values read by parts, for databases with STRLEN/GETRANGE like commands
+  virtual common::Error GetValueSize(const core::NKey& key, uint64_t* size) WARN_UNUSED_RESULT;
+  virtual common::Error GetValueRange(const core::NKey& key,
+                                      uint64_t offset,
+                                      size_t size,
+                                      std::string* out) WARN_UNUSED_RESULT;
+  // collection values read by pages, for databases with HSCAN/SSCAN/ZSCAN/LRANGE like commands
+  virtual common::Error GetValueLength(const core::NKey& key,
+                                       common::Value::Type type,
+                                       uint64_t* length) WARN_UNUSED_RESULT;
+  virtual common::Error GetValuePage(const core::NKey& key,
+                                     common::Value::Type type,
+                                     core::cursor_t cursor,
+                                     size_t count,
+                                     core::cursor_t* cursor_out,
+                                     std::vector<common::Value::string_t>* items) WARN_UNUSED_RESULT;
+  // stream entries read by id windows, for databases with XRANGE/XREVRANGE/XINFO like commands
+  virtual common::Error GetStreamRange(const core::NKey& key,
+                                       const core::StreamValue::stream_id& start,
+                                       const core::StreamValue::stream_id& end,
+                                       size_t count,
+                                       bool reverse,
+                                       std::vector<core::StreamValue::Stream>* streams) WARN_UNUSED_RESULT;
+  virtual common::Error GetStreamInfo(const core::NKey& key, StreamInfo* info) WARN_UNUSED_RESULT;
+  // key watch by keyspace notifications, for databases with redis like pub/sub: checked and prepared on driver thread,
+  // false falls back to polling; listening runs on key watch thread with own connection until interrupted
+  virtual bool PrepareKeyWatchEvents(const core::NDbKValue& key);
+  virtual common::Error WatchKeyEvents(const core::NDbKValue& key) WARN_UNUSED_RESULT;
+  virtual void InterruptKeyWatchEvents();
+  // cheap fingerprint of value, polling watch reloads key only when it changes
+  virtual common::Error GetValueDigest(const core::NKey& key, std::string* digest) WARN_UNUSED_RESULT;
+  // live sync of explorer by keyevent notifications, for databases with redis like pub/sub,
+  // listening runs on keyspace sync thread with own connection until interrupted from driver thread
+  virtual common::Error CheckKeyEvents() WARN_UNUSED_RESULT;
+  virtual common::Error ListenKeyEvents(const core::db_name_t& db) WARN_UNUSED_RESULT;
+  virtual void InterruptKeyEvents(const core::db_name_t& db);
+  // server-assisted invalidation of values read by driver connection, for databases with client tracking,
+  // invalidations are listened on value tracking thread with own connection until interrupted from driver thread
+  virtual common::Error EnableValueTracking() WARN_UNUSED_RESULT;
+  virtual common::Error ListenValueInvalidations() WARN_UNUSED_RESULT;
+  virtual void InterruptValueInvalidations();
   virtual core::FastoObjectCommandIPtr CreateCommand(core::FastoObject* parent,
                                                      const core::command_buffer_t& input,
                                                      core::CmdLoggingType ct) = 0;
@@ -146,6 +234,19 @@ class IDriver : public QObject, public core::CDBConnectionClient {
   void HandleLoadServerInfoHistoryEvent(events::ServerInfoHistoryRequestEvent* ev);
   void HandleClearServerHistoryEvent(events::ClearServerHistoryRequestEvent* ev);
 
+  common::Error ReloadWatchedKey(const core::NDbKValue& key) WARN_UNUSED_RESULT;
+  void PollKey(const core::NDbKValue& key, common::time64_t msec_interval);
+  void StartKeyWatch(QObject* sender, const events_info::WatchKeyRequest& req);
+  void StopKeyWatch();
+  void StartKeyspaceSync(const core::db_name_t& db);
+  void StopKeyspaceSync();
+  void FlushKeyEvents(bool force);
+  void JoinListenerThread(QThread* thread);  // interrupt of listener has to wake its blocked read up
+  void StartValueTracking();
+  void StopValueTracking();
+  // stale is set if value differs from stored rows changes were made against
+  common::Error SaveValueChanges(const ValueChangesCommands& commands, bool* stale) WARN_UNUSED_RESULT;
+
   virtual common::Error ExecuteImpl(const core::command_buffer_t& command,
                                     core::FastoObject* out) WARN_UNUSED_RESULT = 0;
   virtual common::Error DBkcountImpl(core::keys_limit_t* size) WARN_UNUSED_RESULT = 0;
@@ -176,10 +277,27 @@ class IDriver : public QObject, public core::CDBConnectionClient {
 
   const IConnectionSettingsBaseSPtr settings_;
   QThread* thread_;
+  QThread* key_watch_thread_;
+  QObject* key_watch_sender_;
+  events_info::WatchKeyResponse* key_watch_res_;
+  common::Error key_watch_err_;  // set by key watch thread, read after it is over
+  std::atomic<bool> key_watch_stopped_;
+  std::atomic<bool> key_watch_reload_pending_;
+  std::string key_watch_digest_;
+  bool key_watch_digest_supported_;
+  QThread* keyspace_sync_thread_;
+  core::db_name_t keyspace_sync_db_;
+  int keyspace_sync_timer_id_;
+  std::mutex keyspace_sync_mutex_;
+  KeyspaceChangesBatcher keyspace_sync_batcher_;
+  QThread* value_tracking_thread_;
+  std::atomic<uint64_t> invalidations_count_;  // bumped by listener threads on every invalidation
+  uint64_t command_invalidations_count_;        // invalidations_count_ when current command was issued
   int timer_info_id_;
   common::file_system::ANSIFile* log_file_;
 
   core::IServerInfoSPtr server_info_;
+  CommandsLatencyStats commands_latency_;
 };
 
 }  // namespace proxy
@@ -0,0 +1,77 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/driver/key_events_root_locker.h"
+
+#include <common/convert2string.h>
+
+#include "proxy/driver/idriver.h"
+
+namespace {
+const char kPatternMessageReplyKind[] = "pmessage";
+}
+
+namespace fastonosql {
+namespace proxy {
+
+KeyEventsRootLocker::KeyEventsRootLocker(IDriver* parent,
+                                         const std::string& channel_prefix,
+                                         const core::command_buffer_t& text)
+    : base_class(), parent_(parent), channel_prefix_(channel_prefix) {
+  CHECK(parent_);
+
+  root_ = core::FastoObject::CreateRoot(text, this);
+}
+
+core::FastoObjectIPtr KeyEventsRootLocker::Root() const {
+  return root_;
+}
+
+void KeyEventsRootLocker::ChildrenAdded(core::FastoObjectIPtr child) {
+  core::FastoObjectCommand* cmd = dynamic_cast<core::FastoObjectCommand*>(child.get());
+  if (cmd) {
+    return;
+  }
+
+  // pmessage reply: kind, pattern, channel, message
+  common::ArrayValue* reply = nullptr;
+  common::Value::string_t kind;
+  common::Value::string_t channel;
+  common::Value::string_t key;
+  auto value = child->GetValue();
+  if (!value || !value->GetAsList(&reply) || !reply->GetString(0, &kind) ||
+      common::ConvertToString(kind) != kPatternMessageReplyKind || !reply->GetString(2, &channel) ||
+      !reply->GetString(3, &key)) {
+    return;
+  }
+
+  const std::string channel_str = common::ConvertToString(channel);
+  if (channel_str.compare(0, channel_prefix_.size(), channel_prefix_) != 0) {
+    return;
+  }
+
+  parent_->AddKeyEvent(channel_str.substr(channel_prefix_.size()), key);
+}
+
+void KeyEventsRootLocker::Updated(core::FastoObject* item, core::FastoObject::value_t val) {
+  UNUSED(item);
+  UNUSED(val);
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,41 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/driver/key_watch_worker.h"
+
+#include "proxy/driver/idriver.h"
+
+namespace fastonosql {
+namespace proxy {
+
+KeyWatchWorker::KeyWatchWorker(IDriver* drv,
+                               const core::NDbKValue& key,
+                               bool notifications,
+                               common::time64_t msec_interval,
+                               QObject* parent)
+    : QObject(parent), drv_(drv), key_(key), notifications_(notifications), msec_interval_(msec_interval) {
+  CHECK(drv_);
+}
+
+void KeyWatchWorker::Routine() {
+  drv_->RunKeyWatch(key_, notifications_, msec_interval_);
+  emit Finished();
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,56 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QObject>
+
+#include <common/types.h>
+
+#include <fastonosql/core/db_key.h>
+
+namespace fastonosql {
+namespace proxy {
+class IDriver;
+
+// runs blocking key watch loop of driver on key watch thread
+class KeyWatchWorker : public QObject {
+  Q_OBJECT
+
+ public:
+  KeyWatchWorker(IDriver* drv,
+                 const core::NDbKValue& key,
+                 bool notifications,
+                 common::time64_t msec_interval,
+                 QObject* parent = Q_NULLPTR);
+
+ Q_SIGNALS:
+  void Finished();
+
+ public Q_SLOTS:
+  void Routine();
+
+ private:
+  IDriver* const drv_;
+  const core::NDbKValue key_;
+  const bool notifications_;
+  const common::time64_t msec_interval_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
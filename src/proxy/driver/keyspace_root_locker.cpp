@@ -0,0 +1,75 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/driver/keyspace_root_locker.h"
+
+#include <string>
+
+#include <common/convert2string.h>
+
+#include "proxy/driver/idriver.h"
+
+namespace {
+const char kMessageReplyKind[] = "message";  // subscribe/unsubscribe confirmations aren't events
+}
+
+namespace fastonosql {
+namespace proxy {
+
+KeyspaceRootLocker::KeyspaceRootLocker(IDriver* parent,
+                                       const core::NDbKValue& key,
+                                       const std::string& channel,
+                                       const core::command_buffer_t& text)
+    : base_class(), parent_(parent), key_(key), channel_(channel) {
+  CHECK(parent_);
+
+  root_ = core::FastoObject::CreateRoot(text, this);
+}
+
+core::FastoObjectIPtr KeyspaceRootLocker::Root() const {
+  return root_;
+}
+
+void KeyspaceRootLocker::ChildrenAdded(core::FastoObjectIPtr child) {
+  core::FastoObjectCommand* cmd = dynamic_cast<core::FastoObjectCommand*>(child.get());
+  if (cmd) {
+    return;
+  }
+
+  // message reply: kind, channel, event
+  common::ArrayValue* reply = nullptr;
+  common::Value::string_t kind;
+  common::Value::string_t channel;
+  auto value = child->GetValue();
+  if (!value || !value->GetAsList(&reply) || !reply->GetString(0, &kind) ||
+      common::ConvertToString(kind) != kMessageReplyKind || !reply->GetString(1, &channel) ||
+      common::ConvertToString(channel) != channel_) {
+    return;
+  }
+
+  // runs on key watch thread, value is reloaded by driver thread
+  parent_->NotifyWatchedKeyChanged(key_, false);
+}
+
+void KeyspaceRootLocker::Updated(core::FastoObject* item, core::FastoObject::value_t val) {
+  UNUSED(item);
+  UNUSED(val);
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,48 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <QObject>
+
+#include <fastonosql/core/database/idatabase_info.h>
+
+namespace fastonosql {
+namespace proxy {
+class IDriver;
+
+// runs blocking keyevent notifications loop of driver on keyspace sync thread
+class KeyspaceSyncWorker : public QObject {
+  Q_OBJECT
+
+ public:
+  KeyspaceSyncWorker(IDriver* drv, const core::db_name_t& db, QObject* parent = Q_NULLPTR);
+
+ Q_SIGNALS:
+  void Finished();
+
+ public Q_SLOTS:
+  void Routine();
+
+ private:
+  IDriver* const drv_;
+  const core::db_name_t db_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,74 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/driver/monitor_root_locker.h"
+
+#include <common/convert2string.h>
+#include <common/time.h>
+
+#include "proxy/driver/idriver.h"
+#include "proxy/hot_keys_sampler.h"
+
+namespace fastonosql {
+namespace proxy {
+
+MonitorRootLocker::MonitorRootLocker(IDriver* parent,
+                                     HotKeysSampler* sampler,
+                                     const core::command_buffer_t& text,
+                                     common::time64_t duration_msec)
+    : base_class(),
+      parent_(parent),
+      sampler_(sampler),
+      tstart_(common::time::current_utc_mstime()),
+      duration_msec_(duration_msec) {
+  CHECK(parent_);
+  CHECK(sampler_);
+
+  root_ = core::FastoObject::CreateRoot(text, this);
+}
+
+core::FastoObjectIPtr MonitorRootLocker::Root() const {
+  return root_;
+}
+
+common::time64_t MonitorRootLocker::GetElapsedTime() const {
+  return common::time::current_utc_mstime() - tstart_;
+}
+
+void MonitorRootLocker::ChildrenAdded(core::FastoObjectIPtr child) {
+  core::FastoObjectCommand* cmd = dynamic_cast<core::FastoObjectCommand*>(child.get());
+  if (!cmd) {
+    sampler_->AddMonitorLine(common::ConvertToString(child->ToString()));  // OK reply isn't parsed
+  }
+  CheckWindow();
+}
+
+void MonitorRootLocker::Updated(core::FastoObject* item, core::FastoObject::value_t val) {
+  UNUSED(item);
+  UNUSED(val);
+  CheckWindow();
+}
+
+void MonitorRootLocker::CheckWindow() {
+  if (GetElapsedTime() >= duration_msec_) {
+    parent_->SetInterrupted(true);  // only ends MONITOR, Interrupt is user stop of everything driver runs
+  }
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,87 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "proxy/driver/value_tracking_root_locker.h"
+
+#include <common/convert2string.h>
+
+#include "proxy/driver/idriver.h"
+#include "proxy/value_cache.h"
+
+namespace {
+const char kMessageReplyKind[] = "message";
+}  // namespace
+
+namespace fastonosql {
+namespace proxy {
+
+ValueTrackingRootLocker::ValueTrackingRootLocker(IDriver* parent,
+                                                 const std::string& channel,
+                                                 const core::command_buffer_t& text)
+    : base_class(), parent_(parent), channel_(channel) {
+  CHECK(parent_);
+
+  root_ = core::FastoObject::CreateRoot(text, this);
+}
+
+core::FastoObjectIPtr ValueTrackingRootLocker::Root() const {
+  return root_;
+}
+
+void ValueTrackingRootLocker::ChildrenAdded(core::FastoObjectIPtr child) {
+  core::FastoObjectCommand* cmd = dynamic_cast<core::FastoObjectCommand*>(child.get());
+  if (cmd) {
+    return;
+  }
+
+  // message reply: kind, channel, invalidated keys (nil after FLUSHDB or FLUSHALL)
+  common::ArrayValue* reply = nullptr;
+  common::Value::string_t kind;
+  common::Value::string_t channel;
+  auto value = child->GetValue();
+  if (!value || !value->GetAsList(&reply) || reply->GetSize() != 3 || !reply->GetString(0, &kind) ||
+      common::ConvertToString(kind) != kMessageReplyKind || !reply->GetString(1, &channel) ||
+      common::ConvertToString(channel) != channel_) {
+    return;  // subscribe confirmations and wake up message
+  }
+
+  invalidated_keys_t keys;
+  common::ArrayValue* keys_array = nullptr;
+  if (reply->GetList(2, &keys_array)) {
+    for (size_t i = 0; i < keys_array->GetSize(); ++i) {
+      common::Value::string_t key;
+      if (keys_array->GetString(i, &key)) {
+        keys.push_back(std::string(key.begin(), key.end()));
+      }
+    }
+    if (keys.empty()) {
+      return;
+    }
+  }
+
+  parent_->NotifyValuesInvalidated(keys);
+}
+
+void ValueTrackingRootLocker::Updated(core::FastoObject* item, core::FastoObject::value_t val) {
+  UNUSED(item);
+  UNUSED(val);
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
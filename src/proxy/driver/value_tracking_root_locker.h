@@ -0,0 +1,50 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <string>
+
+#include <fastonosql/core/global.h>
+
+namespace fastonosql {
+namespace proxy {
+class IDriver;
+
+// passes client tracking invalidation messages delivered to redirect connection root to driver
+class ValueTrackingRootLocker : public core::FastoObject::IFastoObjectObserver {
+ public:
+  typedef core::FastoObject::IFastoObjectObserver base_class;
+
+  ValueTrackingRootLocker(IDriver* parent, const std::string& channel, const core::command_buffer_t& text);
+
+  core::FastoObjectIPtr Root() const;
+
+ protected:
+  void ChildrenAdded(core::FastoObjectIPtr child) override;
+  void Updated(core::FastoObject* item, core::FastoObject::value_t val) override;
+
+ private:
+  core::FastoObjectIPtr root_;
+  IDriver* parent_;
+  const std::string channel_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
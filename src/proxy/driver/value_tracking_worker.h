@@ -0,0 +1,46 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <QObject>
+
+namespace fastonosql {
+namespace proxy {
+class IDriver;
+
+// runs blocking client tracking invalidations loop of driver on value tracking thread
+class ValueTrackingWorker : public QObject {
+  Q_OBJECT
+
+ public:
+  explicit ValueTrackingWorker(IDriver* drv, QObject* parent = Q_NULLPTR);
+
+ Q_SIGNALS:
+  void Finished();
+
+ public Q_SLOTS:
+  void Routine();
+
+ private:
+  IDriver* const drv_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
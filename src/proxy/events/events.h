@@ -77,6 +77,42 @@ typedef common::qt::Event<events_info::LoadDatabaseContentResponse, QEvent::User
 typedef common::qt::Event<events_info::DiscoveryInfoRequest, QEvent::User + 33> DiscoveryInfoRequestEvent;
 typedef common::qt::Event<events_info::DiscoveryInfoResponse, QEvent::User + 34> DiscoveryInfoResponseEvent;
 
+typedef common::qt::Event<events_info::LoadKeysStatisticsRequest, QEvent::User + 35> LoadKeysStatisticsRequestEvent;
+typedef common::qt::Event<events_info::LoadKeysStatisticsResponse, QEvent::User + 36> LoadKeysStatisticsResponseEvent;
+
+typedef common::qt::Event<events_info::SampleHotKeysRequest, QEvent::User + 37> SampleHotKeysRequestEvent;
+typedef common::qt::Event<events_info::SampleHotKeysResponse, QEvent::User + 38> SampleHotKeysResponseEvent;
+
+typedef common::qt::Event<events_info::BenchmarkRequest, QEvent::User + 39> BenchmarkRequestEvent;
+typedef common::qt::Event<events_info::BenchmarkResponse, QEvent::User + 40> BenchmarkResponseEvent;
+
+typedef common::qt::Event<events_info::ExecuteFileRequest, QEvent::User + 41> ExecuteFileRequestEvent;
+typedef common::qt::Event<events_info::ExecuteFileResponse, QEvent::User + 42> ExecuteFileResponseEvent;
+
+typedef common::qt::Event<events_info::LoadValueRangeRequest, QEvent::User + 43> LoadValueRangeRequestEvent;
+typedef common::qt::Event<events_info::LoadValueRangeResponse, QEvent::User + 44> LoadValueRangeResponseEvent;
+
+typedef common::qt::Event<events_info::SaveValueToFileRequest, QEvent::User + 45> SaveValueToFileRequestEvent;
+typedef common::qt::Event<events_info::SaveValueToFileResponse, QEvent::User + 46> SaveValueToFileResponseEvent;
+
+typedef common::qt::Event<events_info::LoadValuePageRequest, QEvent::User + 47> LoadValuePageRequestEvent;
+typedef common::qt::Event<events_info::LoadValuePageResponse, QEvent::User + 48> LoadValuePageResponseEvent;
+
+typedef common::qt::Event<events_info::SaveValueChangesRequest, QEvent::User + 49> SaveValueChangesRequestEvent;
+typedef common::qt::Event<events_info::SaveValueChangesResponse, QEvent::User + 50> SaveValueChangesResponseEvent;
+
+typedef common::qt::Event<events_info::LoadStreamPageRequest, QEvent::User + 51> LoadStreamPageRequestEvent;
+typedef common::qt::Event<events_info::LoadStreamPageResponse, QEvent::User + 52> LoadStreamPageResponseEvent;
+
+typedef common::qt::Event<events_info::LoadStreamInfoRequest, QEvent::User + 53> LoadStreamInfoRequestEvent;
+typedef common::qt::Event<events_info::LoadStreamInfoResponse, QEvent::User + 54> LoadStreamInfoResponseEvent;
+
+typedef common::qt::Event<events_info::WatchKeyRequest, QEvent::User + 55> WatchKeyRequestEvent;
+typedef common::qt::Event<events_info::WatchKeyResponse, QEvent::User + 56> WatchKeyResponseEvent;
+
+typedef common::qt::Event<events_info::KeyspaceSyncRequest, QEvent::User + 57> KeyspaceSyncRequestEvent;
+typedef common::qt::Event<events_info::KeyspaceSyncResponse, QEvent::User + 58> KeyspaceSyncResponseEvent;
+
 typedef common::qt::Event<events_info::ProgressInfoResponse, QEvent::User + 100> ProgressResponseEvent;
 
 }  // namespace events
@@ -101,12 +101,195 @@ LoadDatabaseContentRequest::LoadDatabaseContentRequest(initiator_type sender,
                                                        const core::pattern_t& pattern,
                                                        core::keys_limit_t keys_count,
                                                        core::cursor_t cursor,
+                                                       const std::string& key_type,
                                                        error_type er)
-    : base_class(sender, er), inf(inf), pattern(pattern), keys_count(keys_count), cursor_in(cursor) {}
+    : base_class(sender, er),
+      inf(inf),
+      pattern(pattern),
+      keys_count(keys_count),
+      cursor_in(cursor),
+      key_type(key_type) {}
 
 LoadDatabaseContentResponse::LoadDatabaseContentResponse(const base_class& request)
     : base_class(request), keys(), cursor_out(0), db_keys_count(0) {}
 
+LoadKeysStatisticsRequest::LoadKeysStatisticsRequest(initiator_type sender,
+                                                     core::IDataBaseInfoSPtr inf,
+                                                     const core::pattern_t& pattern,
+                                                     core::keys_limit_t keys_count,
+                                                     core::cursor_t cursor,
+                                                     error_type er)
+    : base_class(sender, er), inf(inf), pattern(pattern), keys_count(keys_count), cursor_in(cursor) {}
+
+LoadKeysStatisticsResponse::LoadKeysStatisticsResponse(const base_class& request)
+    : base_class(request), keys(), cursor_out(0), db_keys_count(0) {}
+
+SampleHotKeysRequest::SampleHotKeysRequest(initiator_type sender,
+                                           proxy::HotKeysSamplingMode mode,
+                                           common::time64_t duration_msec,
+                                           int sample_rate,
+                                           size_t top_k,
+                                           core::keys_limit_t keys_count,
+                                           core::cursor_t cursor,
+                                           error_type er)
+    : base_class(sender, er),
+      mode(mode),
+      duration_msec(duration_msec),
+      sample_rate(sample_rate),
+      top_k(top_k),
+      keys_count(keys_count),
+      cursor_in(cursor) {}
+
+SampleHotKeysResponse::SampleHotKeysResponse(const base_class& request)
+    : base_class(request),
+      used_mode(request.mode),
+      elapsed_msec(0),
+      seen_count(0),
+      sampled_count(0),
+      commands(),
+      keys(),
+      namespaces(),
+      cursor_out(0),
+      db_keys_count(0) {}
+
+BenchmarkRequest::BenchmarkRequest(initiator_type sender,
+                                   const proxy::benchmark_mix_t& mix,
+                                   size_t requests_count,
+                                   size_t pipeline,
+                                   size_t keyspace_size,
+                                   size_t value_size,
+                                   uint32_t seed,
+                                   error_type er)
+    : base_class(sender, er),
+      mix(mix),
+      requests_count(requests_count),
+      pipeline(pipeline),
+      keyspace_size(keyspace_size),
+      value_size(value_size),
+      seed(seed) {}
+
+BenchmarkResponse::BenchmarkResponse(const base_class& request)
+    : base_class(request), latency(), executed(0), failed(0), elapsed_msec(0) {}
+
+ExecuteFileRequest::ExecuteFileRequest(initiator_type sender,
+                                       const std::string& path,
+                                       uint64_t offset,
+                                       size_t pipeline,
+                                       CommandFileFormat format,
+                                       bool keep_going,
+                                       size_t shard_index,
+                                       size_t shard_count,
+                                       bool own_cluster_slots,
+                                       error_type er)
+    : base_class(sender, er),
+      path(path),
+      offset(offset),
+      pipeline(pipeline),
+      format(format),
+      keep_going(keep_going),
+      shard_index(shard_index),
+      shard_count(shard_count),
+      own_cluster_slots(own_cluster_slots) {}
+
+ExecuteFileResponse::ExecuteFileResponse(const base_class& request)
+    : base_class(request),
+      offset_out(request.offset),
+      file_size(0),
+      executed(0),
+      failed(0),
+      errors(),
+      elapsed_msec(0) {}
+
+LoadValueRangeRequest::LoadValueRangeRequest(initiator_type sender,
+                                             core::IDataBaseInfoSPtr inf,
+                                             const core::NKey& key,
+                                             uint64_t offset,
+                                             size_t size,
+                                             error_type er)
+    : base_class(sender, er), inf(inf), key(key), offset(offset), size(size) {}
+
+LoadValueRangeResponse::LoadValueRangeResponse(const base_class& request)
+    : base_class(request), value_size(0), data() {}
+
+SaveValueToFileRequest::SaveValueToFileRequest(initiator_type sender,
+                                               core::IDataBaseInfoSPtr inf,
+                                               const core::NKey& key,
+                                               const std::string& path,
+                                               size_t chunk_size,
+                                               error_type er)
+    : base_class(sender, er), inf(inf), key(key), path(path), chunk_size(chunk_size) {}
+
+SaveValueToFileResponse::SaveValueToFileResponse(const base_class& request)
+    : base_class(request), value_size(0), written(0) {}
+
+LoadValuePageRequest::LoadValuePageRequest(initiator_type sender,
+                                           core::IDataBaseInfoSPtr inf,
+                                           const core::NKey& key,
+                                           common::Value::Type type,
+                                           core::cursor_t cursor,
+                                           size_t count,
+                                           error_type er)
+    : base_class(sender, er), inf(inf), key(key), type(type), cursor(cursor), count(count) {}
+
+LoadValuePageResponse::LoadValuePageResponse(const base_class& request)
+    : base_class(request), cursor_out(0), total(0), items() {}
+
+SaveValueChangesRequest::SaveValueChangesRequest(initiator_type sender,
+                                                 core::IDataBaseInfoSPtr inf,
+                                                 const core::NDbKValue& key,
+                                                 const ValueChangesCommands& commands,
+                                                 error_type er)
+    : base_class(sender, er), inf(inf), key(key), commands(commands) {}
+
+SaveValueChangesResponse::SaveValueChangesResponse(const base_class& request) : base_class(request), stale(false) {}
+
+LoadStreamPageRequest::LoadStreamPageRequest(initiator_type sender,
+                                             core::IDataBaseInfoSPtr inf,
+                                             const core::NKey& key,
+                                             const core::StreamValue::stream_id& start,
+                                             const core::StreamValue::stream_id& end,
+                                             size_t count,
+                                             bool reverse,
+                                             bool from_shown,
+                                             error_type er)
+    : base_class(sender, er),
+      inf(inf),
+      key(key),
+      start(start),
+      end(end),
+      count(count),
+      reverse(reverse),
+      from_shown(from_shown) {}
+
+LoadStreamPageResponse::LoadStreamPageResponse(const base_class& request) : base_class(request), streams() {}
+
+LoadStreamInfoRequest::LoadStreamInfoRequest(initiator_type sender,
+                                             core::IDataBaseInfoSPtr inf,
+                                             const core::NKey& key,
+                                             error_type er)
+    : base_class(sender, er), inf(inf), key(key) {}
+
+LoadStreamInfoResponse::LoadStreamInfoResponse(const base_class& request) : base_class(request), info() {}
+
+WatchKeyRequest::WatchKeyRequest(initiator_type sender,
+                                 core::IDataBaseInfoSPtr inf,
+                                 const core::NDbKValue& key,
+                                 common::time64_t msec_interval,
+                                 bool enable,
+                                 error_type er)
+    : base_class(sender, er), inf(inf), key(key), msec_interval(msec_interval), enable(enable) {}
+
+WatchKeyResponse::WatchKeyResponse(const base_class& request)
+    : base_class(request), notifications(false), reloads_count(0) {}
+
+KeyspaceSyncRequest::KeyspaceSyncRequest(initiator_type sender,
+                                         core::IDataBaseInfoSPtr inf,
+                                         bool enable,
+                                         error_type er)
+    : base_class(sender, er), inf(inf), enable(enable) {}
+
+KeyspaceSyncResponse::KeyspaceSyncResponse(const base_class& request) : base_class(request) {}
+
 LoadServerChannelsRequest::LoadServerChannelsRequest(initiator_type sender, const std::string& pattern, error_type er)
     : base_class(sender, er), pattern(pattern) {}
 
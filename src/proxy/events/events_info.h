@@ -35,8 +35,14 @@
 
 #include <fastonosql/core/global.h>
 
+#include "proxy/benchmark_generator.h"
 #include "proxy/db_client.h"
+#include "proxy/db_key_stat.h"
 #include "proxy/db_ps_channel.h"
+#include "proxy/hot_keys_sampler.h"
+#include "proxy/stream_info.h"
+#include "proxy/types.h"
+#include "proxy/value_histogram.h"
 
 namespace fastonosql {
 namespace proxy {
@@ -188,12 +194,14 @@ struct LoadDatabaseContentRequest : public EventInfoBase {
                              const core::pattern_t& pattern,
                              core::keys_limit_t keys_count,
                              core::cursor_t cursor = 0,
+                             const std::string& key_type = std::string(),
                              error_type er = error_type());
 
   core::IDataBaseInfoSPtr inf;
   const core::pattern_t pattern;
   const core::keys_limit_t keys_count;  // requested
   const core::cursor_t cursor_in;
+  const std::string key_type;  // server side type filter, empty for all types
 };
 
 struct LoadDatabaseContentResponse : LoadDatabaseContentRequest {
@@ -206,6 +214,309 @@ struct LoadDatabaseContentResponse : LoadDatabaseContentRequest {
   core::keys_limit_t db_keys_count;  // total keys count
 };
 
+struct LoadKeysStatisticsRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  LoadKeysStatisticsRequest(initiator_type sender,
+                            core::IDataBaseInfoSPtr inf,
+                            const core::pattern_t& pattern,
+                            core::keys_limit_t keys_count,
+                            core::cursor_t cursor = 0,
+                            error_type er = error_type());
+
+  core::IDataBaseInfoSPtr inf;
+  const core::pattern_t pattern;
+  const core::keys_limit_t keys_count;  // SCAN COUNT hint
+  const core::cursor_t cursor_in;
+};
+
+struct LoadKeysStatisticsResponse : LoadKeysStatisticsRequest {
+  typedef LoadKeysStatisticsRequest base_class;
+  typedef std::vector<proxy::NDbKeyStat> keys_container_t;
+  explicit LoadKeysStatisticsResponse(const base_class& request);
+
+  keys_container_t keys;
+  core::cursor_t cursor_out;
+  core::keys_limit_t db_keys_count;  // total keys count
+};
+
+struct SampleHotKeysRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  SampleHotKeysRequest(initiator_type sender,
+                       proxy::HotKeysSamplingMode mode,
+                       common::time64_t duration_msec,
+                       int sample_rate,
+                       size_t top_k,
+                       core::keys_limit_t keys_count,
+                       core::cursor_t cursor = 0,
+                       error_type er = error_type());
+
+  const proxy::HotKeysSamplingMode mode;
+  const common::time64_t duration_msec;  // MONITOR window
+  const int sample_rate;                 // percent of MONITOR commands to count
+  const size_t top_k;
+  const core::keys_limit_t keys_count;  // SCAN COUNT hint for OBJECT FREQ
+  const core::cursor_t cursor_in;
+};
+
+struct SampleHotKeysResponse : SampleHotKeysRequest {
+  typedef SampleHotKeysRequest base_class;
+  typedef proxy::HotKeysSampler::items_t items_t;
+  explicit SampleHotKeysResponse(const base_class& request);
+
+  proxy::HotKeysSamplingMode used_mode;
+  common::time64_t elapsed_msec;
+  proxy::HotKeysSampler::count_t seen_count;
+  proxy::HotKeysSampler::count_t sampled_count;
+  items_t commands;  // counts are sampled, not scaled by sample rate
+  items_t keys;
+  items_t namespaces;
+  core::cursor_t cursor_out;
+  core::keys_limit_t db_keys_count;
+};
+
+struct BenchmarkRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  BenchmarkRequest(initiator_type sender,
+                   const proxy::benchmark_mix_t& mix,
+                   size_t requests_count,
+                   size_t pipeline,
+                   size_t keyspace_size,
+                   size_t value_size,
+                   uint32_t seed,
+                   error_type er = error_type());
+
+  const proxy::benchmark_mix_t mix;
+  const size_t requests_count;
+  const size_t pipeline;  // commands per round trip
+  const size_t keyspace_size;
+  const size_t value_size;
+  const uint32_t seed;
+};
+
+struct BenchmarkResponse : BenchmarkRequest {
+  typedef BenchmarkRequest base_class;
+  explicit BenchmarkResponse(const base_class& request);
+
+  proxy::ValueHistogram latency;  // microseconds of every executed command
+  size_t executed;
+  size_t failed;
+  common::time64_t elapsed_msec;
+};
+
+struct ExecuteFileRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  ExecuteFileRequest(initiator_type sender,
+                     const std::string& path,
+                     uint64_t offset,
+                     size_t pipeline,
+                     CommandFileFormat format = kCommandFileCommands,
+                     bool keep_going = false,
+                     size_t shard_index = 0,
+                     size_t shard_count = 1,
+                     bool own_cluster_slots = false,
+                     error_type er = error_type());
+
+  const std::string path;
+  const uint64_t offset;  // resume point, start of not executed line
+  const size_t pipeline;  // commands per round trip
+  const CommandFileFormat format;
+  const bool keep_going;  // failed batches are counted and skipped, otherwise execution stops
+  // mass insert over several connections: record is executed by shard key_slot % shard_count, so commands
+  // of one key keep file order, with own_cluster_slots only records with key in slots of connected cluster node
+  const size_t shard_index;
+  const size_t shard_count;
+  const bool own_cluster_slots;
+};
+
+struct ExecuteFileResponse : ExecuteFileRequest {
+  typedef ExecuteFileRequest base_class;
+  explicit ExecuteFileResponse(const base_class& request);
+
+  enum { max_errors = 100 };
+
+  uint64_t offset_out;  // everything before was executed, pass it as offset to continue
+  uint64_t file_size;
+  size_t executed;
+  size_t failed;
+  std::vector<std::string> errors;  // "line 12: ...", first max_errors only
+  common::time64_t elapsed_msec;
+};
+
+struct LoadValueRangeRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  LoadValueRangeRequest(initiator_type sender,
+                        core::IDataBaseInfoSPtr inf,
+                        const core::NKey& key,
+                        uint64_t offset,
+                        size_t size,
+                        error_type er = error_type());
+
+  core::IDataBaseInfoSPtr inf;
+  const core::NKey key;
+  const uint64_t offset;
+  const size_t size;  // 0 to get only value size
+};
+
+struct LoadValueRangeResponse : LoadValueRangeRequest {
+  typedef LoadValueRangeRequest base_class;
+  explicit LoadValueRangeResponse(const base_class& request);
+
+  uint64_t value_size;  // STRLEN
+  std::string data;     // [offset, offset + size) part of value, shorter at the end of value
+};
+
+struct SaveValueToFileRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  SaveValueToFileRequest(initiator_type sender,
+                         core::IDataBaseInfoSPtr inf,
+                         const core::NKey& key,
+                         const std::string& path,
+                         size_t chunk_size,
+                         error_type er = error_type());
+
+  core::IDataBaseInfoSPtr inf;
+  const core::NKey key;
+  const std::string path;
+  const size_t chunk_size;  // bytes per range read, value is never loaded at once
+};
+
+struct SaveValueToFileResponse : SaveValueToFileRequest {
+  typedef SaveValueToFileRequest base_class;
+  explicit SaveValueToFileResponse(const base_class& request);
+
+  uint64_t value_size;
+  uint64_t written;
+};
+
+struct LoadValuePageRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  LoadValuePageRequest(initiator_type sender,
+                       core::IDataBaseInfoSPtr inf,
+                       const core::NKey& key,
+                       common::Value::Type type,
+                       core::cursor_t cursor,
+                       size_t count,
+                       error_type er = error_type());
+
+  core::IDataBaseInfoSPtr inf;
+  const core::NKey key;
+  const common::Value::Type type;  // hash, set, zset or list
+  const core::cursor_t cursor;     // scan cursor, index of first element for lists
+  const size_t count;              // 0 to get only elements count
+};
+
+struct LoadValuePageResponse : LoadValuePageRequest {
+  typedef LoadValuePageRequest base_class;
+  explicit LoadValuePageResponse(const base_class& request);
+
+  core::cursor_t cursor_out;  // 0 after last page
+  uint64_t total;             // HLEN, SCARD, ZCARD or LLEN
+  // field, value pairs for hashes, member, score pairs for zsets
+  std::vector<common::Value::string_t> items;
+};
+
+struct SaveValueChangesRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  SaveValueChangesRequest(initiator_type sender,
+                          core::IDataBaseInfoSPtr inf,
+                          const core::NDbKValue& key,
+                          const ValueChangesCommands& commands,
+                          error_type er = error_type());
+
+  core::IDataBaseInfoSPtr inf;
+  const core::NDbKValue key;  // edited value, loaded key is updated with it after save if value is set
+  const ValueChangesCommands commands;
+};
+
+struct SaveValueChangesResponse : SaveValueChangesRequest {
+  typedef SaveValueChangesRequest base_class;
+  explicit SaveValueChangesResponse(const base_class& request);
+
+  bool stale;  // stored rows no longer match database, value should be reloaded
+};
+
+struct LoadStreamPageRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  LoadStreamPageRequest(initiator_type sender,
+                        core::IDataBaseInfoSPtr inf,
+                        const core::NKey& key,
+                        const core::StreamValue::stream_id& start,
+                        const core::StreamValue::stream_id& end,
+                        size_t count,
+                        bool reverse,
+                        bool from_shown = false,
+                        error_type er = error_type());
+
+  core::IDataBaseInfoSPtr inf;
+  const core::NKey key;
+  const core::StreamValue::stream_id start;  // inclusive ids or timestamps, "-" and "+" for stream bounds
+  const core::StreamValue::stream_id end;
+  const size_t count;
+  const bool reverse;     // entries from end down to start
+  const bool from_shown;  // range starts at entry shown already, requester drops it from page
+};
+
+struct LoadStreamPageResponse : LoadStreamPageRequest {
+  typedef LoadStreamPageRequest base_class;
+  explicit LoadStreamPageResponse(const base_class& request);
+
+  std::vector<core::StreamValue::Stream> streams;
+};
+
+struct LoadStreamInfoRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  LoadStreamInfoRequest(initiator_type sender,
+                        core::IDataBaseInfoSPtr inf,
+                        const core::NKey& key,
+                        error_type er = error_type());
+
+  core::IDataBaseInfoSPtr inf;
+  const core::NKey key;
+};
+
+struct LoadStreamInfoResponse : LoadStreamInfoRequest {
+  typedef LoadStreamInfoRequest base_class;
+  explicit LoadStreamInfoResponse(const base_class& request);
+
+  StreamInfo info;
+};
+
+struct WatchKeyRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  WatchKeyRequest(initiator_type sender,
+                  core::IDataBaseInfoSPtr inf,
+                  const core::NDbKValue& key,
+                  common::time64_t msec_interval,
+                  bool enable,
+                  error_type er = error_type());
+
+  core::IDataBaseInfoSPtr inf;
+  const core::NDbKValue key;
+  const common::time64_t msec_interval;  // used only when server has keyspace notifications disabled
+  const bool enable;                     // false only stops current watch
+};
+
+struct WatchKeyResponse : WatchKeyRequest {
+  typedef WatchKeyRequest base_class;
+  explicit WatchKeyResponse(const base_class& request);
+
+  bool notifications;
+  size_t reloads_count;
+};
+
+struct KeyspaceSyncRequest : public EventInfoBase {
+  typedef EventInfoBase base_class;
+  KeyspaceSyncRequest(initiator_type sender, core::IDataBaseInfoSPtr inf, bool enable, error_type er = error_type());
+
+  core::IDataBaseInfoSPtr inf;
+  const bool enable;  // false stops running sync
+};
+
+struct KeyspaceSyncResponse : KeyspaceSyncRequest {
+  typedef KeyspaceSyncRequest base_class;
+  explicit KeyspaceSyncResponse(const base_class& request);
+};
+
 struct LoadServerChannelsRequest : public EventInfoBase {
   typedef EventInfoBase base_class;
   LoadServerChannelsRequest(initiator_type sender, const std::string& pattern, error_type er = error_type());
@@ -0,0 +1,72 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/heavy_hitters.h"
+
+#include <algorithm>
+
+namespace fastonosql {
+namespace proxy {
+
+HeavyHitters::HeavyHitters(size_t top_k) : sketch_(), top_k_(top_k), top_() {}
+
+void HeavyHitters::Add(const std::string& item, count_t count) {
+  const count_t estimate = sketch_.Add(item, count);
+  auto it = top_.find(item);
+  if (it != top_.end()) {
+    it->second = estimate;
+    return;
+  }
+
+  if (top_.size() < top_k_) {
+    top_[item] = estimate;
+    return;
+  }
+
+  auto min_it = std::min_element(top_.begin(), top_.end(), [](const std::pair<const std::string, count_t>& lhs,
+                                                               const std::pair<const std::string, count_t>& rhs) {
+    return lhs.second < rhs.second;
+  });
+  if (min_it != top_.end() && min_it->second < estimate) {
+    top_.erase(min_it);
+    top_[item] = estimate;
+  }
+}
+
+HeavyHitters::items_t HeavyHitters::GetTop() const {
+  items_t result(top_.begin(), top_.end());
+  std::sort(result.begin(), result.end(),
+            [](const item_t& lhs, const item_t& rhs) { return lhs.second > rhs.second; });
+  return result;
+}
+
+HeavyHitters::count_t HeavyHitters::GetTotal() const {
+  return sketch_.GetTotal();
+}
+
+size_t HeavyHitters::GetTopK() const {
+  return top_k_;
+}
+
+void HeavyHitters::Reset() {
+  sketch_.Reset();
+  top_.clear();
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,54 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "proxy/count_min_sketch.h"
+
+namespace fastonosql {
+namespace proxy {
+
+// top-K most frequent items of a stream, counts come from count-min sketch
+// so only K candidates are stored besides the fixed size sketch
+class HeavyHitters {
+ public:
+  typedef CountMinSketch::count_t count_t;
+  typedef std::pair<std::string, count_t> item_t;
+  typedef std::vector<item_t> items_t;
+
+  explicit HeavyHitters(size_t top_k);
+
+  void Add(const std::string& item, count_t count = 1);
+  items_t GetTop() const;  // sorted by count, most frequent first
+  count_t GetTotal() const;
+  size_t GetTopK() const;
+  void Reset();
+
+ private:
+  CountMinSketch sketch_;
+  size_t top_k_;
+  std::unordered_map<std::string, count_t> top_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,236 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/hot_keys_sampler.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#include <algorithm>
+
+namespace fastonosql {
+namespace proxy {
+
+namespace {
+// first argument of these commands isn't a key
+const char* const kKeylessCommands[] = {
+    "AUTH", "BGREWRITEAOF", "BGSAVE", "CLIENT", "CLUSTER", "COMMAND", "CONFIG", "DBSIZE", "DEBUG", "DISCARD", "ECHO",
+    "EVAL", "EVALSHA", "EXEC", "FLUSHALL", "FLUSHDB", "HELLO", "INFO", "LASTSAVE", "MEMORY", "MODULE", "MULTI",
+    "OBJECT", "PING", "PSUBSCRIBE", "PUBLISH", "PUBSUB", "PUNSUBSCRIBE", "QUIT", "SAVE", "SCAN", "SCRIPT", "SELECT",
+    "SLOWLOG", "SUBSCRIBE", "SWAPDB", "TIME", "UNSUBSCRIBE", "UNWATCH", "WAIT", "XREAD", "XREADGROUP"};
+
+bool IsKeylessCommand(const std::string& command) {
+  for (const char* keyless : kKeylessCommands) {
+    if (strcmp(keyless, command.c_str()) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int HexToInt(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+// reads one "quoted" argument escaped like sdscatrepr does
+bool ReadQuotedArgument(const std::string& line, size_t* pos, std::string* out) {
+  size_t i = *pos;
+  while (i < line.size() && line[i] == ' ') {
+    i++;
+  }
+  if (i >= line.size() || line[i] != '"') {
+    return false;
+  }
+
+  std::string result;
+  for (i = i + 1; i < line.size(); ++i) {
+    const char c = line[i];
+    if (c == '"') {
+      *pos = i + 1;
+      *out = result;
+      return true;
+    }
+
+    if (c != '\\' || i + 1 >= line.size()) {
+      result += c;
+      continue;
+    }
+
+    const char next = line[++i];
+    if (next == 'n') {
+      result += '\n';
+    } else if (next == 'r') {
+      result += '\r';
+    } else if (next == 't') {
+      result += '\t';
+    } else if (next == 'a') {
+      result += '\a';
+    } else if (next == 'b') {
+      result += '\b';
+    } else if (next == 'x' && i + 2 < line.size() && HexToInt(line[i + 1]) >= 0 && HexToInt(line[i + 2]) >= 0) {
+      result += static_cast<char>(HexToInt(line[i + 1]) * 16 + HexToInt(line[i + 2]));
+      i += 2;
+    } else {
+      result += next;
+    }
+  }
+  return false;
+}
+}  // namespace
+
+HotKeysSampler::HotKeysSampler(size_t top_k, int sample_rate, const std::string& ns_separator, size_t ns_depth)
+    : sample_rate_(std::min(std::max(sample_rate, 1), static_cast<int>(max_sample_rate))),
+      ns_separator_(ns_separator),
+      ns_depth_(ns_depth),
+      sample_credit_(0),
+      seen_(0),
+      sampled_(0),
+      commands_(top_k),
+      keys_(top_k),
+      namespaces_(top_k) {}
+
+bool HotKeysSampler::AddMonitorLine(const std::string& line) {
+  std::string command;
+  std::string key;
+  if (!ParseMonitorLine(line, &command, &key)) {
+    return false;
+  }
+
+  seen_++;
+  if (!IsSampled()) {
+    return true;
+  }
+
+  sampled_++;
+  commands_.Add(command);
+  if (!key.empty()) {
+    keys_.Add(key);
+    namespaces_.Add(GetNamespace(key));
+  }
+  return true;
+}
+
+void HotKeysSampler::AddKeyFrequency(const std::string& key, count_t freq) {
+  seen_++;
+  sampled_++;
+  keys_.Add(key, freq);
+  namespaces_.Add(GetNamespace(key), freq);
+}
+
+HotKeysSampler::count_t HotKeysSampler::GetSeenCount() const {
+  return seen_;
+}
+
+HotKeysSampler::count_t HotKeysSampler::GetSampledCount() const {
+  return sampled_;
+}
+
+HotKeysSampler::items_t HotKeysSampler::GetTopCommands() const {
+  return commands_.GetTop();
+}
+
+HotKeysSampler::items_t HotKeysSampler::GetTopKeys() const {
+  return keys_.GetTop();
+}
+
+HotKeysSampler::items_t HotKeysSampler::GetTopNamespaces() const {
+  return namespaces_.GetTop();
+}
+
+std::string HotKeysSampler::GetNamespace(const std::string& key) const {
+  if (ns_separator_.empty()) {
+    return std::string();
+  }
+
+  // last part is key name, so namespace depth is limited by separators count
+  size_t end = std::string::npos;
+  size_t pos = 0;
+  for (size_t i = 0; i < ns_depth_; ++i) {
+    const size_t found = key.find(ns_separator_, pos);
+    if (found == std::string::npos) {
+      break;
+    }
+    end = found;
+    pos = found + ns_separator_.size();
+  }
+
+  if (end == std::string::npos) {
+    return std::string();
+  }
+  return key.substr(0, end);
+}
+
+void HotKeysSampler::Reset() {
+  sample_credit_ = 0;
+  seen_ = 0;
+  sampled_ = 0;
+  commands_.Reset();
+  keys_.Reset();
+  namespaces_.Reset();
+}
+
+bool HotKeysSampler::ParseMonitorLine(const std::string& line, std::string* command, std::string* key) {
+  if (!command || !key) {
+    return false;
+  }
+
+  size_t pos = line.find("] ");
+  if (pos == std::string::npos) {
+    return false;
+  }
+
+  pos += 2;
+  std::string lcommand;
+  if (!ReadQuotedArgument(line, &pos, &lcommand)) {
+    return false;
+  }
+
+  std::transform(lcommand.begin(), lcommand.end(), lcommand.begin(),
+                 [](unsigned char c) { return static_cast<char>(toupper(c)); });
+  std::string lkey;
+  if (!IsKeylessCommand(lcommand)) {
+    ReadQuotedArgument(line, &pos, &lkey);
+  }
+
+  *command = lcommand;
+  *key = lkey;
+  return true;
+}
+
+bool HotKeysSampler::IsSampled() {
+  // deterministic sampling: every command adds rate credits, 100 credits take one sample
+  sample_credit_ += sample_rate_;
+  if (sample_credit_ < max_sample_rate) {
+    return false;
+  }
+
+  sample_credit_ -= max_sample_rate;
+  return true;
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,75 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "proxy/heavy_hitters.h"
+
+namespace fastonosql {
+namespace proxy {
+
+enum HotKeysSamplingMode : unsigned char {
+  kHotKeysAuto = 0,    // OBJECT FREQ if server uses LFU eviction policy, MONITOR otherwise
+  kHotKeysMonitor,     // sample MONITOR stream for a bounded window
+  kHotKeysObjectFreq,  // SCAN + OBJECT FREQ, only valid with LFU policy
+};
+
+// aggregates sampled commands by command name, key and key namespace,
+// memory is bounded by sketches and top-K candidates, raw stream isn't stored
+class HotKeysSampler {
+ public:
+  typedef HeavyHitters::count_t count_t;
+  typedef HeavyHitters::items_t items_t;
+  enum { max_sample_rate = 100 };
+
+  HotKeysSampler(size_t top_k, int sample_rate, const std::string& ns_separator, size_t ns_depth);
+
+  // line of MONITOR output: 1339518083.107412 [0 127.0.0.1:60866] "get" "key"
+  // returns false if line can't be parsed
+  bool AddMonitorLine(const std::string& line);
+  void AddKeyFrequency(const std::string& key, count_t freq);
+
+  count_t GetSeenCount() const;
+  count_t GetSampledCount() const;
+  items_t GetTopCommands() const;
+  items_t GetTopKeys() const;
+  items_t GetTopNamespaces() const;
+
+  std::string GetNamespace(const std::string& key) const;
+  void Reset();
+
+  static bool ParseMonitorLine(const std::string& line, std::string* command, std::string* key);
+
+ private:
+  bool IsSampled();
+
+  const int sample_rate_;  // percent of commands to count
+  const std::string ns_separator_;
+  const size_t ns_depth_;
+  int sample_credit_;
+  count_t seen_;
+  count_t sampled_;
+  HeavyHitters commands_;
+  HeavyHitters keys_;
+  HeavyHitters namespaces_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,167 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/keyspace_changes.h"
+
+#include <fastonosql/core/value.h>
+
+namespace fastonosql {
+namespace proxy {
+namespace {
+
+struct KeyEventType {
+  const char* event;
+  common::Value::Type type;
+};
+
+// write events which create key if it doesn't exist, their class tells type of value
+const KeyEventType kAddEvents[] = {{"set", common::Value::TYPE_STRING},
+                                   {"setrange", common::Value::TYPE_STRING},
+                                   {"incrby", common::Value::TYPE_STRING},
+                                   {"incrbyfloat", common::Value::TYPE_STRING},
+                                   {"append", common::Value::TYPE_STRING},
+                                   {"lpush", common::Value::TYPE_ARRAY},
+                                   {"rpush", common::Value::TYPE_ARRAY},
+                                   {"sadd", common::Value::TYPE_SET},
+                                   {"zadd", common::Value::TYPE_ZSET},
+                                   {"zincr", common::Value::TYPE_ZSET},
+                                   {"hset", common::Value::TYPE_HASH},
+                                   {"hincrby", common::Value::TYPE_HASH},
+                                   {"hincrbyfloat", common::Value::TYPE_HASH},
+                                   {"xadd", core::StreamValue::TYPE_STREAM}};
+
+const char* const kRemoveEvents[] = {"del", "expired", "evicted", "move_from"};
+const char kRenameFromEvent[] = "rename_from";
+const char kRenameToEvent[] = "rename_to";
+
+core::NDbKValue MakeKey(const common::Value::string_t& key, common::Value::Type type) {
+  return core::NDbKValue(core::NKey(core::nkey_t(key)), core::NValue(core::CreateEmptyValueFromType(type)));
+}
+
+}  // namespace
+
+KeyspaceChange::KeyspaceChange() : type(ADDED), key(), new_name() {}
+
+KeyspaceChange::KeyspaceChange(Type type, const core::NDbKValue& key, const core::nkey_t& new_name)
+    : type(type), key(key), new_name(new_name) {}
+
+KeyspaceChangesBatcher::KeyspaceChangesBatcher(common::time64_t window_msec, size_t events_limit, size_t batch_limit)
+    : window_msec_(window_msec),
+      events_limit_(events_limit),
+      batch_limit_(batch_limit),
+      window_start_msec_(0),
+      window_events_(0),
+      last_flush_msec_(0),
+      changes_(),
+      changes_indexes_(),
+      rename_from_(),
+      has_rename_from_(false),
+      dropped_count_(0) {}
+
+bool KeyspaceChangesBatcher::AddEvent(const std::string& event,
+                                      const common::Value::string_t& key,
+                                      common::time64_t now_msec) {
+  if (now_msec - window_start_msec_ >= window_msec_) {
+    window_start_msec_ = now_msec;
+    window_events_ = 0;
+  }
+  window_events_++;
+
+  const std::string raw_key(key.begin(), key.end());
+  if (event == kRenameFromEvent) {
+    rename_from_ = key;
+    has_rename_from_ = true;
+    return false;
+  }
+
+  if (event == kRenameToEvent) {
+    if (!has_rename_from_) {
+      return false;
+    }
+
+    has_rename_from_ = false;
+    // renamed keys aren't coalesced, later changes of both names follow rename in batch
+    changes_indexes_.erase(std::string(rename_from_.begin(), rename_from_.end()));
+    changes_indexes_.erase(raw_key);
+    if (changes_.size() >= batch_limit_) {
+      dropped_count_++;
+      return true;
+    }
+    changes_.push_back(KeyspaceChange(KeyspaceChange::RENAMED, MakeKey(rename_from_, common::Value::TYPE_NULL),
+                                      core::nkey_t(key)));
+    return true;
+  }
+
+  for (const char* remove_event : kRemoveEvents) {
+    if (event == remove_event) {
+      AddChange(raw_key, KeyspaceChange(KeyspaceChange::REMOVED, MakeKey(key, common::Value::TYPE_NULL)));
+      return true;
+    }
+  }
+
+  for (const KeyEventType& add_event : kAddEvents) {
+    if (event == add_event.event) {
+      AddChange(raw_key, KeyspaceChange(KeyspaceChange::ADDED, MakeKey(key, add_event.type)));
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool KeyspaceChangesBatcher::IsFlushTime(common::time64_t now_msec) const {
+  if (changes_.empty() && dropped_count_ == 0) {
+    return false;
+  }
+
+  // quiet server gets every change at once, busy one once per window
+  return window_events_ <= events_limit_ || now_msec - last_flush_msec_ >= window_msec_;
+}
+
+keyspace_changes_t KeyspaceChangesBatcher::TakeChanges(common::time64_t now_msec) {
+  keyspace_changes_t result;
+  result.swap(changes_);
+  changes_indexes_.clear();
+  last_flush_msec_ = now_msec;
+  return result;
+}
+
+size_t KeyspaceChangesBatcher::TakeDroppedCount() {
+  const size_t result = dropped_count_;
+  dropped_count_ = 0;
+  return result;
+}
+
+void KeyspaceChangesBatcher::AddChange(const std::string& raw_key, const KeyspaceChange& change) {
+  auto it = changes_indexes_.find(raw_key);
+  if (it != changes_indexes_.end()) {
+    changes_[it->second] = change;  // last change of key wins
+    return;
+  }
+
+  if (changes_.size() >= batch_limit_) {
+    dropped_count_++;
+    return;
+  }
+
+  changes_indexes_[raw_key] = changes_.size();
+  changes_.push_back(change);
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
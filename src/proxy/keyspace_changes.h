@@ -0,0 +1,81 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <QMetaType>
+
+#include <common/time.h>
+
+#include <fastonosql/core/db_key.h>
+
+namespace fastonosql {
+namespace proxy {
+
+// change of database keyspace made by any client, applied to explorer by live sync
+struct KeyspaceChange {
+  enum Type : uint8_t { ADDED = 0, REMOVED, RENAMED };
+
+  KeyspaceChange();
+  KeyspaceChange(Type type, const core::NDbKValue& key, const core::nkey_t& new_name = core::nkey_t());
+
+  Type type;
+  core::NDbKValue key;  // value is empty, only its type is known from event
+  core::nkey_t new_name;
+};
+
+typedef std::vector<KeyspaceChange> keyspace_changes_t;
+
+// turns keyevent notifications (event name in channel, key in message) into keyspace changes,
+// changes of one key are coalesced, above events_limit per window batch is flushed once per window,
+// above batch_limit changes are dropped and counted
+class KeyspaceChangesBatcher {
+ public:
+  KeyspaceChangesBatcher(common::time64_t window_msec, size_t events_limit, size_t batch_limit);
+
+  // returns false for events which don't change keyspace
+  bool AddEvent(const std::string& event, const common::Value::string_t& key, common::time64_t now_msec);
+
+  bool IsFlushTime(common::time64_t now_msec) const;
+  keyspace_changes_t TakeChanges(common::time64_t now_msec);
+  size_t TakeDroppedCount();
+
+ private:
+  void AddChange(const std::string& raw_key, const KeyspaceChange& change);
+
+  const common::time64_t window_msec_;
+  const size_t events_limit_;
+  const size_t batch_limit_;
+  common::time64_t window_start_msec_;
+  size_t window_events_;
+  common::time64_t last_flush_msec_;
+  keyspace_changes_t changes_;
+  std::map<std::string, size_t> changes_indexes_;  // raw key -> its change in batch
+  common::Value::string_t rename_from_;            // rename_from and rename_to come in pair
+  bool has_rename_from_;
+  size_t dropped_count_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
+
+Q_DECLARE_METATYPE(fastonosql::proxy::keyspace_changes_t)
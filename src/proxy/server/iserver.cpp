@@ -24,6 +24,7 @@
 
 #include <common/qt/logger.h>
 #include <common/sprintf.h>
+#include <common/time.h>
 
 #include <fastonosql/core/db_traits.h>
 
@@ -31,8 +32,19 @@
 
 namespace fastonosql {
 namespace proxy {
-
-IServer::IServer(IDriver* drv) : drv_(drv), current_database_info_(), timer_check_key_exists_id_(0) {
+namespace {
+const size_t kValueCacheBytesBudget = 64 * 1024 * 1024;
+const common::time64_t kValueCacheMaxAgeMsec = 10 * 1000;  // without server-assisted invalidation
+// invalidation may overtake reply of load made just before change, age still bounds such stale value
+const common::time64_t kTrackedValueCacheMaxAgeMsec = 5 * 60 * 1000;
+}  // namespace
+
+IServer::IServer(IDriver* drv)
+    : drv_(drv),
+      current_database_info_(),
+      keyspace_sync_db_(),
+      timer_check_key_exists_id_(0),
+      value_cache_(kValueCacheBytesBudget, kValueCacheMaxAgeMsec) {
   if (!drv_) {
     DNOTREACHED();
     return;
@@ -53,6 +65,10 @@ IServer::IServer(IDriver* drv) : drv_(drv), current_database_info_(), timer_chec
   VERIFY(QObject::connect(drv_, &IDriver::KeyRenamed, this, &IServer::RenameKey));
   VERIFY(QObject::connect(drv_, &IDriver::KeyTTLChanged, this, &IServer::ChangeKeyTTL));
   VERIFY(QObject::connect(drv_, &IDriver::KeyTTLLoaded, this, &IServer::LoadKeyTTL));
+  VERIFY(QObject::connect(drv_, &IDriver::KeysChanged, this, &IServer::ApplyKeysChanges));
+  VERIFY(QObject::connect(drv_, &IDriver::KeyspaceSyncStopped, this, &IServer::StopKeyspaceSync));
+  VERIFY(QObject::connect(drv_, &IDriver::ValuesInvalidated, this, &IServer::InvalidateValues));
+  VERIFY(QObject::connect(drv_, &IDriver::ValueTrackingChanged, this, &IServer::ChangeValueTracking));
   VERIFY(QObject::connect(drv_, &IDriver::Disconnected, this, &IServer::Disconnected));
 
   drv_->Start();
@@ -125,6 +141,14 @@ core::IServerInfoSPtr IServer::GetCurrentServerInfo() const {
   return drv_->GetCurrentServerInfoIfConnected();
 }
 
+CommandsLatencyStats::snapshot_t IServer::GetCommandsLatency() const {
+  return drv_->GetCommandsLatency();
+}
+
+void IServer::ResetCommandsLatency() {
+  drv_->ResetCommandsLatency();
+}
+
 IServer::database_t IServer::GetCurrentDatabaseInfo() const {
   if (IsConnected()) {
     return current_database_info_;
@@ -133,6 +157,10 @@ IServer::database_t IServer::GetCurrentDatabaseInfo() const {
   return database_t();
 }
 
+IConnectionSettingsBaseSPtr IServer::GetSettings() const {
+  return drv_->GetSettings();
+}
+
 std::string IServer::GetDelimiter() const {
   return drv_->GetDelimiter();
 }
@@ -165,6 +193,25 @@ proxy::IServer::database_t IServer::FindDatabase(core::IDataBaseInfoSPtr inf) co
   return database_t();
 }
 
+bool IServer::IsKeyspaceSyncEnabled() const {
+  return keyspace_sync_db_ != nullptr;
+}
+
+bool IServer::LoadCachedValue(core::IDataBaseInfoSPtr db, const core::NKey& key) {
+  database_t cdb = GetCurrentDatabaseInfo();
+  if (!cdb || !db || cdb->GetName() != db->GetName()) {
+    return false;
+  }
+
+  core::NValue value;
+  if (!value_cache_.Get(cdb->GetName(), key, common::time::current_utc_mstime(), &value)) {
+    return false;
+  }
+
+  emit KeyLoaded(cdb, core::NDbKValue(key, value));
+  return true;
+}
+
 void IServer::Connect(const events_info::ConnectInfoRequest& req) {
   emit ConnectStarted(req);
   drv_->PrepareSettings();
@@ -191,6 +238,78 @@ void IServer::LoadDatabaseContent(const events_info::LoadDatabaseContentRequest&
   NotifyStartEvent(ev);
 }
 
+void IServer::LoadKeysStatistics(const events_info::LoadKeysStatisticsRequest& req) {
+  emit LoadKeysStatisticsStarted(req);
+  QEvent* ev = new events::LoadKeysStatisticsRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+void IServer::SampleHotKeys(const events_info::SampleHotKeysRequest& req) {
+  emit SampleHotKeysStarted(req);
+  QEvent* ev = new events::SampleHotKeysRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+void IServer::Benchmark(const events_info::BenchmarkRequest& req) {
+  emit BenchmarkStarted(req);
+  QEvent* ev = new events::BenchmarkRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+void IServer::ExecuteFile(const events_info::ExecuteFileRequest& req) {
+  emit ExecuteFileStarted(req);
+  QEvent* ev = new events::ExecuteFileRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+void IServer::LoadValueRange(const events_info::LoadValueRangeRequest& req) {
+  emit LoadValueRangeStarted(req);
+  QEvent* ev = new events::LoadValueRangeRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+void IServer::SaveValueToFile(const events_info::SaveValueToFileRequest& req) {
+  emit SaveValueToFileStarted(req);
+  QEvent* ev = new events::SaveValueToFileRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+void IServer::LoadValuePage(const events_info::LoadValuePageRequest& req) {
+  emit LoadValuePageStarted(req);
+  QEvent* ev = new events::LoadValuePageRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+void IServer::SaveValueChanges(const events_info::SaveValueChangesRequest& req) {
+  emit SaveValueChangesStarted(req);
+  QEvent* ev = new events::SaveValueChangesRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+void IServer::LoadStreamPage(const events_info::LoadStreamPageRequest& req) {
+  emit LoadStreamPageStarted(req);
+  QEvent* ev = new events::LoadStreamPageRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+void IServer::LoadStreamInfo(const events_info::LoadStreamInfoRequest& req) {
+  emit LoadStreamInfoStarted(req);
+  QEvent* ev = new events::LoadStreamInfoRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+void IServer::WatchKey(const events_info::WatchKeyRequest& req) {
+  emit WatchKeyStarted(req);
+  QEvent* ev = new events::WatchKeyRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
+void IServer::SetKeyspaceSync(const events_info::KeyspaceSyncRequest& req) {
+  emit KeyspaceSyncStarted(req);
+  QEvent* ev = new events::KeyspaceSyncRequestEvent(this, req);
+  NotifyStartEvent(ev);
+}
+
 void IServer::Execute(const events_info::ExecuteInfoRequest& req) {
   emit ExecuteStarted(req);
   QEvent* ev = new events::ExecuteRequestEvent(this, req);
@@ -317,6 +436,42 @@ void IServer::customEvent(QEvent* event) {
   } else if (type == static_cast<QEvent::Type>(events::LoadDatabaseContentResponseEvent::EventType)) {
     events::LoadDatabaseContentResponseEvent* ev = static_cast<events::LoadDatabaseContentResponseEvent*>(event);
     HandleLoadDatabaseContentEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadKeysStatisticsResponseEvent::EventType)) {
+    events::LoadKeysStatisticsResponseEvent* ev = static_cast<events::LoadKeysStatisticsResponseEvent*>(event);
+    HandleLoadKeysStatisticsEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::SampleHotKeysResponseEvent::EventType)) {
+    events::SampleHotKeysResponseEvent* ev = static_cast<events::SampleHotKeysResponseEvent*>(event);
+    HandleSampleHotKeysEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::BenchmarkResponseEvent::EventType)) {
+    events::BenchmarkResponseEvent* ev = static_cast<events::BenchmarkResponseEvent*>(event);
+    HandleBenchmarkEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::ExecuteFileResponseEvent::EventType)) {
+    events::ExecuteFileResponseEvent* ev = static_cast<events::ExecuteFileResponseEvent*>(event);
+    HandleExecuteFileEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadValueRangeResponseEvent::EventType)) {
+    events::LoadValueRangeResponseEvent* ev = static_cast<events::LoadValueRangeResponseEvent*>(event);
+    HandleLoadValueRangeEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::SaveValueToFileResponseEvent::EventType)) {
+    events::SaveValueToFileResponseEvent* ev = static_cast<events::SaveValueToFileResponseEvent*>(event);
+    HandleSaveValueToFileEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadValuePageResponseEvent::EventType)) {
+    events::LoadValuePageResponseEvent* ev = static_cast<events::LoadValuePageResponseEvent*>(event);
+    HandleLoadValuePageEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::SaveValueChangesResponseEvent::EventType)) {
+    events::SaveValueChangesResponseEvent* ev = static_cast<events::SaveValueChangesResponseEvent*>(event);
+    HandleSaveValueChangesEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadStreamPageResponseEvent::EventType)) {
+    events::LoadStreamPageResponseEvent* ev = static_cast<events::LoadStreamPageResponseEvent*>(event);
+    HandleLoadStreamPageEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::LoadStreamInfoResponseEvent::EventType)) {
+    events::LoadStreamInfoResponseEvent* ev = static_cast<events::LoadStreamInfoResponseEvent*>(event);
+    HandleLoadStreamInfoEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::WatchKeyResponseEvent::EventType)) {
+    events::WatchKeyResponseEvent* ev = static_cast<events::WatchKeyResponseEvent*>(event);
+    HandleWatchKeyEvent(ev);
+  } else if (type == static_cast<QEvent::Type>(events::KeyspaceSyncResponseEvent::EventType)) {
+    events::KeyspaceSyncResponseEvent* ev = static_cast<events::KeyspaceSyncResponseEvent*>(event);
+    HandleKeyspaceSyncEvent(ev);
   } else if (type == static_cast<QEvent::Type>(events::ExecuteResponseEvent::EventType)) {
     events::ExecuteResponseEvent* ev = static_cast<events::ExecuteResponseEvent*>(event);
     HandleExecuteEvent(ev);
@@ -356,6 +511,7 @@ void IServer::HandleConnectEvent(events::ConnectResponseEvent* ev) {
 }
 
 void IServer::HandleDisconnectEvent(events::DisconnectResponseEvent* ev) {
+  value_cache_.Clear();
   auto v = ev->value();
   common::Error err = v.errorInfo();
   if (err) {
@@ -494,6 +650,117 @@ void IServer::HandleLoadDatabaseContentEvent(events::LoadDatabaseContentResponse
   emit LoadDatabaseContentFinished(v);
 }
 
+void IServer::HandleLoadKeysStatisticsEvent(events::LoadKeysStatisticsResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit LoadKeysStatisticsFinished(v);
+}
+
+void IServer::HandleSampleHotKeysEvent(events::SampleHotKeysResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit SampleHotKeysFinished(v);
+}
+
+void IServer::HandleBenchmarkEvent(events::BenchmarkResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit BenchmarkFinished(v);
+}
+
+void IServer::HandleExecuteFileEvent(events::ExecuteFileResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit ExecuteFileFinished(v);
+}
+
+void IServer::HandleLoadValueRangeEvent(events::LoadValueRangeResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit LoadValueRangeFinished(v);
+}
+
+void IServer::HandleSaveValueToFileEvent(events::SaveValueToFileResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit SaveValueToFileFinished(v);
+}
+
+void IServer::HandleLoadValuePageEvent(events::LoadValuePageResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit LoadValuePageFinished(v);
+}
+
+void IServer::HandleSaveValueChangesEvent(events::SaveValueChangesResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit SaveValueChangesFinished(v);
+}
+
+void IServer::HandleLoadStreamPageEvent(events::LoadStreamPageResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit LoadStreamPageFinished(v);
+}
+
+void IServer::HandleLoadStreamInfoEvent(events::LoadStreamInfoResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit LoadStreamInfoFinished(v);
+}
+
+void IServer::HandleWatchKeyEvent(events::WatchKeyResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  emit WatchKeyFinished(v);
+}
+
+void IServer::HandleKeyspaceSyncEvent(events::KeyspaceSyncResponseEvent* ev) {
+  auto v = ev->value();
+  common::Error err = v.errorInfo();
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+    keyspace_sync_db_.reset();
+  } else {
+    keyspace_sync_db_ = v.enable ? FindDatabase(v.inf) : database_t();
+  }
+  emit KeyspaceSyncFinished(v);
+}
+
 void IServer::CreateDB(core::IDataBaseInfoSPtr db) {
   database_t dbs = FindDatabase(db);
   if (!dbs) {
@@ -516,6 +783,7 @@ void IServer::FlushCurrentDB() {
 
   cdb->ClearKeys();
   cdb->SetDBKeysCount(0);
+  value_cache_.Clear();
   emit DatabaseFlushed(cdb);
 }
 
@@ -547,6 +815,11 @@ void IServer::ChangeCurrentDB(core::IDataBaseInfoSPtr db) {
 
   DCHECK(founded->IsDefault());
   emit DatabaseChanged(founded);
+
+  // listener is subscribed to events of previous database only
+  if (keyspace_sync_db_ && keyspace_sync_db_->GetName() != founded->GetName()) {
+    SetKeyspaceSync(events_info::KeyspaceSyncRequest(this, keyspace_sync_db_, false));
+  }
 }
 
 void IServer::RemoveKey(core::NKey key) {
@@ -555,6 +828,7 @@ void IServer::RemoveKey(core::NKey key) {
     return;
   }
 
+  value_cache_.Invalidate(cdb->GetName(), key.GetKey());
   if (cdb->RemoveKey(key)) {
     emit KeyRemoved(cdb, key);
   }
@@ -566,6 +840,7 @@ void IServer::AddKey(core::NDbKValue key) {
     return;
   }
 
+  value_cache_.Invalidate(cdb->GetName(), key.GetKey().GetKey());
   if (cdb->InsertKey(key)) {
     emit KeyAdded(cdb, key);
   } else {
@@ -573,12 +848,18 @@ void IServer::AddKey(core::NDbKValue key) {
   }
 }
 
-void IServer::LoadKey(core::NDbKValue key) {
+void IServer::LoadKey(core::NDbKValue key, bool cacheable) {
   database_t cdb = GetCurrentDatabaseInfo();
   if (!cdb) {
     return;
   }
 
+  // value loaded while invalidation was in flight may be already stale
+  if (cacheable) {
+    value_cache_.Put(cdb->GetName(), key, common::time::current_utc_mstime());
+  } else {
+    value_cache_.Invalidate(cdb->GetName(), key.GetKey().GetKey());
+  }
   if (cdb->InsertKey(key)) {
     emit KeyAdded(cdb, key);
   } else {
@@ -592,6 +873,8 @@ void IServer::RenameKey(core::NKey key, core::nkey_t new_name) {
     return;
   }
 
+  value_cache_.Invalidate(cdb->GetName(), key.GetKey());
+  value_cache_.Invalidate(cdb->GetName(), new_name);
   if (cdb->RenameKey(key, new_name)) {
     emit KeyRenamed(cdb, key, new_name);
   }
@@ -615,6 +898,7 @@ void IServer::LoadKeyTTL(core::NKey key, core::ttl_t ttl) {
   }
 
   if (ttl == EXPIRED_TTL) {
+    value_cache_.Invalidate(cdb->GetName(), key.GetKey());
     if (cdb->RemoveKey(key)) {
       emit KeyRemoved(cdb, key);
     }
@@ -626,6 +910,63 @@ void IServer::LoadKeyTTL(core::NKey key, core::ttl_t ttl) {
   }
 }
 
+void IServer::ApplyKeysChanges(keyspace_changes_t changes, size_t dropped_count) {
+  database_t db = keyspace_sync_db_;
+  if (!db) {
+    return;
+  }
+
+  if (dropped_count) {
+    common::Error err = common::make_error(common::MemSPrintf(
+        "Live sync skipped %zu keyspace changes of busy server, reload database to see all keys.", dropped_count));
+    LOG_ERROR(err, common::logging::LOG_LEVEL_WARNING, true);
+  }
+
+  // only changes which aren't known yet reach explorer
+  keyspace_changes_t applied;
+  for (const KeyspaceChange& change : changes) {
+    const core::NKey key = change.key.GetKey();
+    value_cache_.Invalidate(db->GetName(), key.GetKey());  // added events are writes of existing keys too
+    if (change.type == KeyspaceChange::RENAMED) {
+      value_cache_.Invalidate(db->GetName(), change.new_name);
+    }
+
+    bool is_applied = false;
+    if (change.type == KeyspaceChange::ADDED) {
+      is_applied = db->InsertKey(change.key);
+    } else if (change.type == KeyspaceChange::REMOVED) {
+      is_applied = db->RemoveKey(key);
+    } else if (change.type == KeyspaceChange::RENAMED) {
+      is_applied = db->RenameKey(key, change.new_name);
+    }
+
+    if (is_applied) {
+      applied.push_back(change);
+    }
+  }
+
+  if (!applied.empty()) {
+    emit KeysChanged(db, applied);
+  }
+}
+
+void IServer::StopKeyspaceSync(common::Error err) {
+  if (err) {
+    LOG_ERROR(err, common::logging::LOG_LEVEL_ERR, true);
+  }
+  keyspace_sync_db_.reset();
+}
+
+void IServer::InvalidateValues(invalidated_keys_t keys) {
+  value_cache_.Invalidate(keys);
+}
+
+void IServer::ChangeValueTracking(bool enabled) {
+  // values cached before tracking started or after it stopped aren't invalidated by server
+  value_cache_.Clear();
+  value_cache_.SetMaxAge(enabled ? kTrackedValueCacheMaxAgeMsec : kValueCacheMaxAgeMsec);
+}
+
 void IServer::HandleCheckDBKeys(core::IDataBaseInfoSPtr db, core::ttl_t expired_time) {
   if (!db) {
     return;
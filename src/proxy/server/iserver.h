@@ -24,10 +24,13 @@
 #include <fastonosql/core/db_traits.h>
 #include <fastonosql/core/icommand_translator.h>
 
+#include "proxy/commands_latency_stats.h"
 #include "proxy/events/events.h"
+#include "proxy/keyspace_changes.h"
 #include "proxy/proxy_fwd.h"
 #include "proxy/server/iserver_base.h"
 #include "proxy/types.h"
+#include "proxy/value_cache.h"
 
 namespace fastonosql {
 namespace proxy {
@@ -58,12 +61,18 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
 
   database_t GetCurrentDatabaseInfo() const;
   core::IServerInfoSPtr GetCurrentServerInfo() const;
+  CommandsLatencyStats::snapshot_t GetCommandsLatency() const;
+  void ResetCommandsLatency();
 
+  IConnectionSettingsBaseSPtr GetSettings() const;
   std::string GetDelimiter() const;
   std::string GetNsSeparator() const;
   NsDisplayStrategy GetNsDisplayStrategy() const;
   IDatabaseSPtr CreateDatabaseByInfo(core::IDataBaseInfoSPtr inf);
   database_t FindDatabase(core::IDataBaseInfoSPtr inf) const;
+  bool IsKeyspaceSyncEnabled() const;
+  // emits KeyLoaded with cached value of key without round trip to server, false if value must be loaded
+  bool LoadCachedValue(core::IDataBaseInfoSPtr db, const core::NKey& key);
 
  Q_SIGNALS:  // only direct connections
   void ConnectStarted(const events_info::ConnectInfoRequest& req);
@@ -116,6 +125,42 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   void LoadDataBaseContentStarted(const events_info::LoadDatabaseContentRequest& req);
   void LoadDatabaseContentFinished(const events_info::LoadDatabaseContentResponse& res);
 
+  void LoadKeysStatisticsStarted(const events_info::LoadKeysStatisticsRequest& req);
+  void LoadKeysStatisticsFinished(const events_info::LoadKeysStatisticsResponse& res);
+
+  void SampleHotKeysStarted(const events_info::SampleHotKeysRequest& req);
+  void SampleHotKeysFinished(const events_info::SampleHotKeysResponse& res);
+
+  void BenchmarkStarted(const events_info::BenchmarkRequest& req);
+  void BenchmarkFinished(const events_info::BenchmarkResponse& res);
+
+  void ExecuteFileStarted(const events_info::ExecuteFileRequest& req);
+  void ExecuteFileFinished(const events_info::ExecuteFileResponse& res);
+
+  void LoadValueRangeStarted(const events_info::LoadValueRangeRequest& req);
+  void LoadValueRangeFinished(const events_info::LoadValueRangeResponse& res);
+
+  void SaveValueToFileStarted(const events_info::SaveValueToFileRequest& req);
+  void SaveValueToFileFinished(const events_info::SaveValueToFileResponse& res);
+
+  void LoadValuePageStarted(const events_info::LoadValuePageRequest& req);
+  void LoadValuePageFinished(const events_info::LoadValuePageResponse& res);
+
+  void SaveValueChangesStarted(const events_info::SaveValueChangesRequest& req);
+  void SaveValueChangesFinished(const events_info::SaveValueChangesResponse& res);
+
+  void LoadStreamPageStarted(const events_info::LoadStreamPageRequest& req);
+  void LoadStreamPageFinished(const events_info::LoadStreamPageResponse& res);
+
+  void LoadStreamInfoStarted(const events_info::LoadStreamInfoRequest& req);
+  void LoadStreamInfoFinished(const events_info::LoadStreamInfoResponse& res);
+
+  void WatchKeyStarted(const events_info::WatchKeyRequest& req);
+  void WatchKeyFinished(const events_info::WatchKeyResponse& res);
+
+  void KeyspaceSyncStarted(const events_info::KeyspaceSyncRequest& req);
+  void KeyspaceSyncFinished(const events_info::KeyspaceSyncResponse& res);
+
   void LoadDiscoveryInfoStarted(const events_info::DiscoveryInfoRequest& res);
   void LoadDiscoveryInfoFinished(const events_info::DiscoveryInfoResponse& res);
 
@@ -135,6 +180,7 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   void KeyLoaded(core::IDataBaseInfoSPtr db, core::NDbKValue key);
   void KeyRenamed(core::IDataBaseInfoSPtr db, core::NKey key, core::nkey_t new_name);
   void KeyTTLChanged(core::IDataBaseInfoSPtr db, core::NKey key, core::ttl_t ttl);
+  void KeysChanged(core::IDataBaseInfoSPtr db, keyspace_changes_t changes);  // live sync batch
   void Disconnected();
 
  public:
@@ -146,6 +192,28 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
                                                                          // LoadDatabasesFinished
   void LoadDatabaseContent(const events_info::LoadDatabaseContentRequest& req);  // signals: LoadDataBaseContentStarted,
                                                                                  // LoadDatabaseContentFinished
+  void LoadKeysStatistics(const events_info::LoadKeysStatisticsRequest& req);  // signals: LoadKeysStatisticsStarted,
+                                                                               // LoadKeysStatisticsFinished
+  void SampleHotKeys(const events_info::SampleHotKeysRequest& req);  // signals: SampleHotKeysStarted,
+                                                                     // SampleHotKeysFinished
+  void Benchmark(const events_info::BenchmarkRequest& req);          // signals: BenchmarkStarted, BenchmarkFinished
+  void ExecuteFile(const events_info::ExecuteFileRequest& req);      // signals: ExecuteFileStarted,
+                                                                     // ExecuteFileFinished
+  void LoadValueRange(const events_info::LoadValueRangeRequest& req);    // signals: LoadValueRangeStarted,
+                                                                         // LoadValueRangeFinished
+  void SaveValueToFile(const events_info::SaveValueToFileRequest& req);  // signals: SaveValueToFileStarted,
+                                                                         // SaveValueToFileFinished
+  void LoadValuePage(const events_info::LoadValuePageRequest& req);      // signals: LoadValuePageStarted,
+                                                                         // LoadValuePageFinished
+  void SaveValueChanges(const events_info::SaveValueChangesRequest& req);  // signals: SaveValueChangesStarted,
+                                                                           // SaveValueChangesFinished
+  void LoadStreamPage(const events_info::LoadStreamPageRequest& req);  // signals: LoadStreamPageStarted,
+                                                                       // LoadStreamPageFinished
+  void LoadStreamInfo(const events_info::LoadStreamInfoRequest& req);  // signals: LoadStreamInfoStarted,
+                                                                       // LoadStreamInfoFinished
+  void WatchKey(const events_info::WatchKeyRequest& req);  // signals: WatchKeyStarted, WatchKeyFinished
+  void SetKeyspaceSync(const events_info::KeyspaceSyncRequest& req);  // signals: KeyspaceSyncStarted,
+                                                                      // KeyspaceSyncFinished
   void Execute(const events_info::ExecuteInfoRequest& req);                      // signals: ExecuteStarted
 
   void BackupToPath(const events_info::BackupInfoRequest& req);      // signals: BackupStarted, BackupFinished
@@ -196,6 +264,18 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   // handle database events
   virtual void HandleLoadDatabaseInfosEvent(events::LoadDatabasesInfoResponseEvent* ev);
   virtual void HandleLoadDatabaseContentEvent(events::LoadDatabaseContentResponseEvent* ev);
+  virtual void HandleLoadKeysStatisticsEvent(events::LoadKeysStatisticsResponseEvent* ev);
+  virtual void HandleSampleHotKeysEvent(events::SampleHotKeysResponseEvent* ev);
+  virtual void HandleBenchmarkEvent(events::BenchmarkResponseEvent* ev);
+  virtual void HandleExecuteFileEvent(events::ExecuteFileResponseEvent* ev);
+  virtual void HandleLoadValueRangeEvent(events::LoadValueRangeResponseEvent* ev);
+  virtual void HandleSaveValueToFileEvent(events::SaveValueToFileResponseEvent* ev);
+  virtual void HandleLoadValuePageEvent(events::LoadValuePageResponseEvent* ev);
+  virtual void HandleSaveValueChangesEvent(events::SaveValueChangesResponseEvent* ev);
+  virtual void HandleLoadStreamPageEvent(events::LoadStreamPageResponseEvent* ev);
+  virtual void HandleLoadStreamInfoEvent(events::LoadStreamInfoResponseEvent* ev);
+  virtual void HandleWatchKeyEvent(events::WatchKeyResponseEvent* ev);
+  virtual void HandleKeyspaceSyncEvent(events::KeyspaceSyncResponseEvent* ev);
 
   // handle command events
   virtual void HandleDiscoveryInfoResponseEvent(events::DiscoveryInfoResponseEvent* ev);
@@ -211,10 +291,14 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
 
   void RemoveKey(core::NKey key);
   void AddKey(core::NDbKValue key);
-  void LoadKey(core::NDbKValue key);
+  void LoadKey(core::NDbKValue key, bool cacheable);
   void RenameKey(core::NKey key, core::nkey_t new_name);
   void ChangeKeyTTL(core::NKey key, core::ttl_t ttl);
   void LoadKeyTTL(core::NKey key, core::ttl_t ttl);
+  void ApplyKeysChanges(keyspace_changes_t changes, size_t dropped_count);
+  void StopKeyspaceSync(common::Error err);
+  void InvalidateValues(invalidated_keys_t keys);
+  void ChangeValueTracking(bool enabled);
 
  private:
   void HandleCheckDBKeys(core::IDataBaseInfoSPtr db, core::ttl_t expired_time);
@@ -229,7 +313,9 @@ class IServer : public IServerBase, public std::enable_shared_from_this<IServer>
   void ProcessDiscoveryInfo(const events_info::DiscoveryInfoRequest& req);
 
   database_t current_database_info_;
+  database_t keyspace_sync_db_;  // live synced database, empty if sync is off
   int timer_check_key_exists_id_;
+  ValueCache value_cache_;
 };
 
 }  // namespace proxy
@@ -43,6 +43,8 @@
 #define SHARE_PATH_RELATIVE "share/resources"
 #define MODULE_PATH_RELATIVE "modules"
 #define CONVERTERS_PATH_RELATIVE "converters"
+#define COMMANDS_LOG_JSON_FILE_NAME "commands.jsonl"
+#define COMMANDS_LOG_BINARY_FILE_NAME "commands.bin"
 
 #define PREFIX "settings/"
 
@@ -68,6 +70,9 @@
 #endif
 #define SHOW_WELCOME_PAGE PREFIX "show_welcome_page"
 #define PYTHON_PATH PREFIX "python_path"
+#define USER_COMMANDS_LOG_SAMPLING PREFIX "user_commands_log_sampling"
+#define INNER_COMMANDS_LOG_SAMPLING PREFIX "inner_commands_log_sampling"
+#define COMMANDS_LOG_FILE_FORMAT PREFIX "commands_log_file_format"
 #define CONFIG_VERSION PREFIX "version"
 
 #if defined(OS_WIN)
@@ -125,7 +130,10 @@ SettingsManager::SettingsManager()
       auto_open_console_(),
       auto_connect_db_(),
       window_settings_(),
-      python_path_() {
+      python_path_(),
+      user_commands_log_sampling_(1),
+      inner_commands_log_sampling_(1),
+      commands_log_file_format_(kCommandLogFileNone) {
 }
 
 SettingsManager::~SettingsManager() {}
@@ -370,6 +378,38 @@ void SettingsManager::SetPythonPath(const QString& path) {
   python_path_ = path;
 }
 
+uint32_t SettingsManager::GetUserCommandsLogSampling() const {
+  return user_commands_log_sampling_;
+}
+
+void SettingsManager::SetUserCommandsLogSampling(uint32_t every) {
+  user_commands_log_sampling_ = every;
+}
+
+uint32_t SettingsManager::GetInnerCommandsLogSampling() const {
+  return inner_commands_log_sampling_;
+}
+
+void SettingsManager::SetInnerCommandsLogSampling(uint32_t every) {
+  inner_commands_log_sampling_ = every;
+}
+
+CommandLogFileFormat SettingsManager::GetCommandsLogFileFormat() const {
+  return commands_log_file_format_;
+}
+
+void SettingsManager::SetCommandsLogFileFormat(CommandLogFileFormat format) {
+  commands_log_file_format_ = format;
+}
+
+std::string SettingsManager::GetCommandsLogFilePath() const {
+  const std::string dir = ConnectionSettingsFactory::GetInstance().GetLoggingDirectory();
+  if (commands_log_file_format_ == kCommandLogFileBinary) {
+    return common::file_system::make_path(dir, COMMANDS_LOG_BINARY_FILE_NAME);
+  }
+  return common::file_system::make_path(dir, COMMANDS_LOG_JSON_FILE_NAME);
+}
+
 void SettingsManager::ReloadFromPath(const std::string& path, bool merge) {
   if (path.empty()) {
     return;
@@ -464,6 +504,10 @@ void SettingsManager::ReloadFromPath(const std::string& path, bool merge) {
       common::ConvertFromString(python_path, &qpython_path)) {
   }
   python_path_ = settings.value(PYTHON_PATH, qpython_path).toString();
+  user_commands_log_sampling_ = settings.value(USER_COMMANDS_LOG_SAMPLING, 1).toUInt();
+  inner_commands_log_sampling_ = settings.value(INNER_COMMANDS_LOG_SAMPLING, 1).toUInt();
+  int commands_log_file_format = settings.value(COMMANDS_LOG_FILE_FORMAT, kCommandLogFileNone).toInt();
+  commands_log_file_format_ = static_cast<CommandLogFileFormat>(commands_log_file_format);
   config_version_ = settings.value(CONFIG_VERSION, PROJECT_VERSION_NUMBER).toUInt();
 }
 
@@ -549,6 +593,9 @@ void SettingsManager::Save() {
   settings.setValue(LAST_PASSWORD_HASH, last_password_);
 #endif
   settings.setValue(PYTHON_PATH, python_path_);
+  settings.setValue(USER_COMMANDS_LOG_SAMPLING, user_commands_log_sampling_);
+  settings.setValue(INNER_COMMANDS_LOG_SAMPLING, inner_commands_log_sampling_);
+  settings.setValue(COMMANDS_LOG_FILE_FORMAT, static_cast<int>(commands_log_file_format_));
   settings.setValue(CONFIG_VERSION, config_version_);
 }
 
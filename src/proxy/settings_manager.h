@@ -121,6 +121,16 @@ class SettingsManager : public common::patterns::Singleton<SettingsManager> {
   QString GetPythonPath() const;
   void SetPythonPath(const QString& path);
 
+  uint32_t GetUserCommandsLogSampling() const;  // 0 - off, 1 - all, N - every N-th command
+  void SetUserCommandsLogSampling(uint32_t every);
+
+  uint32_t GetInnerCommandsLogSampling() const;
+  void SetInnerCommandsLogSampling(uint32_t every);
+
+  CommandLogFileFormat GetCommandsLogFileFormat() const;
+  void SetCommandsLogFileFormat(CommandLogFileFormat format);
+  std::string GetCommandsLogFilePath() const;
+
   void ReloadFromPath(const std::string& path, bool merge);
 
   void Load();
@@ -169,6 +179,9 @@ class SettingsManager : public common::patterns::Singleton<SettingsManager> {
   bool auto_connect_db_;
   QByteArray window_settings_;
   QString python_path_;
+  uint32_t user_commands_log_sampling_;
+  uint32_t inner_commands_log_sampling_;
+  CommandLogFileFormat commands_log_file_format_;
 };
 
 }  // namespace proxy
@@ -0,0 +1,51 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <fastonosql/core/value.h>
+
+namespace fastonosql {
+namespace proxy {
+
+// one consumer group of XINFO GROUPS reply
+struct StreamGroupInfo {
+  StreamGroupInfo();
+
+  std::string name;
+  uint64_t consumers;
+  uint64_t pending;  // delivered but not acknowledged entries
+  core::StreamValue::stream_id last_delivered_id;
+  int64_t lag;  // entries not delivered yet, -1 if server doesn't report it
+};
+
+// XINFO STREAM and XINFO GROUPS summary, entries themselves are never read
+struct StreamInfo {
+  StreamInfo();
+
+  uint64_t length;
+  core::StreamValue::stream_id first_id;  // empty for empty stream
+  core::StreamValue::stream_id last_id;
+  std::vector<StreamGroupInfo> groups;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
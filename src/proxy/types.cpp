@@ -29,6 +29,17 @@ const std::vector<const char*> g_display_strategy_types = {"FULL_KEY", "KEY_NAME
 
 const std::vector<const char*> g_supported_views_text = {"Tree", "Table", "Text"};
 
+const std::vector<const char*> g_command_log_file_formats_text = {"None", "JSON lines", "Binary"};
+
+const std::vector<const char*> g_command_file_formats_text = {"Commands", "CSV", "JSON lines"};
+
+const std::vector<const char*> g_value_codecs_text = {"Raw",  "Json", "Xml",   "MsgPack", "Pickle",
+                                                      "Zlib", "GZip", "LZ4",   "BZip2",   "Snappy"};
+
+bool ValueChangesCommands::IsEmpty() const {
+  return transaction.empty();
+}
+
 core::command_buffer_t StableCommand(core::command_buffer_t command) {
   if (!command.empty()) {
     if (command[command.size() - 1] == CARRIGE_RETURN_CHAR) {
@@ -18,9 +18,11 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include <common/error.h>
+#include <common/value.h>
 
 #include <fastonosql/core/types.h>
 
@@ -33,6 +35,44 @@ extern const std::vector<const char*> g_display_strategy_types;
 enum SupportedView : unsigned char { kTree = 0, kTable, kText };
 extern const std::vector<const char*> g_supported_views_text;
 
+// commands log file: json lines {"time":..,"type":"Redis","inner":true,"command":".."} or
+// binary records u64 time, u8 connection type, u8 logging type, u32 size, command (little endian)
+enum CommandLogFileFormat : unsigned char { kCommandLogFileNone = 0, kCommandLogFileJsonLines, kCommandLogFileBinary };
+extern const std::vector<const char*> g_command_log_file_formats_text;
+
+// files executed by driver: one command per line, csv or json array of arguments per line
+enum CommandFileFormat : unsigned char { kCommandFileCommands = 0, kCommandFileCsv, kCommandFileJsonLines };
+extern const std::vector<const char*> g_command_file_formats_text;
+
+// encoding of stored value guessed by signature of its first bytes, see SniffValueCodec
+enum ValueCodec : unsigned char {
+  kValueCodecRaw = 0,
+  kValueCodecJson,
+  kValueCodecXml,
+  kValueCodecMsgPack,
+  kValueCodecPickle,
+  kValueCodecZlib,
+  kValueCodecGzip,
+  kValueCodecLz4,
+  kValueCodecBzip2,
+  kValueCodecSnappy,
+  kValueCodecCount
+};
+extern const std::vector<const char*> g_value_codecs_text;
+
+// delta save of value loaded earlier: after watch every check must still get reply seen at load, otherwise value
+// changed meanwhile and unwatch is sent instead of transaction; transaction aborted by watch is a conflict too
+struct ValueChangesCommands {
+  typedef std::pair<core::command_buffer_t, common::Value::string_t> check_t;  // read command, expected reply
+
+  bool IsEmpty() const;
+
+  core::command_buffer_t watch;  // empty if changes don't depend on loaded state
+  std::vector<check_t> checks;
+  core::command_buffer_t unwatch;
+  std::vector<core::command_buffer_t> transaction;  // MULTI ... EXEC, empty if nothing changed
+};
+
 // GET alex\nSET alex name
 // should return vector of 2 commands "GET alex", "SET alex name"
 common::Error ParseCommands(const core::command_buffer_t& cmd, std::vector<core::command_buffer_t>* cmds);
@@ -0,0 +1,200 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "proxy/value_cache.h"
+
+#include <iterator>
+
+#include <fastonosql/core/value.h>
+
+namespace fastonosql {
+namespace proxy {
+namespace {
+
+const size_t kMaxEntryBudgetShare = 8;  // bigger values would evict most of cache, they are always reloaded
+
+std::string GetRawKey(const core::nkey_t& key) {
+  const auto data = key.GetData();
+  return std::string(data.begin(), data.end());
+}
+
+// sums element sizes without rendering value, stops once over limit since value isn't cached then
+size_t EstimateValueBytes(common::Value* value, size_t limit) {
+  if (!value) {
+    return 0;
+  }
+
+  const common::Value::Type type = value->GetType();
+  size_t bytes = 0;
+  if (type == common::Value::TYPE_ARRAY) {
+    common::ArrayValue* arr = nullptr;
+    if (value->GetAsList(&arr)) {
+      for (auto it = arr->begin(); it != arr->end() && bytes <= limit; ++it) {
+        bytes += EstimateValueBytes(*it, limit - bytes);
+      }
+    }
+  } else if (type == common::Value::TYPE_SET) {
+    common::SetValue* set = nullptr;
+    if (value->GetAsSet(&set)) {
+      for (auto it = set->begin(); it != set->end() && bytes <= limit; ++it) {
+        bytes += EstimateValueBytes(*it, limit - bytes);
+      }
+    }
+  } else if (type == common::Value::TYPE_ZSET) {
+    common::ZSetValue* zset = nullptr;
+    if (value->GetAsZSet(&zset)) {
+      for (auto it = zset->begin(); it != zset->end() && bytes <= limit; ++it) {
+        bytes += EstimateValueBytes((*it).first, limit - bytes);
+        bytes += EstimateValueBytes((*it).second, limit);
+      }
+    }
+  } else if (type == common::Value::TYPE_HASH) {
+    common::HashValue* hash = nullptr;
+    if (value->GetAsHash(&hash)) {
+      for (auto it = hash->begin(); it != hash->end() && bytes <= limit; ++it) {
+        bytes += (*it).first.size();
+        bytes += EstimateValueBytes((*it).second, limit);
+      }
+    }
+  } else if (type == core::StreamValue::TYPE_STREAM) {
+    const auto& streams = static_cast<core::StreamValue*>(value)->GetStreams();
+    for (size_t i = 0; i < streams.size() && bytes <= limit; ++i) {
+      bytes += streams[i].sid.size();
+      for (const core::StreamValue::Entry& ent : streams[i].entries) {
+        bytes += ent.name.size() + ent.value.size();
+      }
+    }
+  } else if (type == core::JsonValue::TYPE_JSON || type == common::Value::TYPE_STRING) {
+    common::Value::string_t text;  // common::Value has no size accessor, flat copy of single string
+    if (value->GetAsString(&text)) {
+      bytes = text.size();
+    }
+  } else {
+    bytes = sizeof(double);  // numbers and booleans
+  }
+
+  return bytes;
+}
+
+}  // namespace
+
+ValueCache::ValueCache(size_t bytes_budget, common::time64_t max_age_msec)
+    : bytes_budget_(bytes_budget), max_age_msec_(max_age_msec), used_bytes_(0), entries_(), index_() {}
+
+bool ValueCache::Get(const core::db_name_t& db,
+                     const core::NKey& key,
+                     common::time64_t now_msec,
+                     core::NValue* value) {
+  auto it = index_.find(entry_id_t(GetRawKey(key.GetKey()), db));
+  if (it == index_.end()) {
+    return false;
+  }
+
+  entries_t::iterator entry = it->second;
+  if (now_msec - entry->loaded_msec > max_age_msec_) {
+    Erase(it);
+    return false;
+  }
+
+  entries_.splice(entries_.begin(), entries_, entry);
+  *value = entry->value;
+  return true;
+}
+
+void ValueCache::Put(const core::db_name_t& db, const core::NDbKValue& key, common::time64_t now_msec) {
+  core::NValue value = key.GetValue();
+  if (!value) {
+    return;
+  }
+
+  const std::string raw_key = GetRawKey(key.GetKey().GetKey());
+  const entry_id_t id(raw_key, db);
+  auto it = index_.find(id);
+  if (it != index_.end()) {
+    Erase(it);
+  }
+
+  const size_t limit = bytes_budget_ / kMaxEntryBudgetShare;
+  const size_t bytes = EstimateValueBytes(value.get(), limit) + raw_key.size();
+  if (bytes > limit) {
+    return;
+  }
+
+  while (used_bytes_ + bytes > bytes_budget_ && !entries_.empty()) {
+    Erase(index_.find(entries_.back().id));
+  }
+
+  entries_.push_front({id, value, bytes, now_msec});
+  index_[id] = entries_.begin();
+  used_bytes_ += bytes;
+}
+
+void ValueCache::Invalidate(const core::db_name_t& db, const core::nkey_t& key) {
+  auto it = index_.find(entry_id_t(GetRawKey(key), db));
+  if (it != index_.end()) {
+    Erase(it);
+  }
+}
+
+void ValueCache::Invalidate(const invalidated_keys_t& keys) {
+  if (keys.empty()) {
+    Clear();
+    return;
+  }
+
+  for (const std::string& raw_key : keys) {
+    EraseKey(raw_key);
+  }
+}
+
+void ValueCache::Clear() {
+  index_.clear();
+  entries_.clear();
+  used_bytes_ = 0;
+}
+
+void ValueCache::SetMaxAge(common::time64_t max_age_msec) {
+  max_age_msec_ = max_age_msec;
+}
+
+size_t ValueCache::GetUsedBytes() const {
+  return used_bytes_;
+}
+
+size_t ValueCache::GetCount() const {
+  return entries_.size();
+}
+
+void ValueCache::Erase(index_t::iterator it) {
+  used_bytes_ -= it->second->bytes;
+  entries_.erase(it->second);
+  index_.erase(it);
+}
+
+void ValueCache::EraseKey(const std::string& raw_key) {
+  auto it = index_.lower_bound(entry_id_t(raw_key, core::db_name_t()));
+  while (it != index_.end() && it->first.first == raw_key) {
+    auto next = std::next(it);
+    Erase(it);
+    it = next;
+  }
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
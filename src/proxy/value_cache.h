@@ -0,0 +1,80 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <QMetaType>
+
+#include <common/time.h>
+
+#include <fastonosql/core/database/idatabase_info.h>
+#include <fastonosql/core/db_key.h>
+
+namespace fastonosql {
+namespace proxy {
+
+typedef std::vector<std::string> invalidated_keys_t;  // raw key names, empty means all keys
+
+// least recently used loaded values within bytes budget, entries older than max age are reloaded,
+// values are keyed by database and key, server-assisted invalidations name only keys so they hit every database
+class ValueCache {
+ public:
+  ValueCache(size_t bytes_budget, common::time64_t max_age_msec);
+
+  bool Get(const core::db_name_t& db, const core::NKey& key, common::time64_t now_msec, core::NValue* value);
+  void Put(const core::db_name_t& db, const core::NDbKValue& key, common::time64_t now_msec);
+  void Invalidate(const core::db_name_t& db, const core::nkey_t& key);
+  void Invalidate(const invalidated_keys_t& keys);
+  void Clear();
+
+  void SetMaxAge(common::time64_t max_age_msec);
+  size_t GetUsedBytes() const;
+  size_t GetCount() const;
+
+ private:
+  typedef std::pair<std::string, core::db_name_t> entry_id_t;  // raw key first, ids of one key are adjacent
+  struct Entry {
+    entry_id_t id;
+    core::NValue value;
+    size_t bytes;
+    common::time64_t loaded_msec;
+  };
+  typedef std::list<Entry> entries_t;  // most recently used first
+  typedef std::map<entry_id_t, entries_t::iterator> index_t;
+
+  void Erase(index_t::iterator it);
+  void EraseKey(const std::string& raw_key);
+
+  const size_t bytes_budget_;
+  common::time64_t max_age_msec_;
+  size_t used_bytes_;
+  entries_t entries_;
+  index_t index_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
+
+Q_DECLARE_METATYPE(fastonosql::proxy::invalidated_keys_t)
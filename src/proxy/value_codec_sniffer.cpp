@@ -0,0 +1,139 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/value_codec_sniffer.h"
+
+#include <string.h>
+
+namespace {
+
+const unsigned char lz4_frame_magic[] = {0x04, 0x22, 0x4D, 0x18};
+const unsigned char snappy_frame_magic[] = {0xFF, 0x06, 0x00, 0x00, 's', 'N', 'a', 'P', 'p', 'Y'};
+
+bool IsSpace(unsigned char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+size_t SkipSpaces(const unsigned char* bytes, size_t size, size_t pos) {
+  while (pos < size && IsSpace(bytes[pos])) {
+    pos++;
+  }
+  return pos;
+}
+
+bool IsPrintable(const unsigned char* bytes, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    if (bytes[i] < 0x20 && !IsSpace(bytes[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IsZlibHeader(unsigned char cmf, unsigned char flg) {
+  // deflate method, window up to 32k, header check bits
+  return (cmf & 0x0F) == 8 && (cmf >> 4) <= 7 && ((cmf << 8) | flg) % 31 == 0;
+}
+
+bool IsMsgPackContainer(const unsigned char* bytes, size_t size) {
+  const unsigned char type = bytes[0];
+  if (type >= 0x81 && type <= 0x8F) {  // fixmap, first key is usually str or positive int
+    const unsigned char key = bytes[1];
+    return key < 0x80 || (key >= 0xA0 && key <= 0xBF) || (key >= 0xD9 && key <= 0xDB);
+  }
+
+  if (type >= 0x91 && type <= 0x9F) {  // fixarray
+    return true;
+  }
+
+  // array 16/32, map 16/32 with big endian length, utf-8 text would have continuation byte here
+  return (type >= 0xDC && type <= 0xDF) && size >= 3 && bytes[1] < 0x80;
+}
+
+}  // namespace
+
+namespace fastonosql {
+namespace proxy {
+
+ValueCodec SniffValueCodec(const char* data, size_t size) {
+  if (!data || size < 2) {
+    return kValueCodecRaw;
+  }
+
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+  if (bytes[0] == 0x1F && bytes[1] == 0x8B) {
+    return kValueCodecGzip;
+  }
+
+  if (size >= 4 && bytes[0] == 'B' && bytes[1] == 'Z' && bytes[2] == 'h' && bytes[3] >= '1' && bytes[3] <= '9') {
+    return kValueCodecBzip2;
+  }
+
+  if (size >= sizeof(lz4_frame_magic) && memcmp(bytes, lz4_frame_magic, sizeof(lz4_frame_magic)) == 0) {
+    return kValueCodecLz4;
+  }
+
+  if (size >= sizeof(snappy_frame_magic) && memcmp(bytes, snappy_frame_magic, sizeof(snappy_frame_magic)) == 0) {
+    return kValueCodecSnappy;
+  }
+
+  if (bytes[0] == 0x80 && bytes[1] >= 2 && bytes[1] <= 5) {  // PROTO opcode, protocols 0-1 have no header
+    return kValueCodecPickle;
+  }
+
+  // text never starts with utf-8 continuation byte
+  if (IsMsgPackContainer(bytes, size)) {
+    return kValueCodecMsgPack;
+  }
+
+  // zlib header is two printable chars sometimes ("8O"), so text wins over it
+  const size_t sniff_size = size < value_codec_sniff_size ? size : value_codec_sniff_size;
+  if (!IsPrintable(bytes, sniff_size)) {
+    return IsZlibHeader(bytes[0], bytes[1]) ? kValueCodecZlib : kValueCodecRaw;
+  }
+
+  const size_t first = SkipSpaces(bytes, sniff_size, 0);
+  if (first + 1 >= sniff_size) {
+    return kValueCodecRaw;
+  }
+
+  const size_t second = SkipSpaces(bytes, sniff_size, first + 1);
+  if (second >= sniff_size) {  // only spaces after lead
+    return kValueCodecRaw;
+  }
+
+  const unsigned char lead = bytes[first];
+  const unsigned char next = bytes[second];
+  if (lead == '{' && (next == '"' || next == '}')) {
+    return kValueCodecJson;
+  }
+
+  if (lead == '[' && (next == '{' || next == '[' || next == '"' || next == ']' || next == '-' ||
+                      (next >= '0' && next <= '9') || next == 't' || next == 'f' || next == 'n')) {
+    return kValueCodecJson;
+  }
+
+  if (lead == '<' && (next == '?' || next == '!' || (next >= 'a' && next <= 'z') || (next >= 'A' && next <= 'Z'))) {
+    return kValueCodecXml;
+  }
+
+  return kValueCodecRaw;
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,35 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+
+#include "proxy/types.h"
+
+namespace fastonosql {
+namespace proxy {
+
+enum { value_codec_sniff_size = 64 };  // enough bytes for every signature, GETRANGE 0 63 in batch
+
+// looks only at signatures of first bytes: gzip/bzip2/lz4 frame/snappy frame magic, zlib header,
+// pickle PROTO opcode, msgpack map/array type byte, json/xml leading chars, never decodes value
+ValueCodec SniffValueCodec(const char* data, size_t size);
+
+}  // namespace proxy
+}  // namespace fastonosql
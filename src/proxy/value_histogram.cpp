@@ -0,0 +1,131 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "proxy/value_histogram.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace fastonosql {
+namespace proxy {
+
+namespace {
+size_t HighestBit(uint64_t value) {
+  size_t bit = 0;
+  while (value >>= 1) {
+    bit++;
+  }
+  return bit;
+}
+}  // namespace
+
+ValueHistogram::ValueHistogram()
+    : buckets_(GetBucketsCount(), 0), count_(0), sum_(0), min_(std::numeric_limits<uint64_t>::max()), max_(0) {}
+
+void ValueHistogram::Record(uint64_t value, uint64_t count) {
+  if (count == 0) {
+    return;
+  }
+
+  buckets_[GetBucketIndex(value)] += count;
+  count_ += count;
+  sum_ += value * count;
+  min_ = std::min(min_, value);
+  max_ = std::max(max_, value);
+}
+
+void ValueHistogram::Merge(const ValueHistogram& other) {
+  for (size_t i = 0; i < buckets_.size(); ++i) {
+    buckets_[i] += other.buckets_[i];
+  }
+  count_ += other.count_;
+  sum_ += other.sum_;
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+}
+
+void ValueHistogram::Reset() {
+  std::fill(buckets_.begin(), buckets_.end(), 0);
+  count_ = 0;
+  sum_ = 0;
+  min_ = std::numeric_limits<uint64_t>::max();
+  max_ = 0;
+}
+
+uint64_t ValueHistogram::GetCount() const {
+  return count_;
+}
+
+uint64_t ValueHistogram::GetSum() const {
+  return sum_;
+}
+
+uint64_t ValueHistogram::GetMin() const {
+  return count_ ? min_ : 0;
+}
+
+uint64_t ValueHistogram::GetMax() const {
+  return max_;
+}
+
+uint64_t ValueHistogram::GetPercentile(double percentile) const {
+  if (!count_) {
+    return 0;
+  }
+
+  const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+  uint64_t rank = static_cast<uint64_t>(clamped / 100.0 * count_ + 0.5);
+  rank = std::max<uint64_t>(rank, 1);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < buckets_.size(); ++i) {
+    seen += buckets_[i];
+    if (seen >= rank) {
+      return std::min(std::max(GetBucketUpperBound(i), min_), max_);
+    }
+  }
+
+  return max_;
+}
+
+size_t ValueHistogram::GetBucketIndex(uint64_t value) {
+  if (value < kSubBuckets) {
+    return value;
+  }
+
+  const size_t shift = HighestBit(value) - kSubBucketBits;
+  const size_t sub = (value >> shift) & (kSubBuckets - 1);
+  return kSubBuckets + shift * kSubBuckets + sub;
+}
+
+uint64_t ValueHistogram::GetBucketUpperBound(size_t index) {
+  if (index < kSubBuckets) {
+    return index;
+  }
+
+  const size_t shift = (index - kSubBuckets) / kSubBuckets;
+  const uint64_t sub = (index - kSubBuckets) % kSubBuckets;
+  const uint64_t lower = (kSubBuckets + sub) << shift;
+  return lower + ((uint64_t(1) << shift) - 1);
+}
+
+size_t ValueHistogram::GetBucketsCount() {
+  return kSubBuckets + (64 - kSubBucketBits) * kSubBuckets;
+}
+
+}  // namespace proxy
+}  // namespace fastonosql
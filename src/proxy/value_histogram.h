@@ -0,0 +1,60 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace fastonosql {
+namespace proxy {
+
+// log-linear buckets: values below 2^kSubBucketBits are exact, every next power of two
+// is split into 2^kSubBucketBits buckets, so percentile error stays under 1/2^kSubBucketBits
+class ValueHistogram {
+ public:
+  enum { kSubBucketBits = 3, kSubBuckets = 1 << kSubBucketBits };
+
+  ValueHistogram();
+
+  void Record(uint64_t value, uint64_t count = 1);
+  void Merge(const ValueHistogram& other);
+  void Reset();
+
+  uint64_t GetCount() const;
+  uint64_t GetSum() const;
+  uint64_t GetMin() const;
+  uint64_t GetMax() const;
+  uint64_t GetPercentile(double percentile) const;  // percentile in [0, 100]
+
+  static size_t GetBucketIndex(uint64_t value);
+  static uint64_t GetBucketUpperBound(size_t index);
+  static size_t GetBucketsCount();
+
+ private:
+  std::vector<uint64_t> buckets_;
+  uint64_t count_;
+  uint64_t sum_;
+  uint64_t min_;
+  uint64_t max_;
+};
+
+}  // namespace proxy
+}  // namespace fastonosql
@@ -0,0 +1,87 @@
+/*  Copyright (C) 2014-2019 FastoGT. All right reserved.
+
+    This file is part of FastoNoSQL.
+
+    FastoNoSQL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    FastoNoSQL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FastoNoSQL. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "gui/fast_codecs.h"
+
+namespace {
+
+std::string MakeInput(size_t size) {
+  std::string input(size, 0);
+  for (size_t i = 0; i < size; ++i) {
+    input[i] = static_cast<char>(i * 131 + 7);
+  }
+  return input;
+}
+
+void BM_HexEncode(benchmark::State& state) {
+  const std::string input = MakeInput(state.range(0));
+  std::string out(input.size() * 4, 0);
+  for (auto _ : state) {
+    fastonosql::gui::hex_encode(reinterpret_cast<const unsigned char*>(input.data()), input.size(), true, &out[0]);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+void BM_HexDecode(benchmark::State& state) {
+  const std::string input = MakeInput(state.range(0));
+  std::string hex(input.size() * 4, 0);
+  fastonosql::gui::hex_encode(reinterpret_cast<const unsigned char*>(input.data()), input.size(), true, &hex[0]);
+  std::string out(input.size(), 0);
+  for (auto _ : state) {
+    bool ok = fastonosql::gui::hex_decode(hex.data(), hex.size(), reinterpret_cast<unsigned char*>(&out[0]));
+    benchmark::DoNotOptimize(ok);
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+void BM_Base64Encode(benchmark::State& state) {
+  const std::string input = MakeInput(state.range(0));
+  std::string out(fastonosql::gui::base64_encoded_size(input.size()), 0);
+  for (auto _ : state) {
+    fastonosql::gui::base64_encode(reinterpret_cast<const unsigned char*>(input.data()), input.size(), &out[0]);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+void BM_Base64Decode(benchmark::State& state) {
+  const std::string input = MakeInput(state.range(0));
+  std::string encoded(fastonosql::gui::base64_encoded_size(input.size()), 0);
+  fastonosql::gui::base64_encode(reinterpret_cast<const unsigned char*>(input.data()), input.size(), &encoded[0]);
+  std::string out(encoded.size() / 4 * 3, 0);
+  for (auto _ : state) {
+    size_t out_size = 0;
+    bool ok = fastonosql::gui::base64_decode(encoded.data(), encoded.size(), reinterpret_cast<unsigned char*>(&out[0]),
+                                             &out_size);
+    benchmark::DoNotOptimize(ok);
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+}  // namespace
+
+// value sizes from short strings up to large values shown in viewer
+BENCHMARK(BM_HexEncode)->Range(64, 16 << 20);
+BENCHMARK(BM_HexDecode)->Range(64, 16 << 20);
+BENCHMARK(BM_Base64Encode)->Range(64, 16 << 20);
+BENCHMARK(BM_Base64Decode)->Range(64, 16 << 20);